@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdbx-static.dir/mdbx.c++.o"
+  "CMakeFiles/mdbx-static.dir/mdbx.c++.o.d"
+  "CMakeFiles/mdbx-static.dir/mdbx.c.o"
+  "CMakeFiles/mdbx-static.dir/mdbx.c.o.d"
+  "libmdbx-static.a"
+  "libmdbx-static.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/mdbx-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdbx.dir/mdbx.c++.o"
+  "CMakeFiles/mdbx.dir/mdbx.c++.o.d"
+  "CMakeFiles/mdbx.dir/mdbx.c.o"
+  "CMakeFiles/mdbx.dir/mdbx.c.o.d"
+  "libmdbx.pdb"
+  "libmdbx.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/mdbx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
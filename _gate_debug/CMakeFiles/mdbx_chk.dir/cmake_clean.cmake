@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdbx_chk.dir/mdbx_chk.c.o"
+  "CMakeFiles/mdbx_chk.dir/mdbx_chk.c.o.d"
+  "mdbx_chk"
+  "mdbx_chk.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_chk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
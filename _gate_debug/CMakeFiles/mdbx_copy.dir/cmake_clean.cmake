@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdbx_copy.dir/mdbx_copy.c.o"
+  "CMakeFiles/mdbx_copy.dir/mdbx_copy.c.o.d"
+  "mdbx_copy"
+  "mdbx_copy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_copy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
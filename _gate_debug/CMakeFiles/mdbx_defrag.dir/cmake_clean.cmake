@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdbx_defrag.dir/mdbx_defrag.c.o"
+  "CMakeFiles/mdbx_defrag.dir/mdbx_defrag.c.o.d"
+  "mdbx_defrag"
+  "mdbx_defrag.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_defrag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdbx_drop.dir/mdbx_drop.c.o"
+  "CMakeFiles/mdbx_drop.dir/mdbx_drop.c.o.d"
+  "mdbx_drop"
+  "mdbx_drop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_drop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
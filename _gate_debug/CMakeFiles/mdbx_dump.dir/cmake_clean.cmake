@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdbx_dump.dir/mdbx_dump.c.o"
+  "CMakeFiles/mdbx_dump.dir/mdbx_dump.c.o.d"
+  "mdbx_dump"
+  "mdbx_dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
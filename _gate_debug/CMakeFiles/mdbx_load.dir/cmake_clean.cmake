@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdbx_load.dir/mdbx_load.c.o"
+  "CMakeFiles/mdbx_load.dir/mdbx_load.c.o.d"
+  "mdbx_load"
+  "mdbx_load.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_load.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdbx_stat.dir/mdbx_stat.c.o"
+  "CMakeFiles/mdbx_stat.dir/mdbx_stat.c.o.d"
+  "mdbx_stat"
+  "mdbx_stat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_stat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../mdbx_legacy_example"
+  "../mdbx_legacy_example.pdb"
+  "CMakeFiles/mdbx_legacy_example.dir/example-mdbx.c.o"
+  "CMakeFiles/mdbx_legacy_example.dir/example-mdbx.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_legacy_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
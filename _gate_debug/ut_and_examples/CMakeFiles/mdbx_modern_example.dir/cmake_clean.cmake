@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../mdbx_modern_example"
+  "../mdbx_modern_example.pdb"
+  "CMakeFiles/mdbx_modern_example.dir/example-mdbx.c++.o"
+  "CMakeFiles/mdbx_modern_example.dir/example-mdbx.c++.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mdbx_modern_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../mdbx_ut_async"
+  "../mdbx_ut_async.pdb"
+  "CMakeFiles/mdbx_ut_async.dir/ut-async.c++.o"
+  "CMakeFiles/mdbx_ut_async.dir/ut-async.c++.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mdbx_ut_async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../mdbx_ut_bulk_load"
+  "../mdbx_ut_bulk_load.pdb"
+  "CMakeFiles/mdbx_ut_bulk_load.dir/ut-bulk_load.c.o"
+  "CMakeFiles/mdbx_ut_bulk_load.dir/ut-bulk_load.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_ut_bulk_load.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
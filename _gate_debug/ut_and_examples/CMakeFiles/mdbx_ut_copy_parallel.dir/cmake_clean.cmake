@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../mdbx_ut_copy_parallel"
+  "../mdbx_ut_copy_parallel.pdb"
+  "CMakeFiles/mdbx_ut_copy_parallel.dir/ut-copy_parallel.c.o"
+  "CMakeFiles/mdbx_ut_copy_parallel.dir/ut-copy_parallel.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_ut_copy_parallel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../mdbx_ut_get_many"
+  "../mdbx_ut_get_many.pdb"
+  "CMakeFiles/mdbx_ut_get_many.dir/ut-get_many.c.o"
+  "CMakeFiles/mdbx_ut_get_many.dir/ut-get_many.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mdbx_ut_get_many.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
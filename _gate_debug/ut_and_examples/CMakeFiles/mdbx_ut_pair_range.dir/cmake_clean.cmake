@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../mdbx_ut_pair_range"
+  "../mdbx_ut_pair_range.pdb"
+  "CMakeFiles/mdbx_ut_pair_range.dir/ut-pair_range.c++.o"
+  "CMakeFiles/mdbx_ut_pair_range.dir/ut-pair_range.c++.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mdbx_ut_pair_range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../pcrf_simulator"
+  "../pcrf_simulator.pdb"
+  "CMakeFiles/pcrf_simulator.dir/pcrf/pcrf_simulator.c.o"
+  "CMakeFiles/pcrf_simulator.dir/pcrf/pcrf_simulator.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pcrf_simulator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ut_and_examples
+# Build directory: /root/repo/_gate_debug/ut_and_examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(c_api "/root/repo/_gate_debug/mdbx_legacy_example")
+set_tests_properties(c_api PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ut_and_examples/CMakeLists.txt;53;add_test;/root/repo/ut_and_examples/CMakeLists.txt;0;")
+add_test(get_many "/root/repo/_gate_debug/mdbx_ut_get_many")
+set_tests_properties(get_many PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ut_and_examples/CMakeLists.txt;54;add_test;/root/repo/ut_and_examples/CMakeLists.txt;0;")
+add_test(copy_parallel "/root/repo/_gate_debug/mdbx_ut_copy_parallel")
+set_tests_properties(copy_parallel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ut_and_examples/CMakeLists.txt;55;add_test;/root/repo/ut_and_examples/CMakeLists.txt;0;")
+add_test(bulk_load "/root/repo/_gate_debug/mdbx_ut_bulk_load")
+set_tests_properties(bulk_load PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ut_and_examples/CMakeLists.txt;56;add_test;/root/repo/ut_and_examples/CMakeLists.txt;0;")
+add_test(c++_api "/root/repo/_gate_debug/mdbx_modern_example")
+set_tests_properties(c++_api PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ut_and_examples/CMakeLists.txt;58;add_test;/root/repo/ut_and_examples/CMakeLists.txt;0;")
+add_test(pair_range "/root/repo/_gate_debug/mdbx_ut_pair_range")
+set_tests_properties(pair_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ut_and_examples/CMakeLists.txt;59;add_test;/root/repo/ut_and_examples/CMakeLists.txt;0;")
+add_test(async "/root/repo/_gate_debug/mdbx_ut_async")
+set_tests_properties(async PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ut_and_examples/CMakeLists.txt;61;add_test;/root/repo/ut_and_examples/CMakeLists.txt;0;")
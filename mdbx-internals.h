@@ -1328,6 +1328,30 @@ typedef struct osal_mmap {
 #endif
 #endif /* MDBX_HAVE_PWRITEV */
 
+/** Advanced: Using Linux' io_uring for batch writing of dirty pages (autodetection by default).
+ * \details When enabled, the availability of io_uring is checked at runtime and libmdbx falls back
+ * to the pwrite()/pwritev() path if io_uring is unusable, e.g. restricted by seccomp or an old kernel. */
+#ifndef MDBX_USE_IOURING
+#if (defined(__linux__) || defined(__gnu_linux__)) && !defined(__ANDROID_API__) && MDBX_HAVE_PWRITEV &&               \
+    __has_include(<linux/io_uring.h>) && !defined(MDBX_SAFE4QEMU)
+#define MDBX_USE_IOURING 1
+#else
+#define MDBX_USE_IOURING 0
+#endif
+#define MDBX_USE_IOURING_CONFIG "AUTO=" MDBX_STRINGIFY(MDBX_USE_IOURING)
+#elif !(MDBX_USE_IOURING == 0 || MDBX_USE_IOURING == 1)
+#error MDBX_USE_IOURING must be defined as 0 or 1
+#elif MDBX_USE_IOURING && !MDBX_HAVE_PWRITEV
+#error MDBX_USE_IOURING requires MDBX_HAVE_PWRITEV
+#else
+#define MDBX_USE_IOURING_CONFIG MDBX_STRINGIFY(MDBX_USE_IOURING)
+#endif /* MDBX_USE_IOURING */
+
+#if MDBX_USE_IOURING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif /* MDBX_USE_IOURING */
+
 typedef struct ior_item {
 #if defined(_WIN32) || defined(_WIN64)
   OVERLAPPED ov;
@@ -1371,6 +1395,21 @@ typedef struct osal_ioring {
   unsigned last_bytes;
 #define ior_last_sgvcnt(ior, item) (item)->sgvcnt
 #define ior_last_bytes(ior, item) (ior)->last_bytes
+#if MDBX_USE_IOURING
+  /* The io_uring instance is set up lazily at the first batch write, so the negative fd
+   * means not set up yet, while `disabled` means unavailable, i.e. fallback to pwritev(). */
+  struct {
+    int fd;
+    bool disabled;
+    unsigned sq_entries, cq_entries;
+    unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *sq_ring, *cq_ring;
+    size_t sq_ring_bytes, cq_ring_bytes;
+  } uring;
+#endif /* MDBX_USE_IOURING */
 #else
 #define ior_last_sgvcnt(ior, item) (1)
 #define ior_last_bytes(ior, item) (item)->single.iov_len
@@ -1403,7 +1442,7 @@ MDBX_MAYBE_UNUSED static inline uintptr_t osal_thread_self(void) {
 
 #ifndef __cplusplus
 
-/* Actually this is not ioring for now, but on the way. */
+/* Batch writer of dirty pages, i.e. the io_uring on Linux (if available) or a sequence of pwritev(). */
 MDBX_INTERNAL int osal_ioring_create(osal_ioring_t *
 #if defined(_WIN32) || defined(_WIN64)
                                      ,
@@ -1416,7 +1455,7 @@ MDBX_INTERNAL void osal_ioring_reset(osal_ioring_t *);
 MDBX_INTERNAL int osal_ioring_add(osal_ioring_t *ctx, const size_t offset, void *data, const size_t bytes);
 typedef struct osal_ioring_write_result {
   int err;
-  unsigned wops;
+  unsigned wops /* submitted and completed write operations */;
 } osal_ioring_write_result_t;
 MDBX_INTERNAL osal_ioring_write_result_t osal_ioring_write(osal_ioring_t *ior, mdbx_filehandle_t fd);
 
@@ -1533,6 +1572,7 @@ MDBX_INTERNAL int osal_condpair_lock(osal_condpair_t *condpair);
 MDBX_INTERNAL int osal_condpair_unlock(osal_condpair_t *condpair);
 MDBX_INTERNAL int osal_condpair_signal(osal_condpair_t *condpair, bool part);
 MDBX_INTERNAL int osal_condpair_wait(osal_condpair_t *condpair, bool part);
+MDBX_INTERNAL int osal_condpair_timedwait(osal_condpair_t *condpair, bool part, unsigned timeout_ms);
 MDBX_INTERNAL int osal_condpair_destroy(osal_condpair_t *condpair);
 
 MDBX_INTERNAL int osal_fastmutex_init(osal_fastmutex_t *fastmutex);
@@ -1544,10 +1584,12 @@ MDBX_INTERNAL int osal_pwritev(mdbx_filehandle_t fd, struct iovec *iov, size_t s
 MDBX_INTERNAL int osal_pread(mdbx_filehandle_t fd, void *buf, size_t count, uint64_t offset);
 MDBX_INTERNAL int osal_pwrite(mdbx_filehandle_t fd, const void *buf, size_t count, uint64_t offset);
 MDBX_INTERNAL int osal_write(mdbx_filehandle_t fd, const void *buf, size_t count);
+MDBX_INTERNAL int osal_read(mdbx_filehandle_t fd, void *buf, size_t count);
 
 MDBX_INTERNAL int osal_thread_create(osal_thread_t *thread, THREAD_RESULT(THREAD_CALL *start_routine)(void *),
                                      void *arg);
 MDBX_INTERNAL int osal_thread_join(osal_thread_t thread);
+MDBX_INTERNAL unsigned osal_cpu_count(void);
 
 enum osal_syncmode_bits {
   MDBX_SYNC_NONE = 0,
@@ -1595,6 +1637,8 @@ MDBX_INTERNAL int osal_removefile(const pathchar_t *pathname);
 MDBX_INTERNAL int osal_removedirectory(const pathchar_t *pathname);
 MDBX_INTERNAL int osal_is_pipe(mdbx_filehandle_t fd);
 MDBX_INTERNAL int osal_lockfile(mdbx_filehandle_t fd, bool wait);
+MDBX_INTERNAL int osal_lockfile_probe(mdbx_filehandle_t fd);
+MDBX_INTERNAL int osal_lockfile_downgrade(mdbx_filehandle_t fd);
 
 #define MMAP_OPTION_SETLENGTH 1
 #define MMAP_OPTION_SEMAPHORE 2
@@ -1909,6 +1953,31 @@ MDBX_MAYBE_UNUSED MDBX_NOTHROW_PURE_FUNCTION static inline uint32_t osal_bswap32
 #error MDBX_ENVCOPY_WRITEBUF must be defined in range 65536..1073741824 and be multiple of 65536
 #endif /* MDBX_ENVCOPY_WRITEBUF */
 
+/** Maximal number of worker threads used for parallel compacting copy,
+ * \see MDBX_CP_PARALLEL */
+#ifndef MDBX_ENVCOPY_MAXTHREADS
+#define MDBX_ENVCOPY_MAXTHREADS 16
+#elif MDBX_ENVCOPY_MAXTHREADS < 1 || MDBX_ENVCOPY_MAXTHREADS > 256
+#error MDBX_ENVCOPY_MAXTHREADS must be defined in range 1..256
+#endif /* MDBX_ENVCOPY_MAXTHREADS */
+
+/** Maximal number of worker threads used for parallel warming up,
+ * \see MDBX_warmup_parallel */
+#ifndef MDBX_WARMUP_MAXTHREADS
+#define MDBX_WARMUP_MAXTHREADS 16
+#elif MDBX_WARMUP_MAXTHREADS < 1 || MDBX_WARMUP_MAXTHREADS > 256
+#error MDBX_WARMUP_MAXTHREADS must be defined in range 1..256
+#endif /* MDBX_WARMUP_MAXTHREADS */
+
+/** Number of reclaimed pages to prefetch ahead of allocation from the GC,
+ * as well as enables prefetching of the next GC leaf and large-page records.
+ * Zero value disables such prefetching at all. */
+#ifndef MDBX_GC_PREFETCH_LOOKAHEAD
+#define MDBX_GC_PREFETCH_LOOKAHEAD 32
+#elif MDBX_GC_PREFETCH_LOOKAHEAD < 0 || MDBX_GC_PREFETCH_LOOKAHEAD > 4096
+#error MDBX_GC_PREFETCH_LOOKAHEAD must be defined in range 0..4096
+#endif /* MDBX_GC_PREFETCH_LOOKAHEAD */
+
 /** Forces assertion checking corresponding to define \ref MDBX_CHECKING as 2.
  * \deprecated Please use \ref MDBX_CHECKING instead. */
 #ifndef MDBX_FORCE_ASSERTIONS
@@ -2512,7 +2581,7 @@ typedef struct meta {
 
   uint16_t reserve16;   /* extra flags, zero (nothing) for now */
   uint8_t validator_id; /* ID of checksum and page validation method,
-                         * zero (nothing) for now */
+                         * zero (nothing) or MDBX_VALIDATOR_CRC32C */
   int8_t extra_pagehdr; /* extra bytes in the page header,
                          * zero (nothing) for now */
 
@@ -2697,7 +2766,7 @@ MDBX_MAYBE_UNUSED MDBX_NOTHROW_PURE_FUNCTION static inline bool is_subpage(const
 }
 
 /* The version number for a database's lockfile format. */
-#define MDBX_LOCK_VERSION 7
+#define MDBX_LOCK_VERSION 10
 
 #if MDBX_LOCKING == MDBX_LOCKING_WIN32FILES
 
@@ -2792,13 +2861,26 @@ typedef struct pgops {
     /* Максимальное замеченное количество страниц удерживаемых от переработки из-за чтения старых MVCC-снимков */
     uint32_t max_retained_pages;
   } gc_prof;
+
+  mdbx_atomic_uint64_t pgsum_computed; /* Quantity of pages checksummed while writing */
+  mdbx_atomic_uint64_t pgsum_verified; /* Quantity of pages verified by checksums */
+  mdbx_atomic_uint64_t pgsum_mismatch; /* Quantity of checksum mismatches caught */
+
+  /* Reader slots allocation */
+  struct {
+    mdbx_atomic_uint32_t lockfree;   /* Slots claimed without acquiring the rdt_lock */
+    mdbx_atomic_uint32_t locked;     /* Slots claimed under the rdt_lock */
+    mdbx_atomic_uint32_t collisions; /* Races lost to other readers for a free slot */
+    mdbx_atomic_uint32_t exhausted;  /* Cases of the table is full and cleanup of dead readers was needed */
+  } rslot;
 } pgop_stat_t;
 
 /* Reader Lock Table
  *
  * Readers don't acquire any locks for their data access. Instead, they
- * simply record their transaction ID in the reader table. The reader
- * mutex is needed just to find an empty slot in the reader table. The
+ * simply record their transaction ID in the reader table. An empty slot is
+ * claimed by CAS of its pid, so the reader mutex is needed just to extend the
+ * used part of the table or when no empty slot was found without it. The
  * slot's address is saved in thread-specific data so that subsequent
  * read transactions started by the same thread need no further locking to
  * proceed.
@@ -2875,6 +2957,9 @@ typedef struct reader_slot {
   mdbx_atomic_uint64_t snapshot_pages_retired;
 } reader_slot_t;
 
+/* Number of the readers table shards for tracking of the oldest reader. */
+#define MDBX_RDT_SHARDS 64
+
 /* The header for the reader table (a memory-mapped lock file). */
 typedef struct shared_lck {
   /* Stamp identifying this as an MDBX file.
@@ -2952,6 +3037,16 @@ typedef struct shared_lck {
     uint64_t mask[4];
   } mincore_cache;
 
+  /* Cached minimums of readers' txnid for shards of the readers table, where
+   * the slot N belongs to the shard N % MDBX_RDT_SHARDS. These are maintained
+   * only by the writer, which rescans just the shards changed by readers since
+   * the previous scan. Zero means the value is unknown, e.g. the writer was
+   * crashed while updating it. */
+  struct {
+    txnid_t oldest;
+    uint64_t retired;
+  } rdt_shard_cache[MDBX_RDT_SHARDS];
+
   MDBX_ALIGNAS(MDBX_CACHELINE_SIZE) /* cacheline ----------------------------*/
 
 #if MDBX_LOCKING > 0
@@ -2965,6 +3060,15 @@ typedef struct shared_lck {
   mdbx_atomic_uint32_t rdt_length;
   mdbx_atomic_uint32_t rdt_refresh_flag;
 
+  /* Index of a slot from which the lock-free search of a free one starts.
+   * Any slots below are probably busy, but this is not guaranteed, since the
+   * hint is lowered on release by CAS and raised on claim without a lock. */
+  mdbx_atomic_uint32_t rdt_free_hint;
+
+  /* Per shard signs of changes in the readers table, similar to the
+   * rdt_refresh_flag but for the corresponding shard only. */
+  mdbx_atomic_uint32_t rdt_shard_refresh[MDBX_RDT_SHARDS];
+
 #if FLEXIBLE_ARRAY_MEMBERS
   MDBX_ALIGNAS(MDBX_CACHELINE_SIZE) /* cacheline ----------------------------*/
   reader_slot_t rdt[] /* dynamic size */;
@@ -2980,6 +3084,144 @@ typedef struct shared_lck {
 
 #define MDBX_LOCK_MAGIC ((MDBX_MAGIC << 8) + MDBX_LOCK_VERSION)
 
+/* Page checksums are kept in a separate file, since the page header has no
+ * room for ones. The file consist of the header and the array of 64-bit
+ * entries indexed by page number, each of which binds CRC32C to the txnid of
+ * a page version: (uint64_t)(uint32_t)txnid << 32 | crc32c.
+ *
+ * The entries are trusted only for pages with txnid within [epoch, maintained],
+ * i.e. written by the processes which maintain the checksums continuously
+ * since the epoch. Therefore the pages written by others are not verified,
+ * but never lead to false alarms. */
+#define MDBX_VALIDATOR_CRC32C 1
+#define MDBX_PGSUM_VERSION 1
+#define MDBX_PGSUM_MAGIC ((MDBX_MAGIC << 8) + MDBX_PGSUM_VERSION)
+
+typedef struct pgsum_header {
+  /* Stamp identifying this as an MDBX checksums file.
+   * It must be set to MDBX_MAGIC with MDBX_PGSUM_VERSION. */
+  uint64_t magic_and_version;
+  uint32_t validator_id;
+  uint32_t pagesize;
+  /* GUID of the database DXB file, to which the checksums belong. */
+  bin128_t dxbid;
+  /* The first txnid since which the checksums are maintained continuously. */
+  mdbx_atomic_uint64_t epoch;
+  /* The last txnid for which the checksums are maintained. */
+  mdbx_atomic_uint64_t maintained;
+  uint64_t reserved[2];
+} pgsum_header_t;
+
+/* The hot-page map of mdbx_env_hotmap_save() is a header followed by a bitmap
+ * of the database pages resident in RAM at the moment of sampling. Each bit
+ * corresponds to a unit which is the greater of the database and the system
+ * page sizes. The map is a hint only, therefore it is never synced to disk,
+ * while a torn or stale map is detected by the checksum and the dxbid. */
+#define MDBX_HOTMAP_VERSION 1
+#define MDBX_HOTMAP_MAGIC ((MDBX_MAGIC << 8) + MDBX_HOTMAP_VERSION)
+
+typedef struct hotmap_header {
+  /* Stamp identifying this as an MDBX hot-page map file.
+   * It must be set to MDBX_MAGIC with MDBX_HOTMAP_VERSION. */
+  uint64_t magic_and_version;
+  uint32_t pagesize;
+  uint32_t unit_ln2; /* log2 of bytes per bit */
+  /* GUID of the database DXB file, to which the map belongs. */
+  bin128_t dxbid;
+  uint64_t txnid;    /* the recent txnid at the moment of sampling */
+  uint64_t units;    /* number of bits in the bitmap */
+  uint64_t hot;      /* number of set bits */
+  uint32_t checksum; /* CRC32C of the bitmap */
+  uint32_t reserved;
+} hotmap_header_t;
+
+/* The hot-key cache of mdbx_hcache_get() is a set-associative table of the
+ * MDBX_cache_entry_t records, each of which is stored together with a key.
+ * Every slot is guarded by a sequence lock (odd while being updated), so
+ * lookups are lock-free and the table could be placed in a file shared by
+ * multiple processes, since the records hold only offsets within the DXB.
+ * The victim for a new key is chosen within a set by CLOCK (second chance). */
+#define MDBX_HCACHE_VERSION 1
+#define MDBX_HCACHE_MAGIC ((MDBX_MAGIC << 8) + MDBX_HCACHE_VERSION)
+#define MDBX_HCACHE_WAYS 8
+#define MDBX_HCACHE_SLOT_SIZE 128
+#define MDBX_HCACHE_KEYMAX (MDBX_HCACHE_SLOT_SIZE - 16 - sizeof(MDBX_cache_entry_t))
+
+typedef struct hcache_slot {
+  /* Sequence lock, an odd value means the slot is being updated. */
+  mdbx_atomic_uint32_t seq;
+  /* CLOCK reference bit. */
+  mdbx_atomic_uint32_t clock;
+  /* The upper half of the key hash, the lower one is used to select a set. */
+  uint32_t hash;
+  /* The key length, zero for an empty slot. */
+  uint16_t klen;
+  uint16_t reserved;
+  MDBX_cache_entry_t entry;
+  uint8_t key[MDBX_HCACHE_KEYMAX];
+} hcache_slot_t;
+
+enum hcache_state { hcache_initial = 0, hcache_initializing = 1, hcache_ready = 2 };
+
+typedef struct hcache_header {
+  /* Stamp identifying this as an MDBX hot-key cache.
+   * It must be set to MDBX_MAGIC with MDBX_HCACHE_VERSION. */
+  uint64_t magic_and_version;
+  /* The value of hcache_state. */
+  mdbx_atomic_uint32_t state;
+  /* Sizes of slot and size_t, and number of ways in the set. */
+  uint32_t layout;
+  /* Number of sets, always a power of two. */
+  uint64_t sets;
+  /* Hash of the table name, to which the cache belongs. */
+  uint64_t table_hash;
+  /* GUID of the database DXB file, to which the cache belongs. */
+  bin128_t dxbid;
+  /* The most recent txnid the cache entries were confirmed for. */
+  mdbx_atomic_uint64_t confirmed;
+  /* Padding up to the slot size. */
+  uint64_t reserved[9];
+} hcache_header_t;
+
+/* The stream of mdbx_env_copy_incremental() consists of the header followed
+ * by chunks of pages, each of which is a pair of pgno and number of pages
+ * followed by the pages themselves. The last chunk has zero pgno and holds
+ * the triplet of meta-pages. */
+#define MDBX_INCREMENTAL_VERSION 2
+#define MDBX_INCREMENTAL_MAGIC ((MDBX_MAGIC << 8) + 128 + MDBX_INCREMENTAL_VERSION)
+
+typedef struct incremental_header {
+  /* Stamp identifying this as an MDBX incremental copy.
+   * It must be set to MDBX_MAGIC with MDBX_INCREMENTAL_VERSION. */
+  uint64_t magic_and_version;
+  uint32_t pagesize;
+  /* The combination of INCREMENTAL_SINGLE_COMMIT and INCREMENTAL_BASE_KNOWN flags. */
+  uint32_t flags;
+  /* The txnid of base snapshot, only pages changed after which are included. */
+  uint64_t since_txnid;
+  /* The txnid of the copied snapshot. */
+  uint64_t txnid;
+  /* The GUID of the database, which is kept by as-is copies. */
+  bin128_t dxbid;
+  /* The b-trees and geometry of the base snapshot, if INCREMENTAL_BASE_KNOWN. */
+  tree_t base_gc, base_main;
+  geo_t base_geometry;
+  uint32_t reserved[3];
+} incremental_header_t;
+
+/* The stream holds the changes of a single commit, so its pages are never
+ * reachable from the meta-pages of the base snapshot. Such streams are
+ * produced by the commit stream, see mdbx_env_set_commit_stream(). */
+#define INCREMENTAL_SINGLE_COMMIT 1
+/* The base snapshot was still available in the meta-pages while copying,
+ * so the header holds its b-trees and geometry to be verified on applying. */
+#define INCREMENTAL_BASE_KNOWN 2
+
+typedef struct incremental_chunk {
+  pgno_t pgno;
+  pgno_t npages;
+} incremental_chunk_t;
+
 #define MDBX_READERS_LIMIT 32767
 
 #define MIN_MAPSIZE (MDBX_MIN_PAGESIZE * MIN_PAGENO)
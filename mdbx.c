@@ -300,6 +300,29 @@ MDBX_MAYBE_UNUSED static __always_inline uint32_t atomic_add32(mdbx_atomic_uint3
 
 #define atomic_sub32(p, v) atomic_add32(p, 0 - (v))
 
+/* Marks the shard of the reader slot as changed, so it will be rescanned by
+ * the writer, but the rdt_refresh_flag should be set after that. */
+MDBX_MAYBE_UNUSED static inline void rdt_shard_touch(lck_t *lck, const reader_slot_t *slot) {
+  atomic_store32(&lck->rdt_shard_refresh[(size_t)(slot - lck->rdt) % MDBX_RDT_SHARDS], true, mo_Relaxed);
+}
+
+/* Notifies the writer about a change of the reader slot. */
+MDBX_MAYBE_UNUSED static inline void rdt_refresh(lck_t *lck, const reader_slot_t *slot) {
+  rdt_shard_touch(lck, slot);
+  atomic_store32(&lck->rdt_refresh_flag, true, mo_AcquireRelease);
+}
+
+/* Lowers the hint for the lock-free search of a free reader slot and marks
+ * the slot's shard as changed, should be called after the slot has been
+ * vacated and before setting the rdt_refresh_flag. */
+MDBX_MAYBE_UNUSED static inline void rdt_vacated(lck_t *lck, const reader_slot_t *slot) {
+  rdt_shard_touch(lck, slot);
+  const uint32_t index = (uint32_t)(slot - lck->rdt);
+  uint32_t hint = atomic_load32(&lck->rdt_free_hint, mo_Relaxed);
+  while (index < hint && !atomic_cas32(&lck->rdt_free_hint, hint, index))
+    hint = atomic_load32(&lck->rdt_free_hint, mo_Relaxed);
+}
+
 MDBX_MAYBE_UNUSED static __always_inline uint64_t safe64_txnid_next(uint64_t txnid) {
   txnid += xMDBX_TXNID_STEP;
 #if !MDBX_64BIT_CAS
@@ -874,7 +897,8 @@ enum signatures {
   txn_signature = INT32_C(0x13D53A31),
   cur_signature_live = INT32_C(0x7E05D5B1),
   cur_signature_ready4dispose = INT32_C(0x2817A047),
-  cur_signature_wait4eot = INT32_C(0x10E297A7)
+  cur_signature_wait4eot = INT32_C(0x10E297A7),
+  hcache_signature = INT32_C(0x4CAC4E17)
 };
 
 /*----------------------------------------------------------------------------*/
@@ -1058,6 +1082,11 @@ struct MDBX_txn {
         rkl_t ready4reuse; /* The list of reclaimed txn-ids from GC, and cleared/deleted */
         uint64_t spent;    /* Time spent reading and searching GC */
         rkl_t comeback;    /* The list of ids of records returned into GC during commit, etc */
+        size_t rsteps;     /* Search iterations inside GC, kept for the next txn */
+        unsigned rp_augment_limit; /* Effective for this txn, see MDBX_opt_gc_adaptive */
+        uint8_t policy;            /* MDBX_gc_policy_reasons_t */
+        bool lifo;                 /* LIFO reclaiming, see MDBX_LIFORECLAIM */
+        unsigned prefetch_countdown; /* Allocations left until the next repnl prefetch */
       } gc;
       bool prefault_write_activated;
 #if MDBX_ENABLE_REFUND
@@ -1090,6 +1119,9 @@ struct MDBX_txn {
         size_t writemap_dirty_npages;
         size_t writemap_spilled_npages;
       };
+      struct {
+        size_t spilled, unspilled;
+      } spill_stat; /* see MDBX_txn_info and MDBX_opt_spill_policy */
       void *preserve_parent_userctx;
       /* In write txns, next is located the array of cursors for each DB */
     } wr;
@@ -1255,12 +1287,20 @@ struct MDBX_env {
     uint8_t spill_parent4child_denominator;
     uint16_t merge_threshold_dot16;
     uint16_t split_reserve_dot16;
+    uint16_t defrag_auto_threshold_dot16; /* see MDBX_opt_defrag_auto_threshold */
+    uint32_t defrag_auto_time_limit_dot16;
+    unsigned defrag_auto_batch;
+    uint8_t page_checksum;
+    uint8_t spill_policy;           /* see MDBX_opt_spill_policy */
+    uint32_t hotmap_interval_dot16; /* see MDBX_opt_hotmap_interval */
 #if !(defined(_WIN32) || defined(_WIN64))
     unsigned writethrough_threshold;
 #endif /* Windows */
     bool prefault_write;
     bool prefer_waf_insteadof_balance; /* Strive to minimize WAF instead of
                                           balancing pages fullment */
+    bool group_commit;                 /* see MDBX_opt_group_commit */
+    bool gc_adaptive;                  /* see MDBX_opt_gc_adaptive */
     bool need_dp_limit_adjust;
     struct {
       uint16_t limit;
@@ -1291,6 +1331,16 @@ struct MDBX_env {
     size_t shrink; /* threshold to shrink datafile */
   } geo_in_bytes;
 
+  struct {                      /* page checksums, see MDBX_opt_page_checksum */
+    osal_mmap_t map;            /* mapped checksums file */
+    size_t capacity;            /* number of entries */
+    mdbx_atomic_uint64_t *seen; /* cache of already verified pages */
+    bool writer;                /* checksums are maintained by this process */
+    bool verify;                /* pages are verified when accessed */
+    bool dirty;                 /* checksums are updated but not flushed yet */
+    bool incomplete;            /* some pages were written without checksums */
+  } pgsum;
+
 #if MDBX_LOCKING == MDBX_LOCKING_SYSV
   union {
     key_t key;
@@ -1324,9 +1374,46 @@ struct MDBX_env {
   MDBX_txn *txn; /* current write transaction */
   struct {
     txnid_t detent;
+    /* see MDBX_opt_gc_adaptive */
+    txnid_t drain_edge;    /* the backlog of GC records to drain by FIFO */
+    txnid_t fifo_progress; /* the most recent GC record reclaimed by FIFO */
+    size_t backlog_base;   /* the backlog left after draining */
+    unsigned fifo_penalty; /* txns to use FIFO due to expensive LIFO rescans */
+    bool draining;
   } gc;
   osal_fastmutex_t dbi_lock;
-  unsigned n_dbi; /* number of DBs opened */
+  osal_fastmutex_t group_sync_lock; /* see MDBX_opt_group_commit */
+  unsigned n_dbi;                   /* number of DBs opened */
+
+  struct { /* background sync thread, see mdbx_txn_commit_async() */
+    osal_condpair_t condpair;
+    osal_thread_t thread;
+    txnid_t pending; /* the most recent txnid awaiting for durability */
+    bool running, stop;
+    MDBX_durable_notify_func *notify;
+    void *notify_ctx;
+  } flusher;
+
+  struct { /* background defragmentation, see MDBX_opt_defrag_auto_threshold */
+    osal_condpair_t condpair;
+    osal_thread_t thread;
+    mdbx_atomic_uint32_t writers_waiting; /* in-process writers waiting for the lock */
+    bool running, stop, pending;
+  } defragger;
+
+  struct { /* periodic saving of the hot-page map, see MDBX_opt_hotmap_interval */
+    osal_condpair_t condpair;
+    osal_thread_t thread;
+    mdbx_mode_t mode; /* file permissions passed to mdbx_env_open() */
+    bool running, stop;
+  } hotmap;
+
+  struct { /* see mdbx_env_set_commit_stream() */
+    MDBX_commit_stream_func *func;
+    void *ctx;
+    mdbx_filehandle_t fd;
+    uint8_t *buffer;
+  } stream;
 
   unsigned shadow_reserve_len;
   page_t *__restrict shadow_reserve; /* list of malloc'ed blocks for re-use */
@@ -1455,6 +1542,7 @@ enum resize_mode { implicit_grow, impilict_shrink, explicit_resize };
 MDBX_INTERNAL int __must_check_result dxb_resize(MDBX_env *const env, const pgno_t used_pgno, const pgno_t size_pgno,
                                                  pgno_t limit_pgno, const enum resize_mode mode);
 MDBX_INTERNAL int dxb_set_readahead(const MDBX_env *env, const pgno_t edge, const bool enable, const bool force_whole);
+MDBX_INTERNAL void dxb_prefetch(const MDBX_env *env, const pgno_t pgno, const size_t npages);
 MDBX_INTERNAL int dxb_msync(const MDBX_env *env, size_t length_pages, enum osal_syncmode_bits mode_bits);
 MDBX_INTERNAL int dxb_fsync(const MDBX_env *env, enum osal_syncmode_bits mode_bits);
 MDBX_INTERNAL int __must_check_result dxb_sync_locked(MDBX_env *env, unsigned flags, meta_t *const pending,
@@ -1472,6 +1560,7 @@ struct commit_timestamp {
   uint64_t start, prep, gc, audit, write, sync, gc_cpu;
 };
 MDBX_INTERNAL pgop_stat_t *txn_latency_gcprof(const MDBX_env *env, MDBX_commit_latency *latency);
+MDBX_INTERNAL void txn_latency_gcpolicy(const MDBX_txn *txn, MDBX_commit_latency *latency);
 
 MDBX_INTERNAL bool txn_refund(MDBX_txn *txn);
 MDBX_INTERNAL bool txn_gc_detent(const MDBX_txn *const txn);
@@ -1481,7 +1570,8 @@ MDBX_INTERNAL int txn_shadow_cursors(const MDBX_txn *parent, const size_t dbi);
 
 MDBX_INTERNAL MDBX_txn *txn_alloc(const unsigned flags, MDBX_env *env);
 MDBX_INTERNAL int txn_abort(MDBX_txn *txn, MDBX_commit_latency *latency);
-MDBX_INTERNAL int txn_commit(MDBX_txn *txn, MDBX_commit_latency *latency, struct commit_timestamp *ts);
+MDBX_INTERNAL int txn_commit(MDBX_txn *txn, MDBX_commit_latency *latency, struct commit_timestamp *ts,
+                             txnid_t *async);
 #if !(defined(_WIN32) || defined(_WIN64))
 MDBX_INTERNAL void txn_abort_after_resurrect(MDBX_txn *txn);
 #endif /* Windows */
@@ -1515,11 +1605,30 @@ MDBX_INTERNAL void txn_ro_free(MDBX_txn *txn);
 MDBX_INTERNAL int env_open(MDBX_env *env, mdbx_mode_t mode);
 MDBX_INTERNAL int env_info(const MDBX_env *env, const MDBX_txn *txn, MDBX_envinfo *out, troika_t *troika);
 MDBX_INTERNAL int env_sync(MDBX_env *env, bool force, bool nonblock);
+MDBX_INTERNAL int env_group_sync(MDBX_env *env, txnid_t txnid);
+MDBX_INTERNAL int env_flusher_kick(MDBX_env *env, txnid_t txnid);
+MDBX_INTERNAL void env_flusher_stop(MDBX_env *env);
+#if !(defined(_WIN32) || defined(_WIN64))
+MDBX_INTERNAL void env_flusher_afterfork(MDBX_env *env);
+#endif /* !Windows */
+MDBX_INTERNAL void env_defragger_kick(MDBX_env *env);
+MDBX_INTERNAL void env_defragger_stop(MDBX_env *env);
+#if !(defined(_WIN32) || defined(_WIN64))
+MDBX_INTERNAL void env_defragger_afterfork(MDBX_env *env);
+#endif /* !Windows */
+MDBX_INTERNAL void env_hotmap_start(MDBX_env *env);
+MDBX_INTERNAL void env_hotmap_stop(MDBX_env *env, bool save);
+#if !(defined(_WIN32) || defined(_WIN64))
+MDBX_INTERNAL void env_hotmap_afterfork(MDBX_env *env);
+#endif /* !Windows */
 MDBX_INTERNAL int env_close(MDBX_env *env, bool resurrect_after_fork);
 MDBX_INTERNAL MDBX_txn *env_owned_wrtxn(const MDBX_env *env);
 MDBX_INTERNAL int __must_check_result env_page_auxbuffer(MDBX_env *env);
 MDBX_INTERNAL unsigned env_setup_pagesize(MDBX_env *env, const size_t pagesize);
 MDBX_INTERNAL bool env_is_page_incore(MDBX_env *const env, pgno_t pgno);
+#if MDBX_USE_MINCORE
+MDBX_INTERNAL int mincore_probe(const MDBX_env *env, size_t offset, size_t length, uint8_t *vector);
+#endif /* MDBX_USE_MINCORE */
 MDBX_INTERNAL void env_clear_incore_cache(const MDBX_env *const env);
 
 MDBX_INTERNAL void env_options_init(MDBX_env *env);
@@ -1532,6 +1641,7 @@ MDBX_INTERNAL int tree_deepen_lowest(MDBX_cursor *mc);
 MDBX_INTERNAL intptr_t tree_diff_level(const MDBX_cursor *left, const MDBX_cursor *right);
 MDBX_INTERNAL size_t tree_search_branch_configure(const MDBX_cursor *mc, const MDBX_val *key);
 MDBX_INTERNAL sfr_t tree_search_foliage_configure(MDBX_cursor *mc, const MDBX_val *key);
+MDBX_INTERNAL void tree_search_ctor(void);
 
 enum page_search_flags {
   Z_MODIFY = 1,
@@ -1577,6 +1687,33 @@ MDBX_INTERNAL int coherency_check_written(const MDBX_env *env, const txnid_t txn
                                           const intptr_t pgno, uint64_t *timestamp);
 MDBX_INTERNAL int coherency_timeout(uint64_t *timestamp, intptr_t pgno, const MDBX_env *env);
 
+/* copy.c */
+MDBX_INTERNAL void copy_commit_stream(MDBX_env *env, MDBX_txn *txn, const meta_t *base, const meta_t *committed);
+
+static inline bool copy_commit_streaming(const MDBX_env *env) {
+  return env->stream.func || env->stream.fd != INVALID_HANDLE_VALUE;
+}
+
+/* pgsum.c */
+MDBX_INTERNAL void pgsum_ctor(void);
+MDBX_INTERNAL pathchar_t *pgsum_pathname(const pathchar_t *dxb_pathname);
+MDBX_INTERNAL int pgsum_open(MDBX_env *env, const mdbx_mode_t mode_bits);
+MDBX_INTERNAL void pgsum_close(MDBX_env *env);
+MDBX_INTERNAL int pgsum_txn_begin(MDBX_env *env, const meta_ptr_t head, const txnid_t txnid);
+MDBX_INTERNAL void pgsum_txn_committed(MDBX_env *env, const txnid_t head, const txnid_t committed);
+MDBX_INTERNAL int pgsum_sync(MDBX_env *env);
+MDBX_INTERNAL void pgsum_update(MDBX_env *env, const page_t *dp, const size_t npages);
+MDBX_INTERNAL int pgsum_verify(const MDBX_txn *txn, const page_t *mp);
+
+static inline int pgsum_check(const MDBX_txn *txn, const page_t *mp) {
+  return likely(!txn->env->pgsum.verify) ? MDBX_SUCCESS : pgsum_verify(txn, mp);
+}
+
+/* hotmap.c */
+MDBX_INTERNAL pathchar_t *hotmap_pathname(const pathchar_t *lck_pathname);
+MDBX_INTERNAL int hotmap_save(MDBX_env *env);
+MDBX_INTERNAL int hotmap_load(const MDBX_env *env, const meta_t *meta, hotmap_header_t **pmap);
+
 /* histogram.c */
 #define HISTOGRAM_LE0 1
 MDBX_INTERNAL void histogram_acc_ex(const size_t value, struct MDBX_chk_histogram *histogram, unsigned options);
@@ -2582,8 +2719,12 @@ enum cursor_state {
      игнорироваться. */
   z_after_delete = 0x08,
 
-  /* */
-  z_disable_tree_search_fastpath = 0x10,
+  /* Курсор используется для серии поисков по ключам (см. mdbx_get_many()),
+     поэтому tree_search() может подниматься по стеку курсора только до
+     ближайшей общей страницы-предка, вместо спуска от корня. Флажок
+     устанавливается явно перед каждым поиском и сбрасывается при любом
+     последующем позиционировании курсора. */
+  z_tree_search_fastpath = 0x10,
 
   /* Курсор логически в конце данных, но физически на последней строке,
      ki[top] == page_numkeys(pg[top]) - 1 и может читать данные в текущей позиции. */
@@ -2601,7 +2742,7 @@ enum cursor_state {
 
   /* Маски для сброса/установки состояния. */
   z_clear_mask = z_inner | z_gcu_preparation,
-  z_poor_mark = z_eof_hard | z_hollow | z_disable_tree_search_fastpath,
+  z_poor_mark = z_eof_hard | z_hollow,
   z_fresh_mark = z_poor_mark | z_fresh
 };
 
@@ -2817,6 +2958,9 @@ MDBX_INTERNAL int __must_check_result cursor_put_checklen(MDBX_cursor *mc, const
 
 MDBX_INTERNAL int __must_check_result cursor_put(MDBX_cursor *mc, const MDBX_val *key, MDBX_val *data, unsigned flags);
 
+MDBX_INTERNAL int __must_check_result cursor_bulk_load(MDBX_cursor *mc, MDBX_bulk_load_func source, void *context,
+                                                       unsigned fill_percent);
+
 MDBX_INTERNAL int __must_check_result cursor_validate_updating(MDBX_cursor *mc);
 
 MDBX_INTERNAL int __must_check_result cursor_del(MDBX_cursor *mc, unsigned flags);
@@ -3005,12 +3149,24 @@ MDBX_INTERNAL int __must_check_result txn_dpl_append(MDBX_txn *txn, pgno_t pgno,
 
 MDBX_MAYBE_UNUSED MDBX_INTERNAL bool txn_dpl_check(MDBX_txn *txn);
 
+/* Старший бит LRU-метки используется как CLOCK-подобный признак повторного обращения к грязной странице,
+ * см. MDBX_spill_clock. Сами метки не превышают UINT32_MAX / 3, поэтому этот бит всегда свободен. */
+#define DPL_LRU_REFBIT UINT32_C(0x80000000)
+
 MDBX_NOTHROW_PURE_FUNCTION static inline uint32_t txn_dpl_age(const MDBX_txn *txn, size_t i) {
   cASSERT0(txn, (txn->flags & (txn_ro_both | MDBX_WRITEMAP)) == 0);
   const dpl_t *dl = txn->wr.dirtylist;
   ASSERT((intptr_t)i > 0 && i <= dl->length);
   size_t *const ptr = ptr_disp(dl->items[i].ptr, -(ptrdiff_t)sizeof(size_t));
-  return txn->wr.dirtylru - (uint32_t)*ptr;
+  return txn->wr.dirtylru - ((uint32_t)*ptr & ~DPL_LRU_REFBIT);
+}
+
+MDBX_NOTHROW_PURE_FUNCTION static inline bool txn_dpl_referenced(const MDBX_txn *txn, size_t i) {
+  cASSERT0(txn, (txn->flags & (txn_ro_both | MDBX_WRITEMAP)) == 0);
+  const dpl_t *dl = txn->wr.dirtylist;
+  ASSERT((intptr_t)i > 0 && i <= dl->length);
+  size_t *const ptr = ptr_disp(dl->items[i].ptr, -(ptrdiff_t)sizeof(size_t));
+  return (*ptr & DPL_LRU_REFBIT) != 0;
 }
 
 MDBX_INTERNAL void txn_dpl_lru_reduce(MDBX_txn *txn);
@@ -3117,6 +3273,7 @@ MDBX_INTERNAL void gc_put_destroy(gcu_t *ctx);
 #define ALLOC_EXACTLY 32
 
 MDBX_INTERNAL pgr_t gc_alloc_ex(const MDBX_cursor *const mc, const size_t num, uint8_t flags);
+MDBX_INTERNAL void gc_policy_setup(MDBX_txn *txn);
 
 MDBX_INTERNAL pgr_t gc_alloc_single(const MDBX_cursor *const mc);
 MDBX_INTERNAL int gc_update(MDBX_txn *txn, gcu_t *ctx);
@@ -3212,6 +3369,10 @@ MDBX_INTERNAL int defrag_init(dfc_t *dfc, MDBX_txn *txn, size_t defrag_atleast_p
 MDBX_INTERNAL void defrag_destroy(dfc_t *dfc);
 MDBX_INTERNAL int defrag_cycle(dfc_t *dfc);
 MDBX_INTERNAL void defrag_milestone(dfc_t *dfc);
+MDBX_INTERNAL int env_defrag(MDBX_env *env, bool dont_wait, size_t defrag_atleast, size_t time_atleast_dot16,
+                             size_t defrag_enough, size_t time_limit_dot16, intptr_t acceptable_backlash,
+                             intptr_t preferred_batch, MDBX_defrag_notify_func progress_callback, void *ctx,
+                             MDBX_defrag_result_t *result);
 
 MDBX_MAYBE_UNUSED static inline bool defrag_discontinued(const dfc_t *dfc) {
   return dfc->stopping_reasons >= MDBX_defrag_discontinued;
@@ -3404,7 +3565,7 @@ static inline bool meta_choice_steady(txnid_t a_txnid, bool a_steady, txnid_t b_
   return meta_cmp2steady(meta_cmp2int(a_txnid, b_txnid, 1), a_steady, b_steady);
 }
 
-MDBX_INTERNAL meta_t *meta_init_triplet(const MDBX_env *env, void *buffer);
+MDBX_INTERNAL meta_t *meta_init_triplet(const MDBX_env *env, void *buffer, const void *guid);
 
 MDBX_INTERNAL int meta_validate(MDBX_env *env, meta_t *const meta, const page_t *const page, const unsigned meta_number,
                                 unsigned *guess_pagesize);
@@ -3685,6 +3846,10 @@ typedef int walk_func(const size_t pgno, const unsigned number, void *const ctx,
 typedef enum walk_options { dont_check_keys_ordering = 1, dont_walk_GC = 2, dont_walk_MAIN = 4 } walk_options_t;
 
 MDBX_INTERNAL int walk_pages(MDBX_txn *txn, walk_func *visitor, void *user, walk_options_t options);
+MDBX_INTERNAL int walk_pages_parallel(MDBX_txn *txn, walk_func *visitor, void *const *users, const size_t threads,
+                                      walk_options_t options);
+
+typedef struct walk_parallel walk_parallel_t;
 
 typedef struct walk_ctx {
   void *userctx;
@@ -3693,6 +3858,7 @@ typedef struct walk_ctx {
   walk_func *visitor;
   MDBX_txn *txn;
   MDBX_cursor *cursor;
+  walk_parallel_t *par;
 } walk_ctx_t;
 
 MDBX_INTERNAL int walk_tbl(walk_ctx_t *ctx, walk_tbl_t *tbl, pgno_t parent_page);
@@ -4305,12 +4471,362 @@ static size_t estimate_rss(size_t database_bytes) {
   return database_bytes + database_bytes / 64 + (512 + MDBX_WORDBITS * 16) * MEGABYTE;
 }
 
+typedef struct warmup_ctx {
+  const MDBX_env *env;
+  MDBX_warmup_notify_func progress;
+  void *progress_ctx;
+  uint64_t timeout_monotime;
+  size_t total_pages, done_pages;
+  unsigned notified_percent, countdown;
+  pgno_t btree_limit;
+  int null_fd;
+  size_t used_range, chunk_bytes;
+  uint32_t chunks;
+  mdbx_atomic_uint32_t next_chunk, done_chunks, stop;
+} warmup_ctx_t;
+
+typedef struct warmup_worker {
+  osal_thread_t thread;
+  warmup_ctx_t *ctx;
+  int cpu;
+} warmup_worker_t;
+
+static inline bool warmup_stopped(const warmup_ctx_t *ctx) {
+  return atomic_load32(&ctx->stop, mo_Relaxed) != MDBX_SUCCESS;
+}
+
+static inline void warmup_stop(warmup_ctx_t *ctx, int rc) {
+  /* сохраняем только первую причину останова */
+  atomic_cas32(&ctx->stop, MDBX_SUCCESS, (uint32_t)rc);
+}
+
+static inline bool warmup_timeout(const warmup_ctx_t *ctx) {
+  return ctx->timeout_monotime && osal_monotime() > ctx->timeout_monotime;
+}
+
+/* Проходы по branch-страницам и по карте "горячих" страниц предшествуют полному просмотру и затрагивают часть того же
+ * используемого диапазона, поэтому при MDBX_warmup_force прогресс считается от общего итога по наиболее продвинутому. */
+static size_t warmup_done(const warmup_ctx_t *ctx) {
+  size_t done_bytes = atomic_load32(&ctx->done_chunks, mo_AcquireRelease) * ctx->chunk_bytes;
+  if (done_bytes > ctx->used_range)
+    done_bytes = ctx->used_range;
+  const size_t swept_pages = bytes2pgno(ctx->env, done_bytes);
+  return (ctx->done_pages > swept_pages) ? ctx->done_pages : swept_pages;
+}
+
+/* Уведомление о прогрессе, вызывается только из потока вызвавшего mdbx_env_warmup_ex(),
+ * не чаще одного раза на каждый процент, за исключением начала и окончания. */
+static void warmup_notify(warmup_ctx_t *ctx, bool always) {
+  if (ctx->progress) {
+    size_t done = warmup_done(ctx);
+    if (done > ctx->total_pages)
+      done = ctx->total_pages;
+    const unsigned percent = ctx->total_pages ? (unsigned)(done * 100 / ctx->total_pages) : 100;
+    if (always || percent != ctx->notified_percent) {
+      ctx->notified_percent = percent;
+      if (ctx->progress(ctx->progress_ctx, done, ctx->total_pages))
+        warmup_stop(ctx, MDBX_RESULT_TRUE);
+    }
+  }
+}
+
+static int warmup_peek(const warmup_ctx_t *ctx, size_t offset, const size_t end) {
+  const volatile uint8_t *const ptr = ctx->env->dxb_mmap.base;
+#if !(defined(_WIN32) || defined(_WIN64))
+  if (ctx->null_fd >= 0) {
+    struct iovec iov[MDBX_AUXILARY_IOV_MAX];
+    while (offset < end) {
+      unsigned i;
+      for (i = 0; i < MDBX_AUXILARY_IOV_MAX && offset < end; ++i) {
+        iov[i].iov_base = (void *)(ptr + offset);
+        iov[i].iov_len = 1;
+        offset += globals.sys_pagesize;
+      }
+      if (unlikely(writev(ctx->null_fd, iov, i) < 0)) {
+        const int err = errno;
+        return (err == EFAULT) ? ENOMEM : err;
+      }
+    }
+    return MDBX_SUCCESS;
+  }
+#endif /* Windows */
+
+  size_t unused = 42;
+  for (; offset < end; offset += globals.sys_pagesize)
+    unused += ptr[offset];
+  (void)unused;
+  return MDBX_SUCCESS;
+}
+
+static void warmup_sweep(warmup_ctx_t *ctx, const bool is_caller) {
+  while (!warmup_stopped(ctx)) {
+    const uint32_t chunk = atomic_load32(&ctx->next_chunk, mo_Relaxed);
+    if (chunk >= ctx->chunks)
+      break;
+    if (!atomic_cas32(&ctx->next_chunk, chunk, chunk + 1))
+      continue;
+
+    const size_t offset = chunk * ctx->chunk_bytes;
+    const size_t end = (ctx->used_range - offset > ctx->chunk_bytes) ? offset + ctx->chunk_bytes : ctx->used_range;
+    int err = warmup_peek(ctx, offset, end);
+    if (err == MDBX_SUCCESS && warmup_timeout(ctx))
+      err = MDBX_RESULT_TRUE;
+    if (unlikely(err != MDBX_SUCCESS)) {
+      warmup_stop(ctx, err);
+      break;
+    }
+
+    uint32_t done;
+    do
+      done = atomic_load32(&ctx->done_chunks, mo_Relaxed);
+    while (!atomic_cas32(&ctx->done_chunks, done, done + 1));
+    if (is_caller)
+      warmup_notify(ctx, false);
+  }
+}
+
+__cold static THREAD_RESULT THREAD_CALL warmup_worker(void *arg) {
+  warmup_worker_t *const worker = arg;
+#if defined(__linux__) || defined(__gnu_linux__)
+  if (worker->cpu >= 0) {
+    /* При политике "first touch" страницы будут размещены в памяти NUMA-узла соответствующего процессора,
+     * поэтому ошибки здесь не критичны и игнорируются. */
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(worker->cpu, &set);
+    (void)sched_setaffinity(0, sizeof(set), &set);
+  }
+#endif /* Linux */
+  warmup_sweep(worker->ctx, false);
+  return (THREAD_RESULT)0;
+}
+
+__cold static int warmup_parallel(warmup_ctx_t *ctx, const bool numa) {
+  const unsigned cpus = osal_cpu_count();
+  size_t workers = ((cpus < MDBX_WARMUP_MAXTHREADS) ? cpus : MDBX_WARMUP_MAXTHREADS) - 1;
+  if (workers >= ctx->chunks)
+    workers = ctx->chunks - 1;
+  warmup_worker_t *const pool = workers ? osal_calloc(workers, sizeof(warmup_worker_t)) : nullptr;
+  if (unlikely(workers && !pool))
+    return MDBX_ENOMEM;
+
+#if defined(__linux__) || defined(__gnu_linux__)
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  const size_t allowed_count = (numa && sched_getaffinity(0, sizeof(allowed), &allowed) == 0) ? CPU_COUNT(&allowed) : 0;
+#else
+  (void)numa;
+#endif /* Linux */
+
+  size_t started = 0;
+  for (; started < workers; ++started) {
+    warmup_worker_t *const worker = pool + started;
+    worker->ctx = ctx;
+    worker->cpu = -1;
+#if defined(__linux__) || defined(__gnu_linux__)
+    if (allowed_count) {
+      /* равномерно распределяем потоки по всем доступным процессорам */
+      size_t nth = (started + 1) * allowed_count / (workers + 1);
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        if (CPU_ISSET(cpu, &allowed) && nth-- == 0) {
+          worker->cpu = cpu;
+          break;
+        }
+    }
+#endif /* Linux */
+    int err = osal_thread_create(&worker->thread, warmup_worker, worker);
+    if (unlikely(err != MDBX_SUCCESS)) {
+      WARNING("unable to start warmup worker #%zu, err %d", started, err);
+      break;
+    }
+  }
+
+  warmup_sweep(ctx, true);
+
+  int rc = MDBX_SUCCESS;
+  for (size_t i = 0; i < started; ++i) {
+    int err = osal_thread_join(pool[i].thread);
+    if (unlikely(err != MDBX_SUCCESS) && rc == MDBX_SUCCESS)
+      rc = err;
+  }
+  osal_free(pool);
+  return rc;
+}
+
+static pgno_t warmup_child(const MDBX_env *env, const page_t *mp, size_t i) {
+  const size_t offset = mp->entries[i];
+  if (unlikely(offset < mp->upper || offset > env->ps - PAGEHDRSZ - NODESIZE))
+    return 0;
+  return node_pgno(page_node(mp, i));
+}
+
+/* Обход только branch-страниц, т.е. без листьев, которые загружаются последующим полным просмотром.
+ * Обход выполняется "по возможности", поэтому всё некорректное просто пропускается. */
+static void warmup_branch(warmup_ctx_t *ctx, const pgno_t pgno, const size_t height) {
+  const MDBX_env *const env = ctx->env;
+  if (unlikely(pgno < NUM_METAS || pgno >= ctx->btree_limit) || warmup_stopped(ctx))
+    return;
+
+  const page_t *const mp = pgno2page(env, pgno);
+  if (unlikely(mp->pgno != pgno || !is_branch(mp) || mp->lower > mp->upper ||
+               PAGEHDRSZ + (size_t)mp->upper > env->ps))
+    return;
+
+  ctx->done_pages += 1;
+  if ((++ctx->countdown & 63) == 0) {
+    if (warmup_timeout(ctx)) {
+      warmup_stop(ctx, MDBX_RESULT_TRUE);
+      return;
+    }
+    warmup_notify(ctx, false);
+  }
+
+  if (height > 2) {
+    const size_t nkeys = page_numkeys(mp);
+    for (size_t i = 0; i < nkeys; ++i) {
+      const pgno_t child = warmup_child(env, mp, i);
+      if (child >= NUM_METAS && child < ctx->btree_limit)
+        dxb_prefetch(env, child, 1);
+    }
+    for (size_t i = 0; i < nkeys; ++i)
+      warmup_branch(ctx, warmup_child(env, mp, i), height - 1);
+  }
+}
+
+static size_t warmup_hotmap_seek(const uint64_t *bitmap, size_t unit, const size_t units, const bool hot) {
+  const uint64_t skip = hot ? 0 : ~UINT64_C(0);
+  while (unit < units) {
+    if ((unit & 63) == 0 && bitmap[unit / 64] == skip)
+      unit += 64;
+    else if (((bitmap[unit / 64] >> (unit & 63)) & 1) == hot)
+      return unit;
+    else
+      unit += 1;
+  }
+  return units;
+}
+
+/* Порция начинается с "горячего" юнита и включает последующие, пока промежутки между ними не превышают gap. */
+static size_t warmup_hotmap_batch(const uint64_t *bitmap, const size_t begin, const size_t units, const size_t batch,
+                                  const size_t gap) {
+  const size_t limit = (units - begin > batch) ? begin + batch : units;
+  size_t end = begin;
+  while (end < limit) {
+    const size_t run_end = warmup_hotmap_seek(bitmap, end, limit, false);
+    const size_t next = warmup_hotmap_seek(bitmap, run_end, limit, true);
+    end = run_end;
+    if (next >= limit || next - run_end > gap)
+      break;
+    end = next;
+  }
+  return end;
+}
+
+/* Загрузка только "горячих" страниц в порядке их расположения в файле. Порции до 4 Мб, включая короткие
+ * "холодные" промежутки, заранее анонсируются ядру для упреждающего чтения, пока загружается предыдущая. */
+__cold static int warmup_hotmap(warmup_ctx_t *ctx, const hotmap_header_t *map, const size_t units) {
+  const MDBX_env *const env = ctx->env;
+  const uint64_t *const bitmap = (const uint64_t *)(map + 1);
+  const unsigned unit_ln2 = map->unit_ln2;
+  const size_t unit_pages = (size_t)1 << (unit_ln2 - env->ps2ln);
+  const size_t batch = (MEGABYTE * 4) >> unit_ln2;
+  const size_t gap = (MEGABYTE / 8) >> unit_ln2;
+
+  size_t next_begin = warmup_hotmap_seek(bitmap, 0, units, true);
+  size_t next_end = (next_begin < units) ? warmup_hotmap_batch(bitmap, next_begin, units, batch, gap) : units;
+  if (next_begin < units)
+    dxb_prefetch(env, (pgno_t)(next_begin * unit_pages), (next_end - next_begin) * unit_pages);
+
+  while (next_begin < units && !warmup_stopped(ctx)) {
+    const size_t begin = next_begin, end = next_end;
+    next_begin = warmup_hotmap_seek(bitmap, end, units, true);
+    if (next_begin < units) {
+      next_end = warmup_hotmap_batch(bitmap, next_begin, units, batch, gap);
+      dxb_prefetch(env, (pgno_t)(next_begin * unit_pages), (next_end - next_begin) * unit_pages);
+    }
+
+    for (size_t unit = begin; unit < end;) {
+      const size_t run_end = warmup_hotmap_seek(bitmap, unit, end, false);
+      int err = warmup_peek(ctx, unit << unit_ln2, run_end << unit_ln2);
+      if (unlikely(err != MDBX_SUCCESS))
+        return err;
+      ctx->done_pages += (run_end - unit) * unit_pages;
+      unit = warmup_hotmap_seek(bitmap, run_end, end, true);
+    }
+
+    if (warmup_timeout(ctx))
+      warmup_stop(ctx, MDBX_RESULT_TRUE);
+    else
+      warmup_notify(ctx, false);
+  }
+  return MDBX_SUCCESS;
+}
+
+typedef const tree_t *warmup_tree_t;
+#define WARMUP_TREE_SORT_CMP(first, last) ((first)->mod_txnid > (last)->mod_txnid)
+SORT_IMPL(warmup_tree_sort, false, warmup_tree_t, WARMUP_TREE_SORT_CMP)
+
+__cold static int warmup_btree(warmup_ctx_t *ctx, const MDBX_txn *txn) {
+  MDBX_txn *walker = (MDBX_txn *)txn;
+  if (!walker) {
+    int err = mdbx_txn_begin_ex((MDBX_env *)ctx->env, nullptr, MDBX_TXN_RDONLY, &walker, nullptr);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+  }
+
+  /* все открытые в среде DBI-дескрипторы, включая ещё не использованные в транзакции */
+  const size_t n_dbi = ctx->env->n_dbi;
+  warmup_tree_t *const trees = osal_malloc(n_dbi * sizeof(warmup_tree_t));
+  int rc = trees ? MDBX_SUCCESS : MDBX_ENOMEM;
+  if (likely(rc == MDBX_SUCCESS)) {
+    size_t n = 0;
+    trees[n++] = &walker->dbs[FREE_DBI];
+    trees[n++] = &walker->dbs[MAIN_DBI];
+    for (size_t dbi = CORE_DBS; dbi < n_dbi; ++dbi)
+      if (dbi_check(walker, dbi) == MDBX_SUCCESS &&
+          ((walker->dbi_state[dbi] & DBI_STALE) == 0 || tbl_refresh(walker, dbi) == MDBX_SUCCESS) &&
+          walker->dbs[dbi].height > 1)
+        trees[n++] = &walker->dbs[dbi];
+    if (n > CORE_DBS + 1)
+      warmup_tree_sort(trees + CORE_DBS, trees + n);
+
+    const size_t mapped_pgno = bytes2pgno(ctx->env, ctx->env->dxb_mmap.current);
+    ctx->btree_limit =
+        (walker->geo.first_unallocated < mapped_pgno) ? walker->geo.first_unallocated : (pgno_t)mapped_pgno;
+    size_t branch_pages = 0;
+    for (size_t i = 0; i < n; ++i)
+      branch_pages += trees[i]->branch_pages;
+    if (!ctx->chunks)
+      ctx->total_pages += branch_pages;
+    warmup_notify(ctx, true);
+    for (size_t i = 0; i < n && !warmup_stopped(ctx); ++i)
+      if (trees[i]->height > 1 && trees[i]->height <= CURSOR_STACK_SIZE)
+        warmup_branch(ctx, trees[i]->root, trees[i]->height);
+
+    if (!warmup_stopped(ctx))
+      /* учитываем в прогрессе ожидаемое количество, даже если часть страниц была пропущена */
+      ctx->done_pages = branch_pages;
+    osal_free(trees);
+  }
+
+  if (walker != txn)
+    mdbx_txn_abort(walker);
+  return rc;
+}
+
 __cold int mdbx_env_warmup(const MDBX_env *env, const MDBX_txn *txn, MDBX_warmup_flags_t flags,
                            unsigned timeout_seconds_16dot16) {
+  return mdbx_env_warmup_ex(env, txn, flags, timeout_seconds_16dot16, nullptr, nullptr);
+}
+
+__cold int mdbx_env_warmup_ex(const MDBX_env *env, const MDBX_txn *txn, MDBX_warmup_flags_t flags,
+                              unsigned timeout_seconds_16dot16, MDBX_warmup_notify_func progress_callback,
+                              void *ctx) {
   if (unlikely(env == nullptr && txn == nullptr))
     return LOG_IFERR(MDBX_EINVAL);
   if (unlikely(flags > (MDBX_warmup_force | MDBX_warmup_oomsafe | MDBX_warmup_lock | MDBX_warmup_touchlimit |
-                        MDBX_warmup_release)))
+                        MDBX_warmup_release | MDBX_warmup_parallel | MDBX_warmup_numa | MDBX_warmup_btree |
+                        MDBX_warmup_hotmap)))
     return LOG_IFERR(MDBX_EINVAL);
 
   if (txn) {
@@ -4328,7 +4844,8 @@ __cold int mdbx_env_warmup(const MDBX_env *env, const MDBX_txn *txn, MDBX_warmup
     env = txn->env;
   }
 
-  const uint64_t timeout_monotime = (timeout_seconds_16dot16 && (flags & MDBX_warmup_force))
+  const uint64_t timeout_monotime =
+      (timeout_seconds_16dot16 && (flags & (MDBX_warmup_force | MDBX_warmup_btree | MDBX_warmup_hotmap)))
                                         ? osal_monotime() + osal_16dot16_to_monotime(timeout_seconds_16dot16)
                                         : 0;
 
@@ -4413,55 +4930,73 @@ __cold int mdbx_env_warmup(const MDBX_env *env, const MDBX_txn *txn, MDBX_warmup
   if (err != MDBX_SUCCESS && rc == MDBX_SUCCESS)
     rc = err;
 
-  if ((flags & MDBX_warmup_force) != 0 && (rc == MDBX_SUCCESS || rc == MDBX_ENOSYS)) {
-    const volatile uint8_t *ptr = env->dxb_mmap.base;
-    size_t offset = 0, unused = 42;
+  if ((flags & (MDBX_warmup_force | MDBX_warmup_btree | MDBX_warmup_hotmap)) != 0 &&
+      (rc == MDBX_SUCCESS || rc == MDBX_ENOSYS)) {
+    warmup_ctx_t warmup;
+    memset(&warmup, 0, sizeof(warmup));
+    warmup.env = env;
+    warmup.progress = progress_callback;
+    warmup.progress_ctx = ctx;
+    warmup.timeout_monotime = timeout_monotime;
+    warmup.null_fd = -1;
+    if (flags & MDBX_warmup_force) {
+      warmup.used_range = used_range;
+      warmup.chunk_bytes = ceil_powerof2(MEGABYTE * 2, globals.sys_pagesize);
+      warmup.chunks = (uint32_t)((used_range + warmup.chunk_bytes - 1) / warmup.chunk_bytes);
+      warmup.total_pages = bytes2pgno(env, used_range);
+    }
+
+    rc = MDBX_SUCCESS;
+    hotmap_header_t *hotmap = nullptr;
+    size_t hotmap_units = 0;
+    if (flags & MDBX_warmup_hotmap) {
+      const troika_t troika = meta_tap(env);
+      rc = hotmap_load(env, meta_recent(env, &troika).ptr_c, &hotmap);
+      if (rc == MDBX_SUCCESS) {
+        hotmap_units = used_range >> hotmap->unit_ln2;
+        if (hotmap_units > hotmap->units)
+          hotmap_units = (size_t)hotmap->units;
+        if (!warmup.chunks)
+          warmup.total_pages += (size_t)hotmap->hot << (hotmap->unit_ln2 - env->ps2ln);
+      } else if (rc == MDBX_ENODATA && (flags & MDBX_warmup_force))
+        rc = MDBX_SUCCESS;
+    }
+
+    if (rc == MDBX_SUCCESS) {
+      if (flags & MDBX_warmup_btree)
+        rc = warmup_btree(&warmup, txn);
+      else
+        warmup_notify(&warmup, true);
+    }
+
 #if !(defined(_WIN32) || defined(_WIN64))
-    if (flags & MDBX_warmup_oomsafe) {
-      const int null_fd = open("/dev/null", O_WRONLY);
-      if (unlikely(null_fd < 0))
+    if ((flags & MDBX_warmup_oomsafe) && (warmup.chunks || hotmap) && rc == MDBX_SUCCESS) {
+      warmup.null_fd = open("/dev/null", O_WRONLY);
+      if (unlikely(warmup.null_fd < 0))
         rc = errno;
-      else {
-        struct iovec iov[MDBX_AUXILARY_IOV_MAX];
-        for (;;) {
-          unsigned i;
-          for (i = 0; i < MDBX_AUXILARY_IOV_MAX && offset < used_range; ++i) {
-            iov[i].iov_base = (void *)(ptr + offset);
-            iov[i].iov_len = 1;
-            offset += globals.sys_pagesize;
-          }
-          if (unlikely(writev(null_fd, iov, i) < 0)) {
-            rc = errno;
-            if (rc == EFAULT)
-              rc = ENOMEM;
-            break;
-          }
-          if (offset >= used_range) {
-            rc = MDBX_SUCCESS;
-            break;
-          }
-          if (timeout_seconds_16dot16 && osal_monotime() > timeout_monotime) {
-            rc = MDBX_RESULT_TRUE;
-            break;
-          }
-        }
-        close(null_fd);
-      }
-    } else
+    }
 #endif /* Windows */
-      for (;;) {
-        unused += ptr[offset];
-        offset += globals.sys_pagesize;
-        if (offset >= used_range) {
-          rc = MDBX_SUCCESS;
-          break;
-        }
-        if (timeout_seconds_16dot16 && osal_monotime() > timeout_monotime) {
-          rc = MDBX_RESULT_TRUE;
-          break;
-        }
-      }
-    (void)unused;
+
+    if (rc == MDBX_SUCCESS && hotmap)
+      rc = warmup_hotmap(&warmup, hotmap, hotmap_units);
+    osal_free(hotmap);
+
+    if (rc == MDBX_SUCCESS && warmup.chunks) {
+      if ((flags & MDBX_warmup_parallel) && warmup.chunks > 1)
+        rc = warmup_parallel(&warmup, (flags & MDBX_warmup_numa) != 0);
+      else
+        warmup_sweep(&warmup, true);
+    }
+
+#if !(defined(_WIN32) || defined(_WIN64))
+    if (warmup.null_fd >= 0)
+      close(warmup.null_fd);
+#endif /* Windows */
+    if (rc == MDBX_SUCCESS) {
+      rc = (int)atomic_load32(&warmup.stop, mo_AcquireRelease);
+      if (rc == MDBX_SUCCESS)
+        warmup_notify(&warmup, true);
+    }
   }
 
   if ((flags & MDBX_warmup_lock) != 0 && (rc == MDBX_SUCCESS || rc == MDBX_ENOSYS) &&
@@ -4719,9 +5254,14 @@ typedef struct compacting_context {
    * to fail the copy.  Not mutex-protected, expects atomic int. */
   volatile int error;
   mdbx_filehandle_t fd;
+  /* For parallel mode: the shared state of workers,
+   * and the position of write_buf[0] within the destination file. */
+  struct compacting_parallel *par;
+  uint64_t write_offset;
 } ctx_t;
 
 __cold static int compacting_walk_tree(ctx_t *ctx, tree_t *tree);
+__cold static int compacting_delegate(ctx_t *ctx, tree_t *tree);
 
 /* Dedicated writer thread for compacting copy. */
 __cold static THREAD_RESULT THREAD_CALL compacting_write_thread(void *arg) {
@@ -4774,6 +5314,17 @@ bailout:
   return (THREAD_RESULT)0;
 }
 
+/* Write the buffer directly at the corresponding position, for parallel mode. */
+__cold static int compacting_flush(ctx_t *ctx) {
+  const size_t bytes = ctx->write_len[0];
+  if (bytes == 0)
+    return MDBX_SUCCESS;
+  ctx->write_len[0] = 0;
+  int err = osal_pwrite(ctx->fd, ctx->write_buf[0], bytes, ctx->write_offset);
+  ctx->write_offset += bytes;
+  return err;
+}
+
 /* Give buffer and/or MDBX_EOF to writer thread, await unused buffer. */
 __cold static int compacting_toggle_write_buffers(ctx_t *ctx) {
   osal_condpair_lock(&ctx->condpair);
@@ -4799,7 +5350,7 @@ static int compacting_put_bytes(ctx_t *ctx, const void *src, size_t bytes, pgno_
     const size_t side = ctx->head & 1;
     const size_t left = MDBX_ENVCOPY_WRITEBUF - ctx->write_len[side];
     if (left < (pgno ? PAGEHDRSZ : 1)) {
-      int err = compacting_toggle_write_buffers(ctx);
+      int err = ctx->par ? compacting_flush(ctx) : compacting_toggle_write_buffers(ctx);
       if (unlikely(err != MDBX_SUCCESS))
         return err;
       continue;
@@ -4841,6 +5392,13 @@ static int compacting_put_page(ctx_t *ctx, const page_t *mp, const size_t head_b
 
   const pgno_t pgno = ctx->first_unallocated;
   ctx->first_unallocated += npages;
+  if (ctx->par && pgno2bytes(ctx->env, pgno) != ctx->write_offset + ctx->write_len[0]) {
+    /* the page follows a range which is delegated to another worker */
+    int err = compacting_flush(ctx);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+    ctx->write_offset = pgno2bytes(ctx->env, pgno);
+  }
   int err = compacting_put_bytes(ctx, mp, head_bytes, pgno, npages);
   if (unlikely(err != MDBX_SUCCESS))
     return err;
@@ -4929,7 +5487,7 @@ __cold static int compacting_walk(ctx_t *ctx, MDBX_cursor *mc, pgno_t *const par
               cursor_couple_t *couple = container_of(mc, cursor_couple_t, outer);
               nested = &couple->inner.nested_tree;
               memcpy(nested, node_data(node), sizeof(tree_t));
-              rc = compacting_walk_tree(ctx, nested);
+              rc = ctx->par ? compacting_delegate(ctx, nested) : compacting_walk_tree(ctx, nested);
             }
             if (unlikely(rc != MDBX_SUCCESS))
               goto bailout;
@@ -5007,6 +5565,525 @@ __cold static int compacting_walk_tree(ctx_t *ctx, tree_t *tree) {
   return compacting_walk(ctx, &couple.outer, &tree->root, tree->mod_txnid);
 }
 
+/* Parallel compacting copy.
+ *
+ * Since the pages are renumbered sequentially in the post-order of walking, the output of any subtree occupies
+ * a contiguous range of pages, the last of which is the root of subtree. Thus, once the number of pages within
+ * a subtree is known, it could be compacted independently and written directly at the corresponding position.
+ *
+ * For the nested tables the page counts are known from the tree_t records, so such tables are delegated to
+ * other workers while walking the parent b-tree. The large b-trees are split at top levels until there are
+ * enough subtrees for all workers, which are counted first and then compacted by workers in parallel, while
+ * the pages of the top levels are written by the worker finishing the counting. */
+
+typedef struct compacting_job compacting_job_t;
+typedef struct compacting_split compacting_split_t;
+
+struct compacting_job {
+  compacting_job_t *next;
+  /* A copy of the tree_t record with the original root. */
+  tree_t tree;
+  /* Where to store the new root, only for the MAIN table. */
+  tree_t *target;
+  pgno_t base;
+  /* The number of pages, zero if unknown. */
+  pgno_t expected;
+};
+
+struct compacting_split {
+  compacting_split_t *next;
+  /* The next split at the same level of the same b-tree. */
+  compacting_split_t *chain;
+  compacting_split_t *parent;
+  compacting_job_t *job;
+  size_t index, depth, nkeys, pending;
+  /* Per child: the nested split, if the child is split further. */
+  compacting_split_t **nested;
+  /* Per child: the number of pages within the child's subtree. */
+  pgno_t *counts;
+  page_t *page;
+};
+
+typedef enum compacting_task_kind { ct_tree, ct_count, ct_walk } compacting_task_kind_t;
+
+typedef struct compacting_task {
+  struct compacting_task *next;
+  compacting_task_kind_t kind;
+  compacting_job_t *job;
+  compacting_split_t *split;
+  size_t index;
+  pgno_t pgno, base, expected;
+  txnid_t front;
+} compacting_task_t;
+
+typedef struct compacting_parallel {
+  osal_condpair_t condpair;
+  compacting_task_t *queue;
+  compacting_job_t *jobs;
+  compacting_split_t *splits;
+  size_t pending, workers;
+  pgno_t threshold;
+  pgno_t main_used;
+  int error;
+  bool stop;
+} compacting_parallel_t;
+
+/* Sets the error and drops queued tasks, must be called under the lock. */
+__cold static void compacting_par_error(compacting_parallel_t *par, int err) {
+  if (!par->error) {
+    par->error = err;
+    while (par->queue) {
+      compacting_task_t *const task = par->queue;
+      par->queue = task->next;
+      osal_free(task);
+      par->pending -= 1;
+    }
+    if (par->pending == 0)
+      osal_condpair_signal(&par->condpair, true);
+  }
+}
+
+__cold static int compacting_enqueue(compacting_parallel_t *par, compacting_task_kind_t kind, compacting_job_t *job,
+                                     compacting_split_t *split, size_t index, pgno_t pgno, txnid_t front, pgno_t base,
+                                     pgno_t expected) {
+  compacting_task_t *const task = osal_malloc(sizeof(compacting_task_t));
+  if (unlikely(!task))
+    return MDBX_ENOMEM;
+  task->kind = kind;
+  task->job = job;
+  task->split = split;
+  task->index = index;
+  task->pgno = pgno;
+  task->front = front;
+  task->base = base;
+  task->expected = expected;
+
+  osal_condpair_lock(&par->condpair);
+  const int err = par->error;
+  if (likely(err == MDBX_SUCCESS)) {
+    task->next = par->queue;
+    par->queue = task;
+    par->pending += 1;
+    osal_condpair_signal(&par->condpair, false);
+  }
+  osal_condpair_unlock(&par->condpair);
+  if (unlikely(err != MDBX_SUCCESS))
+    osal_free(task);
+  return err;
+}
+
+__cold static int compacting_add_job(compacting_parallel_t *par, const tree_t *tree, tree_t *target, pgno_t base,
+                                     pgno_t expected) {
+  compacting_job_t *const job = osal_malloc(sizeof(compacting_job_t));
+  if (unlikely(!job))
+    return MDBX_ENOMEM;
+  job->tree = *tree;
+  job->target = target;
+  job->base = base;
+  job->expected = expected;
+  osal_condpair_lock(&par->condpair);
+  job->next = par->jobs;
+  par->jobs = job;
+  osal_condpair_unlock(&par->condpair);
+  return compacting_enqueue(par, ct_tree, job, nullptr, 0, tree->root, tree->mod_txnid, base, expected);
+}
+
+/* Reserves the range of pages for a large enough nested table and delegates it to other workers. */
+__cold static int compacting_delegate(ctx_t *ctx, tree_t *tree) {
+  const pgno_t npages = tree->branch_pages + tree->leaf_pages + tree->large_pages;
+  if (npages < ctx->par->threshold)
+    return compacting_walk_tree(ctx, tree);
+
+  if (!tree->mod_txnid)
+    tree->mod_txnid = ctx->txn->txnid;
+  const pgno_t base = ctx->first_unallocated;
+  if (unlikely(npages > MAX_PAGENO - base))
+    return MDBX_CORRUPTED;
+  int err = compacting_add_job(ctx->par, tree, nullptr, base, npages);
+  if (likely(err == MDBX_SUCCESS)) {
+    ctx->first_unallocated = base + npages;
+    tree->root = base + npages - 1;
+  }
+  return err;
+}
+
+__cold static int compacting_cursor(ctx_t *ctx, cursor_couple_t *couple, kvx_t *kvx, tree_t *tree) {
+  memset(couple, 0, sizeof(cursor_couple_t));
+  couple->inner.cursor.signature = ~cur_signature_live;
+  memset(kvx, 0, sizeof(kvx_t));
+  kvx->clc.k.lmin = kvx->clc.v.lmin = INT_MAX;
+  int rc = cursor_init4walk(couple, ctx->txn, tree, kvx);
+  if (likely(rc == MDBX_SUCCESS)) {
+    couple->outer.checking |= z_ignord | z_pagecheck;
+    couple->inner.cursor.checking |= z_ignord | z_pagecheck;
+  }
+  return rc;
+}
+
+/* Compacts the subtree at the given base, then checks the number of pages and flushes the output. */
+__cold static int compacting_walk_at(ctx_t *ctx, compacting_job_t *job, pgno_t *pgno, txnid_t front, pgno_t base,
+                                     pgno_t expected) {
+  tree_t tree = job->tree;
+  cursor_couple_t couple;
+  kvx_t kvx;
+  int rc = compacting_cursor(ctx, &couple, &kvx, &tree);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  ctx->first_unallocated = base;
+  ctx->write_offset = pgno2bytes(ctx->env, base);
+  ctx->write_len[0] = 0;
+  rc = compacting_walk(ctx, &couple.outer, pgno, front);
+  if (likely(rc == MDBX_SUCCESS) && expected &&
+      unlikely(ctx->first_unallocated != base + expected || *pgno != base + expected - 1)) {
+    ERROR("the source DB %s: %" PRIaPGNO " pages %s expected %" PRIaPGNO,
+          "has inconsistent page counts or other corruption", ctx->first_unallocated - base, "vs", expected);
+    rc = MDBX_CORRUPTED;
+  }
+  const int err = compacting_flush(ctx);
+  return (rc == MDBX_SUCCESS) ? err : rc;
+}
+
+/* Counts the number of output pages within a subtree. */
+__cold static int compacting_count(MDBX_cursor *mc, pgno_t pgno, txnid_t front, size_t depth, const bool leafless,
+                                   pgno_t *count) {
+  page_t *mp;
+  int rc = page_get(mc, pgno, &mp, front);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  *count += 1;
+  const size_t nkeys = page_numkeys(mp);
+  if (is_branch(mp)) {
+    if (leafless && depth + 2 == mc->tree->height)
+      /* all children are leaves without large or nested pages */
+      *count += (pgno_t)nkeys;
+    else
+      for (size_t i = 0; rc == MDBX_SUCCESS && i < nkeys; ++i)
+        rc = compacting_count(mc, node_pgno(page_node(mp, i)), mp->txnid, depth + 1, leafless, count);
+  } else if (!is_dupfix_leaf(mp)) {
+    for (size_t i = 0; i < nkeys; ++i) {
+      const node_t *const node = page_node(mp, i);
+      if (node_flags(node) == N_BIG)
+        *count += largechunk_npages(mc->txn->env, node_ds(node));
+      else if (node_flags(node) & N_TREE) {
+        if (!MDBX_DISABLE_VALIDATION && unlikely(node_ds(node) != sizeof(tree_t)))
+          return MDBX_CORRUPTED;
+        tree_t nested;
+        memcpy(&nested, node_data(node), sizeof(tree_t));
+        *count += nested.branch_pages + nested.leaf_pages + nested.large_pages;
+      }
+    }
+  }
+  return rc;
+}
+
+__cold static int compacting_split_create(ctx_t *ctx, compacting_job_t *job, compacting_split_t *parent, size_t index,
+                                          const page_t *mp, compacting_split_t **psplit) {
+  const size_t nkeys = page_numkeys(mp);
+  const size_t head = ceil_powerof2(sizeof(compacting_split_t) + nkeys * sizeof(compacting_split_t *) +
+                                        nkeys * sizeof(pgno_t),
+                                    sizeof(uint64_t));
+  compacting_split_t *const split = osal_calloc(1, head + ctx->env->ps);
+  if (unlikely(!split))
+    return MDBX_ENOMEM;
+  split->parent = parent;
+  split->job = job;
+  split->index = index;
+  split->depth = parent ? parent->depth + 1 : 0;
+  split->nkeys = split->pending = nkeys;
+  split->nested = ptr_disp(split, sizeof(compacting_split_t));
+  split->counts = ptr_disp(split->nested, nkeys * sizeof(compacting_split_t *));
+  split->page = ptr_disp(split, head);
+  page_copy(split->page, mp, ctx->env->ps);
+  if (parent)
+    parent->nested[index] = split;
+
+  compacting_parallel_t *const par = ctx->par;
+  osal_condpair_lock(&par->condpair);
+  split->next = par->splits;
+  par->splits = split;
+  osal_condpair_unlock(&par->condpair);
+  *psplit = split;
+  return MDBX_SUCCESS;
+}
+
+/* Assigns the output page numbers to subtrees of the split, delegates ones to workers
+ * and writes the page of the split itself. */
+__cold static int compacting_layout(ctx_t *ctx, compacting_split_t *split, const pgno_t base, pgno_t *pgno) {
+  pgno_t next = base;
+  for (size_t i = 0; i < split->nkeys; ++i) {
+    node_t *const node = page_node(split->page, i);
+    pgno_t child;
+    if (split->nested[i]) {
+      int err = compacting_layout(ctx, split->nested[i], next, &child);
+      if (unlikely(err != MDBX_SUCCESS))
+        return err;
+    } else {
+      if (unlikely(split->counts[i] > MAX_PAGENO - next))
+        return MDBX_CORRUPTED;
+      int err = compacting_enqueue(ctx->par, ct_walk, split->job, split, i, node_pgno(node), split->page->txnid, next,
+                                   split->counts[i]);
+      if (unlikely(err != MDBX_SUCCESS))
+        return err;
+      child = next + split->counts[i] - 1;
+    }
+    node_set_pgno(node, child);
+    next = child + 1;
+  }
+
+  ctx->first_unallocated = next;
+  *pgno = next;
+  return compacting_put_page(ctx, split->page, PAGEHDRSZ + split->page->lower,
+                             ctx->env->ps - (PAGEHDRSZ + split->page->upper), 1);
+}
+
+/* Finishes the job after all subtrees of the top split have been counted. */
+__cold static int compacting_layout_job(ctx_t *ctx, compacting_job_t *job, compacting_split_t *top) {
+  ctx->write_len[0] = 0;
+  pgno_t root;
+  int rc = compacting_layout(ctx, top, job->base, &root);
+  const int err = compacting_flush(ctx);
+  if (likely(rc == MDBX_SUCCESS))
+    rc = err;
+  if (likely(rc == MDBX_SUCCESS)) {
+    const pgno_t used = root + 1 - job->base;
+    if (job->target) {
+      job->target->root = root;
+      ctx->par->main_used = used;
+    } else if (unlikely(used != job->expected)) {
+      ERROR("the source DB %s: %" PRIaPGNO " pages %s expected %" PRIaPGNO,
+            "has inconsistent page counts or other corruption", used, "vs", job->expected);
+      rc = MDBX_CORRUPTED;
+    }
+  }
+  return rc;
+}
+
+/* Either compacts a whole b-tree, or splits it at top levels for counting subtrees by workers. */
+__cold static int compacting_tree(ctx_t *ctx, compacting_job_t *job) {
+  compacting_parallel_t *const par = ctx->par;
+  tree_t tree = job->tree;
+  cursor_couple_t couple;
+  kvx_t kvx;
+  int rc = compacting_cursor(ctx, &couple, &kvx, &tree);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  page_t *mp;
+  rc = page_get(&couple.outer, tree.root, &mp, tree.mod_txnid);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  if (!is_branch(mp) || tree.branch_pages + tree.leaf_pages + tree.large_pages < par->threshold * 4) {
+    pgno_t root = tree.root;
+    rc = compacting_walk_at(ctx, job, &root, tree.mod_txnid, job->base, job->expected);
+    if (likely(rc == MDBX_SUCCESS) && job->target) {
+      job->target->root = root;
+      par->main_used = ctx->first_unallocated - job->base;
+    }
+    return rc;
+  }
+
+  compacting_split_t *top;
+  rc = compacting_split_create(ctx, job, nullptr, 0, mp, &top);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  /* Split level by level until there are enough subtrees for all workers. */
+  compacting_split_t *level = top;
+  for (size_t width = top->nkeys; width < par->workers * 4 && level->depth + 3 < tree.height;) {
+    compacting_split_t *next_level = nullptr, **tail = &next_level;
+    width = 0;
+    for (compacting_split_t *split = level; split; split = split->chain)
+      for (size_t i = 0; i < split->nkeys; ++i) {
+        rc = page_get(&couple.outer, node_pgno(page_node(split->page, i)), &mp, split->page->txnid);
+        if (unlikely(rc != MDBX_SUCCESS))
+          return rc;
+        if (!MDBX_DISABLE_VALIDATION && unlikely(!is_branch(mp)))
+          return MDBX_CORRUPTED;
+        compacting_split_t *nested;
+        rc = compacting_split_create(ctx, job, split, i, mp, &nested);
+        if (unlikely(rc != MDBX_SUCCESS))
+          return rc;
+        *tail = nested;
+        tail = &nested->chain;
+        width += nested->nkeys;
+      }
+    level = next_level;
+  }
+
+  for (compacting_split_t *split = level; split; split = split->chain)
+    for (size_t i = 0; i < split->nkeys; ++i) {
+      rc = compacting_enqueue(par, ct_count, job, split, i, node_pgno(page_node(split->page, i)), split->page->txnid, 0,
+                              0);
+      if (unlikely(rc != MDBX_SUCCESS))
+        return rc;
+    }
+  return MDBX_SUCCESS;
+}
+
+__cold static int compacting_run(ctx_t *ctx, compacting_task_t *task) {
+  compacting_parallel_t *const par = ctx->par;
+  compacting_job_t *const job = task->job;
+  switch (task->kind) {
+  case ct_tree:
+    return compacting_tree(ctx, job);
+  case ct_walk:
+    return compacting_walk_at(ctx, job, &task->pgno, task->front, task->base, task->expected);
+  default:
+    break;
+  }
+
+  tree_t tree = job->tree;
+  cursor_couple_t couple;
+  kvx_t kvx;
+  int rc = compacting_cursor(ctx, &couple, &kvx, &tree);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  /* the leaves could be skipped only for b-tree without large and nested pages */
+  const bool leafless = !job->target && !(tree.flags & MDBX_DUPSORT) && !tree.large_pages;
+  pgno_t count = 0;
+  compacting_split_t *split = task->split;
+  rc = compacting_count(&couple.outer, task->pgno, task->front, split->depth + 1, leafless, &count);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  osal_condpair_lock(&par->condpair);
+  split->counts[task->index] = count;
+  bool complete = false;
+  while (--split->pending == 0) {
+    if (!split->parent) {
+      complete = true;
+      break;
+    }
+    uint64_t total = 1;
+    for (size_t i = 0; i < split->nkeys; ++i)
+      total += split->counts[i];
+    split->parent->counts[split->index] = (total < MAX_PAGENO) ? (pgno_t)total : MAX_PAGENO;
+    split = split->parent;
+  }
+  osal_condpair_unlock(&par->condpair);
+  return complete ? compacting_layout_job(ctx, job, split) : MDBX_SUCCESS;
+}
+
+__cold static THREAD_RESULT THREAD_CALL compacting_worker(void *arg) {
+  ctx_t *const ctx = arg;
+  compacting_parallel_t *const par = ctx->par;
+  osal_condpair_lock(&par->condpair);
+  while (true) {
+    while (!par->queue && !par->stop) {
+      int err = osal_condpair_wait(&par->condpair, false);
+      if (unlikely(err != MDBX_SUCCESS)) {
+        compacting_par_error(par, err);
+        goto bailout;
+      }
+    }
+    if (par->stop)
+      break;
+
+    compacting_task_t *const task = par->queue;
+    par->queue = task->next;
+    if (par->queue)
+      /* wake up one more worker */
+      osal_condpair_signal(&par->condpair, false);
+    osal_condpair_unlock(&par->condpair);
+    int rc = compacting_run(ctx, task);
+    osal_free(task);
+    osal_condpair_lock(&par->condpair);
+    if (unlikely(rc != MDBX_SUCCESS))
+      compacting_par_error(par, rc);
+    if (--par->pending == 0)
+      osal_condpair_signal(&par->condpair, true);
+  }
+
+bailout:
+  /* pass the wake up to other workers */
+  osal_condpair_signal(&par->condpair, false);
+  osal_condpair_unlock(&par->condpair);
+  return (THREAD_RESULT)0;
+}
+
+__cold static int compacting_parallel(MDBX_env *env, MDBX_txn *txn, mdbx_filehandle_t fd, tree_t *main,
+                                      pgno_t *used) {
+  tASSERT0(txn, (txn->flags & (txn_ro_flat | MDBX_TXN_BLOCKED)) == txn_ro_flat);
+  compacting_parallel_t par;
+  memset(&par, 0, sizeof(par));
+  int rc = osal_condpair_init(&par.condpair);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  const unsigned cpus = osal_cpu_count();
+  par.workers = (cpus < MDBX_ENVCOPY_MAXTHREADS) ? cpus : MDBX_ENVCOPY_MAXTHREADS;
+  par.threshold = bytes2pgno(env, MDBX_ENVCOPY_WRITEBUF);
+  ctx_t *const ctxs = osal_calloc(par.workers, sizeof(ctx_t));
+  osal_thread_t *const threads = osal_calloc(par.workers, sizeof(osal_thread_t));
+  uint8_t *buffers = nullptr;
+  rc = (ctxs && threads) ? osal_memalign_alloc(globals.sys_pagesize, par.workers * (size_t)MDBX_ENVCOPY_WRITEBUF,
+                                               (void **)&buffers)
+                         : MDBX_ENOMEM;
+
+  if (!main->mod_txnid)
+    main->mod_txnid = txn->txnid;
+  if (likely(rc == MDBX_SUCCESS))
+    rc = compacting_add_job(&par, main, main, NUM_METAS, 0);
+
+  size_t started = 0;
+  while (rc == MDBX_SUCCESS && started < par.workers) {
+    ctx_t *const ctx = ctxs + started;
+    ctx->env = env;
+    ctx->txn = txn;
+    ctx->fd = fd;
+    ctx->par = &par;
+    ctx->write_buf[0] = buffers + started * (size_t)MDBX_ENVCOPY_WRITEBUF;
+    rc = osal_thread_create(threads + started, compacting_worker, ctx);
+    if (likely(rc == MDBX_SUCCESS))
+      started += 1;
+    else if (started) {
+      WARNING("unable to start compacting worker #%zu, err %d", started, rc);
+      rc = MDBX_SUCCESS;
+      break;
+    }
+  }
+
+  osal_condpair_lock(&par.condpair);
+  if (unlikely(rc != MDBX_SUCCESS))
+    compacting_par_error(&par, rc);
+  while (par.pending && started) {
+    int err = osal_condpair_wait(&par.condpair, true);
+    if (unlikely(err != MDBX_SUCCESS))
+      compacting_par_error(&par, err);
+  }
+  par.stop = true;
+  osal_condpair_signal(&par.condpair, false);
+  osal_condpair_unlock(&par.condpair);
+
+  for (size_t i = 0; i < started; ++i) {
+    int err = osal_thread_join(threads[i]);
+    if (unlikely(err != MDBX_SUCCESS) && !par.error)
+      par.error = err;
+  }
+  osal_condpair_destroy(&par.condpair);
+
+  *used = NUM_METAS + par.main_used;
+  while (par.jobs) {
+    compacting_job_t *const job = par.jobs;
+    par.jobs = job->next;
+    osal_free(job);
+  }
+  while (par.splits) {
+    compacting_split_t *const split = par.splits;
+    par.splits = split->next;
+    osal_free(split);
+  }
+  if (buffers)
+    osal_memalign_free(buffers);
+  osal_free(threads);
+  osal_free(ctxs);
+  return par.error;
+}
+
 __cold static void compacting_fixup_meta(MDBX_env *env, meta_t *meta) {
   eASSERT0(env, meta->trees.gc.mod_txnid || meta->trees.gc.root == P_INVALID);
   eASSERT0(env, meta->trees.main.mod_txnid || meta->trees.main.root == P_INVALID);
@@ -5045,11 +6122,33 @@ __cold static void meta_make_sizeable(meta_t *meta) {
   }
 }
 
+/* Checks the number of pages used after compactification against the expected one. */
+__cold static int compacting_check_used(meta_t *meta, const pgno_t used, const bool dest_is_pipe) {
+  int rc = MDBX_SUCCESS;
+  if (unlikely(meta->geometry.first_unallocated != used)) {
+    if (used > meta->geometry.first_unallocated) {
+      ERROR("the source DB %s: post-compactification used pages %" PRIaPGNO " %c expected %" PRIaPGNO,
+            "has double-used pages or other corruption", used, '>', meta->geometry.first_unallocated);
+      rc = MDBX_CORRUPTED; /* corrupted DB */
+    }
+    if (used < meta->geometry.first_unallocated) {
+      WARNING("the source DB %s: post-compactification used pages %" PRIaPGNO " %c expected %" PRIaPGNO,
+              "has page leak(s)", used, '<', meta->geometry.first_unallocated);
+      if (dest_is_pipe)
+        /* the root within already written meta-pages is wrong */
+        rc = MDBX_CORRUPTED;
+    }
+    /* fixup meta */
+    meta->geometry.first_unallocated = used;
+  }
+  return rc;
+}
+
 __cold static int copy_with_compacting(MDBX_env *env, MDBX_txn *txn, mdbx_filehandle_t fd, uint8_t *buffer,
                                        const bool dest_is_pipe, const MDBX_copy_flags_t flags) {
   const size_t meta_bytes = pgno2bytes(env, NUM_METAS);
   uint8_t *const data_buffer = buffer + ceil_powerof2(meta_bytes, globals.sys_pagesize);
-  meta_t *const meta = meta_init_triplet(env, buffer);
+  meta_t *const meta = meta_init_triplet(env, buffer, nullptr);
   meta_set_txnid(env, meta, txn->txnid);
 
   if (flags & MDBX_CP_FORCE_DYNAMIC_SIZE)
@@ -5103,73 +6202,70 @@ __cold static int copy_with_compacting(MDBX_env *env, MDBX_txn *txn, mdbx_fileha
     meta->geometry.first_unallocated = txn->geo.first_unallocated - gc_npages;
     meta->trees.main = txn->dbs[MAIN_DBI];
 
-    ctx_t ctx;
-    memset(&ctx, 0, sizeof(ctx));
-    rc = osal_condpair_init(&ctx.condpair);
-    if (unlikely(rc != MDBX_SUCCESS))
-      return rc;
-
-    memset(data_buffer, 0, 2 * (size_t)MDBX_ENVCOPY_WRITEBUF);
-    ctx.write_buf[0] = data_buffer;
-    ctx.write_buf[1] = data_buffer + (size_t)MDBX_ENVCOPY_WRITEBUF;
-    ctx.first_unallocated = NUM_METAS;
-    ctx.env = env;
-    ctx.fd = fd;
-    ctx.txn = txn;
-    ctx.flags = flags;
-
-    osal_thread_t thread;
-    int thread_err = osal_thread_create(&thread, compacting_write_thread, &ctx);
-    if (likely(thread_err == MDBX_SUCCESS)) {
-      if (dest_is_pipe) {
-        if (!meta->trees.main.mod_txnid)
-          meta->trees.main.mod_txnid = txn->txnid;
-        compacting_fixup_meta(env, meta);
-        if (flags & MDBX_CP_THROTTLE_MVCC)
-          mdbx_txn_park(txn, false);
-        rc = osal_write(fd, buffer, meta_bytes);
-        if (likely(rc == MDBX_SUCCESS) && (flags & MDBX_CP_THROTTLE_MVCC) != 0)
-          rc = mdbx_txn_unpark(txn, false);
-      }
+    /* The workers share the txn, therefore only a read-only txn is suitable,
+     * since the page lookup within a write txn depends on its mutable state. */
+    if ((flags & MDBX_CP_PARALLEL) && !dest_is_pipe && (txn->flags & txn_ro_flat)) {
+      pgno_t used = NUM_METAS;
+      rc = compacting_parallel(env, txn, fd, &meta->trees.main, &used);
       if (likely(rc == MDBX_SUCCESS))
-        rc = compacting_walk_tree(&ctx, &meta->trees.main);
-      if (ctx.write_len[ctx.head & 1])
-        /* toggle to flush non-empty buffers */
-        compacting_toggle_write_buffers(&ctx);
+        rc = compacting_check_used(meta, used, false);
+      if (unlikely(rc != MDBX_SUCCESS))
+        return rc;
+      compacting_fixup_meta(env, meta);
+    } else {
+      ctx_t ctx;
+      memset(&ctx, 0, sizeof(ctx));
+      rc = osal_condpair_init(&ctx.condpair);
+      if (unlikely(rc != MDBX_SUCCESS))
+        return rc;
 
-      if (likely(rc == MDBX_SUCCESS) && unlikely(meta->geometry.first_unallocated != ctx.first_unallocated)) {
-        if (ctx.first_unallocated > meta->geometry.first_unallocated) {
-          ERROR("the source DB %s: post-compactification used pages %" PRIaPGNO " %c expected %" PRIaPGNO,
-                "has double-used pages or other corruption", ctx.first_unallocated, '>',
-                meta->geometry.first_unallocated);
-          rc = MDBX_CORRUPTED; /* corrupted DB */
-        }
-        if (ctx.first_unallocated < meta->geometry.first_unallocated) {
-          WARNING("the source DB %s: post-compactification used pages %" PRIaPGNO " %c expected %" PRIaPGNO,
-                  "has page leak(s)", ctx.first_unallocated, '<', meta->geometry.first_unallocated);
-          if (dest_is_pipe)
-            /* the root within already written meta-pages is wrong */
-            rc = MDBX_CORRUPTED;
+      memset(data_buffer, 0, 2 * (size_t)MDBX_ENVCOPY_WRITEBUF);
+      ctx.write_buf[0] = data_buffer;
+      ctx.write_buf[1] = data_buffer + (size_t)MDBX_ENVCOPY_WRITEBUF;
+      ctx.first_unallocated = NUM_METAS;
+      ctx.env = env;
+      ctx.fd = fd;
+      ctx.txn = txn;
+      ctx.flags = flags;
+
+      osal_thread_t thread;
+      int thread_err = osal_thread_create(&thread, compacting_write_thread, &ctx);
+      if (likely(thread_err == MDBX_SUCCESS)) {
+        if (dest_is_pipe) {
+          if (!meta->trees.main.mod_txnid)
+            meta->trees.main.mod_txnid = txn->txnid;
+          compacting_fixup_meta(env, meta);
+          if (flags & MDBX_CP_THROTTLE_MVCC)
+            mdbx_txn_park(txn, false);
+          rc = osal_write(fd, buffer, meta_bytes);
+          if (likely(rc == MDBX_SUCCESS) && (flags & MDBX_CP_THROTTLE_MVCC) != 0)
+            rc = mdbx_txn_unpark(txn, false);
         }
-        /* fixup meta */
-        meta->geometry.first_unallocated = ctx.first_unallocated;
-      }
+        if (likely(rc == MDBX_SUCCESS))
+          rc = compacting_walk_tree(&ctx, &meta->trees.main);
+        if (ctx.write_len[ctx.head & 1])
+          /* toggle to flush non-empty buffers */
+          compacting_toggle_write_buffers(&ctx);
 
-      /* toggle with empty buffers to exit thread's loop */
-      eASSERT0(env, (ctx.write_len[ctx.head & 1]) == 0);
-      compacting_toggle_write_buffers(&ctx);
-      thread_err = osal_thread_join(thread);
-      eASSERT0(env, (ctx.tail == ctx.head && ctx.write_len[ctx.head & 1] == 0) || ctx.error);
-      osal_condpair_destroy(&ctx.condpair);
+        if (likely(rc == MDBX_SUCCESS))
+          rc = compacting_check_used(meta, ctx.first_unallocated, dest_is_pipe);
+
+        /* toggle with empty buffers to exit thread's loop */
+        eASSERT0(env, (ctx.write_len[ctx.head & 1]) == 0);
+        compacting_toggle_write_buffers(&ctx);
+        thread_err = osal_thread_join(thread);
+        eASSERT0(env, (ctx.tail == ctx.head && ctx.write_len[ctx.head & 1] == 0) || ctx.error);
+        osal_condpair_destroy(&ctx.condpair);
+      }
+      if (unlikely(thread_err != MDBX_SUCCESS))
+        return thread_err;
+      if (unlikely(rc != MDBX_SUCCESS))
+        return rc;
+      if (unlikely(ctx.error != MDBX_SUCCESS))
+        return ctx.error;
+      if (!dest_is_pipe)
+        compacting_fixup_meta(env, meta);
     }
-    if (unlikely(thread_err != MDBX_SUCCESS))
-      return thread_err;
-    if (unlikely(rc != MDBX_SUCCESS))
-      return rc;
-    if (unlikely(ctx.error != MDBX_SUCCESS))
-      return ctx.error;
-    if (!dest_is_pipe)
-      compacting_fixup_meta(env, meta);
   }
 
   if (flags & MDBX_CP_THROTTLE_MVCC)
@@ -5197,12 +6293,15 @@ __cold static int copy_with_compacting(MDBX_env *env, MDBX_txn *txn, mdbx_fileha
 
 //----------------------------------------------------------------------------
 
-__cold static int copy_asis(MDBX_env *env, MDBX_txn *txn, mdbx_filehandle_t fd, uint8_t *buffer,
-                            const bool dest_is_pipe, const MDBX_copy_flags_t flags) {
-  const size_t meta_bytes = pgno2bytes(env, NUM_METAS);
-  uint8_t *const data_buffer = buffer + ceil_powerof2(meta_bytes, globals.sys_pagesize);
-  meta_t *const meta = meta_init_triplet(env, buffer);
+/* Fills the meta-pages triplet for an as-is copy of the snapshot. */
+__cold static meta_t *copy_asis_meta(MDBX_env *env, MDBX_txn *txn, uint8_t *buffer, const MDBX_copy_flags_t flags) {
+  /* The as-is copy is the same database page-by-page, so it keeps the GUID,
+   * which is checked when applying incremental copies. */
+  meta_t *const meta = meta_init_triplet(env, buffer, &METAPAGE(env, 0)->dxbid);
   meta_set_txnid(env, meta, txn->txnid);
+  meta->geometry = txn->geo;
+  meta->trees.gc = txn->dbs[FREE_DBI];
+  meta->trees.main = txn->dbs[MAIN_DBI];
 
   if (flags & MDBX_CP_FORCE_DYNAMIC_SIZE)
     meta_make_sizeable(meta);
@@ -5213,6 +6312,16 @@ __cold static int copy_asis(MDBX_env *env, MDBX_txn *txn, mdbx_filehandle_t fd,
     meta->canary.v = constmeta_txnid(meta);
   }
 
+  meta_sign_as_steady(meta);
+  return meta;
+}
+
+__cold static int copy_asis(MDBX_env *env, MDBX_txn *txn, mdbx_filehandle_t fd, uint8_t *buffer,
+                            const bool dest_is_pipe, const MDBX_copy_flags_t flags) {
+  const size_t meta_bytes = pgno2bytes(env, NUM_METAS);
+  uint8_t *const data_buffer = buffer + ceil_powerof2(meta_bytes, globals.sys_pagesize);
+  copy_asis_meta(env, txn, buffer, flags);
+
   int rc = MDBX_SUCCESS;
   if (flags & MDBX_CP_THROTTLE_MVCC) {
     rc = mdbx_txn_park(txn, false);
@@ -5578,6 +6687,457 @@ __cold int mdbx_env_copyW(MDBX_env *env, const wchar_t *dest_path, MDBX_copy_fla
   return LOG_IFERR(rc);
 }
 
+//----------------------------------------------------------------------------
+
+typedef struct incremental_ctx {
+  MDBX_env *env;
+  /* The destination, either the callback or the file. */
+  MDBX_commit_stream_func *func;
+  void *func_ctx;
+  mdbx_filehandle_t fd;
+  txnid_t since, txnid;
+  uint32_t flags;
+  /* The meta-page of the base snapshot, if it is still available. */
+  const meta_t *base;
+  /* The meta-pages triplet followed by the write buffer. */
+  uint8_t *metas, *buffer;
+  size_t length;
+} incremental_ctx_t;
+
+static inline size_t incremental_bufsize(const MDBX_env *env) {
+  return ceil_powerof2(pgno2bytes(env, NUM_METAS), globals.sys_pagesize) + (size_t)MDBX_ENVCOPY_WRITEBUF;
+}
+
+static inline void incremental_setbuf(incremental_ctx_t *ctx, uint8_t *buffer) {
+  ctx->metas = buffer;
+  ctx->buffer = buffer + ceil_powerof2(pgno2bytes(ctx->env, NUM_METAS), globals.sys_pagesize);
+  ctx->length = 0;
+}
+
+__cold static int incremental_flush(incremental_ctx_t *ctx) {
+  int err = MDBX_SUCCESS;
+  if (ctx->length)
+    err = ctx->func ? ctx->func(ctx->env, ctx->func_ctx, ctx->txnid, ctx->buffer, ctx->length)
+                    : osal_write(ctx->fd, ctx->buffer, ctx->length);
+  ctx->length = 0;
+  return err;
+}
+
+__cold static int incremental_put(incremental_ctx_t *ctx, const void *src, size_t bytes) {
+  while (bytes) {
+    if (ctx->length == MDBX_ENVCOPY_WRITEBUF) {
+      int err = incremental_flush(ctx);
+      if (unlikely(err != MDBX_SUCCESS))
+        return err;
+    }
+    const size_t left = MDBX_ENVCOPY_WRITEBUF - ctx->length;
+    const size_t chunk = (bytes < left) ? bytes : left;
+    /* copy to avoid EFAULT in case swapped-out */
+    memcpy(ctx->buffer + ctx->length, src, chunk);
+    ctx->length += chunk;
+    src = ptr_disp(src, chunk);
+    bytes -= chunk;
+  }
+  return MDBX_SUCCESS;
+}
+
+__cold static int incremental_put_pages(incremental_ctx_t *ctx, const page_t *mp, pgno_t npages) {
+  const incremental_chunk_t chunk = {.pgno = mp->pgno, .npages = npages};
+  int err = incremental_put(ctx, &chunk, sizeof(chunk));
+  if (likely(err == MDBX_SUCCESS))
+    err = incremental_put(ctx, mp, pgno2bytes(ctx->env, npages));
+  return err;
+}
+
+/* Emits the pages of a b-tree changed after the base snapshot. Any change within a subtree produces a new copy
+ * of its root page, therefore a page not newer than the base one is skipped together with the whole subtree. */
+__cold static int incremental_walk(incremental_ctx_t *ctx, MDBX_cursor *mc, pgno_t pgno, txnid_t front) {
+  const pgr_t pg = page_get_three(mc, pgno, front);
+  if (unlikely(pg.err != MDBX_SUCCESS))
+    return pg.err;
+
+  const page_t *const mp = pg.page;
+  if (mp->txnid <= ctx->since)
+    return MDBX_SUCCESS;
+
+  int rc = incremental_put_pages(ctx, mp, 1);
+  const size_t nkeys = page_numkeys(mp);
+  if (is_branch(mp)) {
+    for (size_t i = 0; rc == MDBX_SUCCESS && i < nkeys; ++i)
+      rc = incremental_walk(ctx, mc, node_pgno(page_node(mp, i)), mp->txnid);
+  } else if (!is_dupfix_leaf(mp)) {
+    for (size_t i = 0; rc == MDBX_SUCCESS && i < nkeys; ++i) {
+      const node_t *const node = page_node(mp, i);
+      if (node_flags(node) == N_BIG) {
+        const pgr_t lp = page_get_large(mc, node_largedata_pgno(node), mp->txnid);
+        rc = lp.err;
+        if (likely(rc == MDBX_SUCCESS) && lp.page->txnid > ctx->since)
+          rc = incremental_put_pages(ctx, lp.page, lp.page->pages);
+      } else if (node_flags(node) & N_TREE) {
+        if (!MDBX_DISABLE_VALIDATION && unlikely(node_ds(node) != sizeof(tree_t))) {
+          ERROR("%s/%d: %s %u", "MDBX_CORRUPTED", MDBX_CORRUPTED, "invalid nested-tree node size",
+                (unsigned)node_ds(node));
+          return MDBX_CORRUPTED;
+        }
+        tree_t nested;
+        memcpy(&nested, node_data(node), sizeof(tree_t));
+        if (nested.root != P_INVALID)
+          rc = incremental_walk(ctx, mc, nested.root, mp->txnid);
+      }
+    }
+  }
+  return rc;
+}
+
+/* Emits the whole incremental stream of the snapshot of given transaction, for which the meta-pages triplet
+ * has already been prepared in ctx->metas. */
+__cold static int incremental_emit(incremental_ctx_t *ctx, MDBX_txn *txn) {
+  STATIC_ASSERT(sizeof(incremental_header_t) == 176);
+  incremental_header_t header;
+  memset(&header, 0, sizeof(header));
+  header.magic_and_version = MDBX_INCREMENTAL_MAGIC;
+  header.pagesize = (uint32_t)ctx->env->ps;
+  header.flags = ctx->flags;
+  header.since_txnid = ctx->since;
+  header.txnid = ctx->txnid;
+  memcpy(&header.dxbid, &page_meta((page_t *)ctx->metas)->dxbid, sizeof(header.dxbid));
+  if (ctx->base) {
+    header.flags |= INCREMENTAL_BASE_KNOWN;
+    header.base_gc = ctx->base->trees.gc;
+    header.base_main = ctx->base->trees.main;
+    header.base_geometry = ctx->base->geometry;
+  }
+  int rc = incremental_put(ctx, &header, sizeof(header));
+
+  cursor_couple_t couple;
+  if (likely(rc == MDBX_SUCCESS) && txn)
+    rc = cursor_init(&couple.outer, txn, MAIN_DBI);
+  if (likely(rc == MDBX_SUCCESS) && txn) {
+    /* pages of all b-trees are read via the same cursor, so only the headers could be checked */
+    couple.outer.checking &= ~z_pagecheck;
+    for (size_t dbi = FREE_DBI; rc == MDBX_SUCCESS && dbi < CORE_DBS; ++dbi)
+      if (txn->dbs[dbi].root != P_INVALID)
+        rc = incremental_walk(ctx, &couple.outer, txn->dbs[dbi].root,
+                              txn->dbs[dbi].mod_txnid ? txn->dbs[dbi].mod_txnid : txn->txnid);
+  }
+
+  if (likely(rc == MDBX_SUCCESS)) {
+    const incremental_chunk_t chunk = {.pgno = 0, .npages = NUM_METAS};
+    rc = incremental_put(ctx, &chunk, sizeof(chunk));
+    if (likely(rc == MDBX_SUCCESS))
+      rc = incremental_put(ctx, ctx->metas, pgno2bytes(ctx->env, NUM_METAS));
+  }
+  if (likely(rc == MDBX_SUCCESS))
+    rc = incremental_flush(ctx);
+  return rc;
+}
+
+/* Takes a copy of the meta-page of the base snapshot, if it is still one of the meta-pages. */
+__cold static bool incremental_base(const MDBX_env *env, txnid_t since_txnid, meta_t *base) {
+  for (size_t n = 0; since_txnid && n < NUM_METAS; ++n) {
+    const volatile meta_t *const meta = METAPAGE(env, n);
+    if (meta_txnid(meta) == since_txnid) {
+      memcpy(base, (const meta_t *)meta, sizeof(meta_t));
+      /* the meta-page could be overwritten meanwhile by a writer */
+      if (meta_txnid(meta) == since_txnid && constmeta_txnid(base) == since_txnid)
+        return true;
+    }
+  }
+  return false;
+}
+
+__cold static int copy_incremental(MDBX_txn *txn, txnid_t since_txnid, mdbx_filehandle_t fd) {
+  if (unlikely(since_txnid > txn->txnid))
+    return MDBX_EINVAL;
+
+  const int dest_is_pipe = osal_is_pipe(fd);
+  if (MDBX_IS_ERROR(dest_is_pipe))
+    return dest_is_pipe;
+
+  int rc = MDBX_SUCCESS;
+  if (!dest_is_pipe) {
+    rc = osal_fseek(fd, 0);
+    if (unlikely(rc != MDBX_SUCCESS))
+      return rc;
+  }
+
+  MDBX_env *const env = txn->env;
+  uint8_t *buffer = nullptr;
+  rc = osal_memalign_alloc(globals.sys_pagesize, incremental_bufsize(env), (void **)&buffer);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  meta_t base;
+  incremental_ctx_t ctx = {.env = env,
+                           .fd = fd,
+                           .since = since_txnid,
+                           .txnid = txn->txnid,
+                           .base = incremental_base(env, since_txnid, &base) ? &base : nullptr};
+  incremental_setbuf(&ctx, buffer);
+  copy_asis_meta(env, txn, ctx.metas, MDBX_CP_DEFAULTS);
+  rc = incremental_emit(&ctx, txn);
+  if (likely(rc == MDBX_SUCCESS) && !dest_is_pipe)
+    rc = osal_fsync(fd, MDBX_SYNC_DATA | MDBX_SYNC_SIZE);
+
+  osal_memalign_free(buffer);
+  return rc;
+}
+
+__cold int mdbx_env_copy_incremental(MDBX_env *env, uint64_t since_txnid, mdbx_filehandle_t fd) {
+  int rc = check_env(env, true);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  MDBX_txn *txn = nullptr;
+  rc = mdbx_txn_begin(env, nullptr, MDBX_TXN_RDONLY, &txn);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  rc = copy_incremental(txn, since_txnid, fd);
+  mdbx_txn_abort(txn);
+  return LOG_IFERR(rc);
+}
+
+/* Emits the changes of the committed transaction, or just the meta-pages without a transaction,
+ * e.g. for a geometry change, i.e. a step which doesn't change any page. */
+void copy_commit_stream(MDBX_env *env, MDBX_txn *txn, const meta_t *base, const meta_t *committed) {
+  eASSERT0(env, !txn || txn->env == env);
+  eASSERT0(env, txn || memcmp(&base->trees, &committed->trees, sizeof(committed->trees)) == 0);
+  int rc = MDBX_SUCCESS;
+  if (!env->stream.buffer)
+    rc = osal_memalign_alloc(globals.sys_pagesize, incremental_bufsize(env), (void **)&env->stream.buffer);
+
+  incremental_ctx_t ctx = {.env = env,
+                           .func = env->stream.func,
+                           .func_ctx = env->stream.ctx,
+                           .fd = env->stream.fd,
+                           .since = constmeta_txnid(base),
+                           .txnid = constmeta_txnid(committed),
+                           .flags = INCREMENTAL_SINGLE_COMMIT,
+                           .base = base};
+  if (likely(rc == MDBX_SUCCESS)) {
+    incremental_setbuf(&ctx, env->stream.buffer);
+    meta_t *const meta = meta_init_triplet(env, ctx.metas, &committed->dxbid);
+    meta_set_txnid(env, meta, ctx.txnid);
+    meta->geometry = committed->geometry;
+    meta->trees = committed->trees;
+    meta->canary = committed->canary;
+    meta_sign_as_steady(meta);
+    rc = incremental_emit(&ctx, txn);
+  }
+  if (likely(rc == MDBX_SUCCESS) && ctx.func)
+    /* the end of the transaction */
+    rc = ctx.func(env, ctx.func_ctx, ctx.txnid, nullptr, 0);
+
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    /* The commit is already done, so the stream is just stopped since it can't be continued consistently. */
+    ERROR("commit-stream: error %d (%s) for txnid %" PRIaTXN ", the stream is stopped", rc, mdbx_strerror(rc),
+          ctx.txnid);
+    env->stream.func = nullptr;
+    env->stream.fd = INVALID_HANDLE_VALUE;
+  }
+}
+
+__cold static int env_set_commit_stream(MDBX_env *env, MDBX_commit_stream_func *func, void *ctx,
+                                        mdbx_filehandle_t fd) {
+  int rc = check_env(env, false);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  if (unlikely((env->flags & (ENV_ACTIVE | MDBX_RDONLY)) == (ENV_ACTIVE | MDBX_RDONLY)))
+    return MDBX_EACCESS;
+
+  const bool lock_needed = (env->flags & ENV_ACTIVE) && !env_owned_wrtxn(env);
+  if (lock_needed) {
+    rc = lck_txn_lock(env, false);
+    if (unlikely(rc != MDBX_SUCCESS))
+      return rc;
+  }
+
+  env->stream.func = func;
+  env->stream.ctx = ctx;
+  env->stream.fd = fd;
+
+  if (lock_needed)
+    lck_txn_unlock(env);
+  return MDBX_SUCCESS;
+}
+
+__cold int mdbx_env_set_commit_stream(MDBX_env *env, MDBX_commit_stream_func *func, void *ctx) {
+  return LOG_IFERR(env_set_commit_stream(env, func, func ? ctx : nullptr, INVALID_HANDLE_VALUE));
+}
+
+__cold int mdbx_env_set_commit_stream_fd(MDBX_env *env, mdbx_filehandle_t fd) {
+  return LOG_IFERR(env_set_commit_stream(env, nullptr, nullptr, fd));
+}
+
+/* Returns the recent steady meta-page of the given image, if any. */
+__cold static const meta_t *incremental_recent_meta(const uint8_t *metas, const size_t pagesize) {
+  const meta_t *recent = nullptr;
+  for (size_t i = 0; i < NUM_METAS; ++i) {
+    const meta_t *const meta = page_meta((page_t *)ptr_disp(metas, i * pagesize));
+    if (unaligned_peek_u64(4, meta->magic_and_version) == MDBX_DATA_MAGIC && meta->pagesize == pagesize &&
+        meta_is_steady(meta) && meta_sign_get(meta) == meta_sign_calculate(meta) &&
+        (!recent || constmeta_txnid(meta) > constmeta_txnid(recent)))
+      recent = meta;
+  }
+  return recent;
+}
+
+/* Checks the image, i.e. its recent steady meta-page, is the base snapshot of the incremental stream. */
+__cold static int incremental_check_base(const incremental_header_t *header, const uint8_t *metas,
+                                         const size_t pagesize) {
+  const meta_t *const base = (header->pagesize == pagesize) ? incremental_recent_meta(metas, pagesize) : nullptr;
+  const txnid_t base_txnid = base ? constmeta_txnid(base) : 0;
+  if (unlikely(header->pagesize != pagesize || base_txnid != header->since_txnid)) {
+    ERROR("the base image has txnid %" PRIaTXN " (or page size differs), but incremental copy requires %" PRIaTXN,
+          base_txnid, header->since_txnid);
+    return MDBX_INCOMPATIBLE;
+  }
+  if (!base)
+    /* the incremental copy since zero txnid holds all pages */
+    return MDBX_SUCCESS;
+
+  if (unlikely(memcmp(&base->dxbid, &header->dxbid, sizeof(bin128_t)) != 0)) {
+    ERROR("the base image has txnid %" PRIaTXN ", but it is a copy of another database", base_txnid);
+    return MDBX_INCOMPATIBLE;
+  }
+  /* The lower bound and steps of the geometry are ignored, since these are altered by MDBX_CP_FORCE_DYNAMIC_SIZE */
+  if ((header->flags & INCREMENTAL_BASE_KNOWN) &&
+      unlikely(memcmp(&base->trees.gc, &header->base_gc, sizeof(tree_t)) != 0 ||
+               memcmp(&base->trees.main, &header->base_main, sizeof(tree_t)) != 0 ||
+               base->geometry.now != header->base_geometry.now || base->geometry.upper != header->base_geometry.upper ||
+               base->geometry.first_unallocated != header->base_geometry.first_unallocated)) {
+    ERROR("the base image has txnid %" PRIaTXN ", but its b-trees or geometry differ from the base snapshot",
+          base_txnid);
+    return MDBX_INCOMPATIBLE;
+  }
+  return MDBX_SUCCESS;
+}
+
+/* Reads and checks the header of the next incremental stream.
+ * Returns MDBX_RESULT_TRUE at the end of input. */
+__cold static int incremental_read_header(mdbx_filehandle_t fd, incremental_header_t *header) {
+  int rc = osal_read(fd, header, sizeof(*header));
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+  if (unlikely(header->magic_and_version != MDBX_INCREMENTAL_MAGIC)) {
+    ERROR("%s, magic/version 0x%" PRIx64 " instead of 0x%" PRIx64, "not an incremental copy or unsupported version",
+          header->magic_and_version, MDBX_INCREMENTAL_MAGIC);
+    return MDBX_INVALID;
+  }
+  if (unlikely(header->pagesize < MDBX_MIN_PAGESIZE || header->pagesize > MDBX_MAX_PAGESIZE ||
+               !is_powerof2(header->pagesize) || header->since_txnid > header->txnid))
+    return MDBX_CORRUPTED;
+  return MDBX_SUCCESS;
+}
+
+/* Writes the pages of a single incremental stream and reads its meta-pages. */
+__cold static int incremental_apply(mdbx_filehandle_t dest_fd, mdbx_filehandle_t delta_fd,
+                                    const incremental_header_t *header, uint8_t *metas, uint8_t *buffer) {
+  const size_t ps = header->pagesize;
+  for (;;) {
+    incremental_chunk_t chunk;
+    int rc = osal_read(delta_fd, &chunk, sizeof(chunk));
+    if (unlikely(rc != MDBX_SUCCESS))
+      return (rc == MDBX_RESULT_TRUE) ? MDBX_ENODATA : rc;
+    if (chunk.pgno == 0) {
+      if (unlikely(chunk.npages != NUM_METAS))
+        return MDBX_CORRUPTED;
+      rc = osal_read(delta_fd, metas, ps * NUM_METAS);
+      if (unlikely(rc != MDBX_SUCCESS))
+        return (rc == MDBX_RESULT_TRUE) ? MDBX_ENODATA : rc;
+      const meta_t *const recent = incremental_recent_meta(metas, ps);
+      return (recent && constmeta_txnid(recent) == header->txnid) ? MDBX_SUCCESS : MDBX_CORRUPTED;
+    }
+    if (unlikely(chunk.pgno < NUM_METAS || chunk.npages < 1 || chunk.npages > MAX_PAGENO + 1 - chunk.pgno))
+      return MDBX_CORRUPTED;
+    uint64_t offset = chunk.pgno * (uint64_t)ps;
+    for (uint64_t left = chunk.npages * (uint64_t)ps; left > 0;) {
+      const size_t bytes = (left < MDBX_ENVCOPY_WRITEBUF) ? (size_t)left : (size_t)MDBX_ENVCOPY_WRITEBUF;
+      rc = osal_read(delta_fd, buffer, bytes);
+      if (unlikely(rc != MDBX_SUCCESS))
+        return (rc == MDBX_RESULT_TRUE) ? MDBX_ENODATA : rc;
+      rc = osal_pwrite(dest_fd, buffer, bytes, offset);
+      if (unlikely(rc != MDBX_SUCCESS))
+        return rc;
+      offset += bytes;
+      left -= bytes;
+    }
+  }
+}
+
+__cold int mdbx_env_apply_incremental(mdbx_filehandle_t dest_fd, mdbx_filehandle_t delta_fd) {
+  incremental_header_t header;
+  int rc = incremental_read_header(delta_fd, &header);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR((rc == MDBX_RESULT_TRUE) ? MDBX_ENODATA : rc);
+
+  const size_t ps = header.pagesize, meta_bytes = ceil_powerof2(ps * NUM_METAS, globals.sys_pagesize);
+  uint8_t *buffer = nullptr;
+  rc = osal_memalign_alloc(globals.sys_pagesize, meta_bytes * 2 + (size_t)MDBX_ENVCOPY_WRITEBUF, (void **)&buffer);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+  /* The meta-pages of the last completely applied stream, the ones of the stream being applied and the buffer. */
+  uint8_t *applied = buffer, *metas = buffer + meta_bytes, *const data_buffer = buffer + meta_bytes * 2;
+
+  /* Check the base image is the snapshot the incremental copy was made against. */
+  rc = osal_pread(dest_fd, applied, ps * NUM_METAS, 0);
+  if (likely(rc == MDBX_SUCCESS))
+    rc = incremental_check_base(&header, applied, ps);
+
+  if (likely(rc == MDBX_SUCCESS)) {
+    /* Firstly write a stub to meta-pages,
+     * so the image will be unusable unless updated completely. */
+    memset(metas, -1, ps * NUM_METAS);
+    rc = osal_pwrite(dest_fd, metas, ps * NUM_METAS, 0);
+  }
+
+  /* Apply the consecutive streams up to the end of input, e.g. the ones produced by the commit stream.
+   * The pages of a single commit are never reachable from the meta-pages of the previous snapshot, therefore
+   * the image could be restored up to the last completely applied stream, even if the next one is truncated. */
+  bool restorable = false;
+  while (likely(rc == MDBX_SUCCESS)) {
+    restorable = (header.flags & INCREMENTAL_SINGLE_COMMIT) != 0;
+    rc = incremental_apply(dest_fd, delta_fd, &header, metas, data_buffer);
+    if (unlikely(rc != MDBX_SUCCESS))
+      break;
+    restorable = true;
+    uint8_t *const swap = applied;
+    applied = metas;
+    metas = swap;
+
+    rc = incremental_read_header(delta_fd, &header);
+    if (rc == MDBX_RESULT_TRUE) {
+      rc = MDBX_SUCCESS;
+      break;
+    }
+    if (likely(rc == MDBX_SUCCESS))
+      /* the next stream must be made against the snapshot of the applied one */
+      rc = incremental_check_base(&header, applied, ps);
+  }
+
+  if (restorable) {
+    const meta_t *const recent = incremental_recent_meta(applied, ps);
+    const uint64_t whole_size = recent->geometry.now * (uint64_t)ps;
+    uint64_t filesize = 0;
+    int err = osal_filesize(dest_fd, &filesize);
+    if (likely(err == MDBX_SUCCESS) && filesize < whole_size)
+      err = osal_fsetsize(dest_fd, whole_size);
+    if (likely(err == MDBX_SUCCESS))
+      err = osal_fsync(dest_fd, MDBX_SYNC_DATA | MDBX_SYNC_SIZE);
+    if (likely(err == MDBX_SUCCESS))
+      err = osal_pwrite(dest_fd, applied, ps * NUM_METAS, 0);
+    if (likely(err == MDBX_SUCCESS))
+      err = osal_fsync(dest_fd, MDBX_SYNC_DATA | MDBX_SYNC_IODQ);
+    if (unlikely(err != MDBX_SUCCESS))
+      rc = err;
+  }
+
+  osal_memalign_free(buffer);
+  return LOG_IFERR(rc);
+}
+
 MDBX_cursor *mdbx_cursor_create(void *context) {
   cursor_couple_t *couple = osal_calloc(1, sizeof(cursor_couple_t));
   if (unlikely(!couple))
@@ -6129,7 +7689,74 @@ int mdbx_cursor_scan_from(MDBX_cursor *mc, MDBX_predicate_func predicate, void *
   return LOG_IFERR(scan_confinue(mc, predicate, context, arg, key, value, turn_op));
 }
 
+/* Возвращает true, если среди ключей страницы может встретиться стоп-ключ,
+ * т.е. если крайний в направлении обхода ключ страницы достигает стоп-ключа. */
+static bool batch_stop_within(const MDBX_cursor *mc, const page_t *mp, const bool forward, const MDBX_val *stop_key) {
+  const size_t nkeys = page_numkeys(mp);
+  const MDBX_val edge = get_key(page_node(mp, forward ? nkeys - 1 : 0));
+  const int cmp = mc->clc->k.cmp(&edge, stop_key);
+  return forward ? cmp >= 0 : cmp <= 0;
+}
+
+/* Выборка дубликатов текущего ключа, начиная с текущей позиции вложенного курсора.
+ * Страницы DUPFIX-дубликатов возвращаются целиком, одним значением на страницу.
+ * Возвращает MDBX_RESULT_TRUE если все дубликаты выбраны, либо MDBX_SUCCESS
+ * если закончилось место в буфере. */
+static int batch_dups(MDBX_cursor *mc, const MDBX_val *key, const bool forward, MDBX_val *pairs, const size_t limit,
+                      size_t *pn) {
+  MDBX_cursor *const mx = &mc->subcur->cursor;
+  size_t n = *pn;
+  int rc = MDBX_SUCCESS;
+  while (n + 2 <= limit) {
+    const page_t *mp = mx->pg[mx->top];
+    const intptr_t nkeys = page_numkeys(mp);
+    intptr_t ki = mx->ki[mx->top];
+    cASSERT0(mc, ki >= 0 && ki < nkeys);
+    if (is_dupfix_leaf(mp)) {
+      const size_t ksize = mx->tree->dupfix_size;
+      const size_t from = forward ? (size_t)ki : 0, upto = forward ? (size_t)nkeys : (size_t)ki + 1;
+      pairs[n] = *key;
+      pairs[n + 1].iov_base = page_dupfix_ptr(mp, from, ksize);
+      pairs[n + 1].iov_len = (upto - from) * ksize;
+      n += 2;
+    } else {
+      do {
+        pairs[n] = *key;
+        pairs[n + 1] = get_key(page_node(mp, ki));
+        n += 2;
+        ki += forward ? 1 : -1;
+      } while (n + 2 <= limit && ki >= 0 && ki < nkeys);
+      if (ki >= 0 && ki < nkeys) {
+        mx->ki[mx->top] = (indx_t)ki;
+        be_filled(mx);
+        break;
+      }
+    }
+
+    rc = forward ? cursor_sibling_right(mx) : cursor_sibling_left(mx);
+    if (rc != MDBX_SUCCESS) {
+      if (rc == MDBX_NOTFOUND)
+        rc = MDBX_RESULT_TRUE;
+      break;
+    }
+    mp = mx->pg[mx->top];
+    if (!MDBX_DISABLE_VALIDATION && unlikely(!check_leaf_type(mx, mp))) {
+      ERROR("unexpected leaf-page #%" PRIaPGNO " type 0x%x seen by cursor", mp->pgno, mp->flags);
+      rc = MDBX_CORRUPTED;
+      break;
+    }
+    be_filled(mx);
+  }
+  *pn = n;
+  return rc;
+}
+
 int mdbx_cursor_get_batch(MDBX_cursor *mc, size_t *count, MDBX_val *pairs, size_t limit, MDBX_cursor_op op) {
+  return mdbx_cursor_get_batch_ex(mc, count, pairs, limit, op, nullptr);
+}
+
+int mdbx_cursor_get_batch_ex(MDBX_cursor *mc, size_t *count, MDBX_val *pairs, size_t limit, MDBX_cursor_op op,
+                             const MDBX_val *stop_key) {
   if (unlikely(!count))
     return LOG_IFERR(MDBX_EINVAL);
 
@@ -6141,9 +7768,7 @@ int mdbx_cursor_get_batch(MDBX_cursor *mc, size_t *count, MDBX_val *pairs, size_
   if (unlikely(rc != MDBX_SUCCESS))
     return LOG_IFERR(rc);
 
-  if (unlikely(mc->subcur))
-    return LOG_IFERR(MDBX_INCOMPATIBLE) /* must be a non-dupsort table */;
-
+  bool forward = true;
   switch (op) {
   case MDBX_NEXT:
     if (unlikely(is_eof(mc)))
@@ -6158,48 +7783,124 @@ int mdbx_cursor_get_batch(MDBX_cursor *mc, size_t *count, MDBX_val *pairs, size_
     }
     break;
 
+  case MDBX_PREV:
+    /* пустое состояние остаётся после достижения начала данных */
+    if (unlikely(!is_pointed(mc) || is_hollow(mc)))
+      return LOG_IFERR(is_pointed(mc) ? MDBX_NOTFOUND : MDBX_ENODATA);
+    if (mc->flags & (z_eof_hard | z_after_delete)) {
+      rc = outer_prev(mc, nullptr, nullptr, MDBX_PREV);
+      if (unlikely(rc != MDBX_SUCCESS))
+        return LOG_IFERR(rc);
+    }
+    forward = false;
+    break;
+
+  case MDBX_LAST:
+    if (!is_filled(mc)) {
+      rc = outer_last(mc, nullptr, nullptr);
+      if (unlikely(rc != MDBX_SUCCESS))
+        return LOG_IFERR(rc);
+    }
+    forward = false;
+    break;
+
   default:
     DEBUG("unhandled/unimplemented cursor operation %u", op);
     return LOG_IFERR(MDBX_EINVAL);
   }
 
   const page_t *mp = mc->pg[mc->top];
-  size_t nkeys = page_numkeys(mp);
-  size_t ki = mc->ki[mc->top];
+  intptr_t nkeys = page_numkeys(mp);
+  intptr_t ki = mc->ki[mc->top];
+  bool check_stop = stop_key && batch_stop_within(mc, mp, forward, stop_key);
+  /* вложенный курсор уже установлен на дубликаты текущего ключа */
+  bool inner_ready = inner_filled(mc);
   size_t n = 0;
   while (n + 2 <= limit) {
-    cASSERT0(mc, ki < nkeys);
-    if (unlikely(ki >= nkeys))
+    cASSERT0(mc, ki >= 0 && ki < nkeys);
+    if (unlikely(ki < 0 || ki >= nkeys))
       goto sibling;
 
     const node_t *leaf = page_node(mp, ki);
-    pairs[n] = get_key(leaf);
-    rc = node_read(mc, leaf, &pairs[n + 1], mp);
-    if (unlikely(rc != MDBX_SUCCESS))
-      goto bailout;
+    const MDBX_val key = get_key(leaf);
+    if (check_stop) {
+      const int cmp = mc->clc->k.cmp(&key, stop_key);
+      if (forward ? cmp >= 0 : cmp <= 0) {
+        rc = MDBX_RESULT_TRUE;
+        break;
+      }
+    }
+
+    if (node_flags(leaf) & N_DUP) {
+      mc->ki[mc->top] = (indx_t)ki;
+      if (!inner_ready) {
+        rc = cursor_dupsort_setup(mc, leaf, mp);
+        if (likely(rc == MDBX_SUCCESS))
+          rc = forward ? inner_first(&mc->subcur->cursor, nullptr) : inner_last(&mc->subcur->cursor, nullptr);
+        if (unlikely(rc != MDBX_SUCCESS))
+          goto bailout;
+        inner_ready = true;
+      }
+      rc = batch_dups(mc, &key, forward, pairs, limit, &n);
+      if (rc != MDBX_RESULT_TRUE) {
+        if (likely(rc == MDBX_SUCCESS))
+          break;
+        goto bailout;
+      }
+      rc = MDBX_SUCCESS;
+    } else {
+      pairs[n] = key;
+      rc = node_read(mc, leaf, &pairs[n + 1], mp);
+      if (unlikely(rc != MDBX_SUCCESS))
+        goto bailout;
+      n += 2;
+    }
 
-    n += 2;
-    if (++ki == nkeys) {
+    inner_ready = false;
+    if (forward ? ++ki == nkeys : --ki < 0) {
     sibling:
-      rc = cursor_sibling_right(mc);
+      rc = forward ? cursor_sibling_right(mc) : cursor_sibling_left(mc);
       if (rc != MDBX_SUCCESS) {
-        if (rc == MDBX_NOTFOUND)
+        if (rc == MDBX_NOTFOUND) {
           rc = MDBX_RESULT_TRUE;
+          if (!forward) {
+            /* перед первой строкой курсор не может стоять,
+             * поэтому переводим его в неустановленное состояние */
+            mc->flags |= z_hollow;
+            if (inner_pointed(mc))
+              mc->subcur->cursor.flags |= z_hollow;
+          }
+        }
         goto bailout;
       }
 
       mp = mc->pg[mc->top];
-      DEBUG("next page is %" PRIaPGNO ", key index %u", mp->pgno, mc->ki[mc->top]);
+      DEBUG("%s page is %" PRIaPGNO ", key index %u", forward ? "next" : "prev", mp->pgno, mc->ki[mc->top]);
       if (!MDBX_DISABLE_VALIDATION && unlikely(!check_leaf_type(mc, mp))) {
         ERROR("unexpected leaf-page #%" PRIaPGNO " type 0x%x seen by cursor", mp->pgno, mp->flags);
         rc = MDBX_CORRUPTED;
         goto bailout;
       }
       nkeys = page_numkeys(mp);
-      ki = 0;
+      ki = forward ? 0 : nkeys - 1;
+      check_stop = stop_key && batch_stop_within(mc, mp, forward, stop_key);
     }
   }
+
+  /* курсор остаётся на первой из не выбранных строк */
   mc->ki[mc->top] = (indx_t)ki;
+  be_filled(mc);
+  if (mc->subcur && !inner_ready) {
+    const node_t *leaf = page_node(mp, ki);
+    if (node_flags(leaf) & N_DUP) {
+      int err = cursor_dupsort_setup(mc, leaf, mp);
+      if (likely(err == MDBX_SUCCESS))
+        err = forward ? inner_first(&mc->subcur->cursor, nullptr) : inner_last(&mc->subcur->cursor, nullptr);
+      if (unlikely(err != MDBX_SUCCESS))
+        rc = err;
+    } else
+      inner_gone(mc);
+  }
 
 bailout:
   *count = n;
@@ -6579,6 +8280,213 @@ int mdbx_cursor_distribute(const MDBX_cursor *begin, const MDBX_cursor *end, MDB
   return LOG_IFERR(rc);
 }
 
+typedef struct scan_parallel_ctx {
+  const MDBX_txn *txn;
+  MDBX_dbi dbi;
+  bool dupfix;
+  MDBX_predicate_func predicate;
+  void *context;
+  mdbx_atomic_uint32_t stop;
+} scan_parallel_ctx_t;
+
+typedef struct scan_parallel_worker {
+  osal_thread_t thread;
+  scan_parallel_ctx_t *ctx;
+  void *arg;
+  const MDBX_val *from, *stop;
+  MDBX_val bound;
+  int rc;
+  bool started;
+} scan_parallel_worker_t;
+
+/* Просмотр поддиапазона [from, stop) пачками посредством mdbx_cursor_get_batch_ex(),
+ * с разделением DUPFIX-пачек на отдельные значения для вызова предиката. */
+static int scan_parallel_range(scan_parallel_worker_t *worker, MDBX_cursor *mc) {
+  scan_parallel_ctx_t *const ctx = worker->ctx;
+  MDBX_val key = {nullptr, 0}, value = {nullptr, 0};
+  if (worker->from)
+    key = *worker->from;
+  int rc = mdbx_cursor_get(mc, &key, &value, worker->from ? MDBX_SET_RANGE : MDBX_FIRST);
+
+  MDBX_val pairs[128];
+  while (rc == MDBX_RESULT_FALSE && likely(atomic_load32(&ctx->stop, mo_Relaxed) == 0)) {
+    size_t count;
+    const int batch = mdbx_cursor_get_batch_ex(mc, &count, pairs, ARRAY_LENGTH(pairs), MDBX_NEXT, worker->stop);
+    if (unlikely(batch != MDBX_SUCCESS && batch != MDBX_RESULT_TRUE)) {
+      rc = batch;
+      break;
+    }
+    for (size_t i = 0; i < count && rc == MDBX_RESULT_FALSE; i += 2) {
+      const size_t item = (ctx->dupfix && mc->tree->dupfix_size) ? mc->tree->dupfix_size : pairs[i + 1].iov_len;
+      const uint8_t *ptr = pairs[i + 1].iov_base, *const end = ptr + pairs[i + 1].iov_len;
+      do {
+        key = pairs[i];
+        value.iov_base = (void *)ptr;
+        value.iov_len = item;
+        rc = ctx->predicate(ctx->context, &key, &value, worker->arg);
+        ptr += item;
+      } while (rc == MDBX_RESULT_FALSE && ptr < end);
+    }
+    if (batch == MDBX_RESULT_TRUE)
+      break;
+  }
+
+  return (rc == MDBX_NOTFOUND) ? MDBX_RESULT_FALSE : rc;
+}
+
+static THREAD_RESULT THREAD_CALL scan_parallel_thread(void *arg) {
+  scan_parallel_worker_t *const worker = arg;
+  MDBX_txn *clone = nullptr;
+  int rc = mdbx_txn_clone(worker->ctx->txn, &clone, nullptr);
+  if (likely(rc == MDBX_SUCCESS)) {
+    MDBX_cursor *mc = nullptr;
+    rc = mdbx_cursor_open(clone, worker->ctx->dbi, &mc);
+    if (likely(rc == MDBX_SUCCESS))
+      rc = scan_parallel_range(worker, mc);
+    mdbx_cursor_close(mc);
+    int err = mdbx_txn_abort(clone);
+    if (unlikely(err != MDBX_SUCCESS) && rc == MDBX_RESULT_FALSE)
+      rc = err;
+  }
+  if (rc != MDBX_RESULT_FALSE)
+    atomic_store32(&worker->ctx->stop, 1, mo_Relaxed);
+  worker->rc = rc;
+  return (THREAD_RESULT)0;
+}
+
+int mdbx_cursor_scan_parallel(const MDBX_cursor *cursor, const MDBX_val *from_key, const MDBX_val *to_key,
+                              MDBX_predicate_func predicate, void *context, void *const *args, size_t workers,
+                              MDBX_reduce_func reducer) {
+  if (unlikely(!predicate || workers < 1 || workers > INT16_MAX))
+    return LOG_IFERR(MDBX_EINVAL);
+
+  int rc = cursor_check_ro(cursor);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+  if (unlikely((cursor->txn->flags & MDBX_TXN_RDONLY) == 0))
+    /* the workers scan within read-only clones, which can't see changes of a write transaction */
+    return LOG_IFERR(MDBX_BAD_TXN);
+
+  size_t used = 1;
+  MDBX_cursor *mc = nullptr;
+  scan_parallel_ctx_t ctx;
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.txn = cursor->txn;
+  ctx.dbi = (MDBX_dbi)cursor_dbi(cursor);
+  ctx.dupfix = (cursor->tree->flags & MDBX_DUPFIXED) != 0;
+  ctx.predicate = predicate;
+  ctx.context = context;
+
+  scan_parallel_worker_t *const pool = osal_calloc(workers, sizeof(scan_parallel_worker_t));
+  cursor_couple_t *const splits = (workers > 1) ? osal_calloc(workers, sizeof(cursor_couple_t)) : nullptr;
+  MDBX_cursor **const array = (workers > 1) ? osal_malloc(workers * sizeof(MDBX_cursor *)) : nullptr;
+  if (unlikely(!pool || (workers > 1 && (!splits || !array)))) {
+    rc = MDBX_ENOMEM;
+    goto bailout;
+  }
+
+  for (size_t i = 0; i < workers; ++i) {
+    pool[i].ctx = &ctx;
+    pool[i].arg = args ? args[i] : nullptr;
+    pool[i].rc = MDBX_RESULT_FALSE;
+  }
+  pool[0].from = from_key;
+
+  cursor_couple_t begin, end;
+  MDBX_val key = {nullptr, 0}, value = {nullptr, 0};
+  if (from_key)
+    key = *from_key;
+  rc = cursor_init(&begin.outer, cursor->txn, ctx.dbi);
+  if (likely(rc == MDBX_SUCCESS))
+    rc = cursor_ops(&begin.outer, &key, &value, from_key ? MDBX_SET_RANGE : MDBX_FIRST);
+  if (rc == MDBX_NOTFOUND || (rc == MDBX_SUCCESS && to_key && begin.outer.clc->k.cmp(&key, to_key) >= 0)) {
+    /* пустой диапазон */
+    rc = MDBX_SUCCESS;
+    goto reduce;
+  }
+  if (unlikely(rc != MDBX_SUCCESS))
+    goto bailout;
+
+  /* Границы поддиапазонов определяются распределением курсоров на нижнем уровне branch-страниц,
+   * т.е. с точностью до листовой страницы и без чтения листьев. Поддиапазоны задаются ключами,
+   * поэтому все значения одного ключа в MDBX_DUPSORT-таблицах всегда достаются одному исполнителю. */
+  if (workers > 1) {
+    rc = cursor_init(&end.outer, cursor->txn, ctx.dbi);
+    if (likely(rc == MDBX_SUCCESS)) {
+      if (to_key) {
+        key = *to_key;
+        rc = cursor_ops(&end.outer, &key, &value, MDBX_SET_RANGE);
+      }
+      if (!to_key || rc == MDBX_NOTFOUND)
+        rc = outer_last(&end.outer, nullptr, nullptr);
+    }
+    for (size_t i = 0; rc == MDBX_SUCCESS && i < workers; ++i) {
+      array[i] = &splits[i].outer;
+      rc = cursor_init(array[i], cursor->txn, ctx.dbi);
+    }
+    if (likely(rc == MDBX_SUCCESS)) {
+      const size_t height = begin.outer.tree->height;
+      rc = cursor_distribute(&begin.outer, &end.outer, array, workers, (height > 1) ? (int)height - 2 : 0);
+    }
+    if (unlikely(rc != MDBX_SUCCESS && rc != MDBX_RESULT_TRUE))
+      goto bailout;
+    rc = MDBX_SUCCESS;
+
+    for (; used < workers; ++used) {
+      const MDBX_cursor *const mc = array[used - 1];
+      if (!is_filled(mc))
+        break;
+      MDBX_val *const bound = &pool[used - 1].bound;
+      *bound = get_key(page_node(mc->pg[mc->top], mc->ki[mc->top]));
+      if (to_key && mc->clc->k.cmp(bound, to_key) >= 0)
+        break;
+      pool[used - 1].stop = pool[used].from = bound;
+    }
+  }
+  pool[used - 1].stop = to_key;
+
+  /* курсор вызывающего потока открывается до запуска вспомогательных потоков,
+   * так как при этом изменяется исходная транзакция, из которой создаются клоны */
+  rc = mdbx_cursor_open(cursor->txn, ctx.dbi, &mc);
+  if (unlikely(rc != MDBX_SUCCESS))
+    goto bailout;
+
+  for (size_t i = 1; i < used; ++i) {
+    int err = osal_thread_create(&pool[i].thread, scan_parallel_thread, &pool[i]);
+    if (unlikely(err != MDBX_SUCCESS)) {
+      WARNING("unable to start scan worker #%zu, err %d", i, err);
+      break;
+    }
+    pool[i].started = true;
+  }
+
+  /* вызывающий поток просматривает первый поддиапазон, а также те, для которых не удалось запустить поток */
+  for (size_t i = 0; i < used && atomic_load32(&ctx.stop, mo_Relaxed) == 0; ++i)
+    if (!pool[i].started) {
+      pool[i].rc = scan_parallel_range(&pool[i], mc);
+      if (pool[i].rc != MDBX_RESULT_FALSE)
+        atomic_store32(&ctx.stop, 1, mo_Relaxed);
+    }
+
+  for (size_t i = 1; i < used; ++i)
+    if (pool[i].started) {
+      int err = osal_thread_join(pool[i].thread);
+      if (unlikely(err != MDBX_SUCCESS) && rc == MDBX_SUCCESS)
+        rc = err;
+    }
+
+reduce:
+  for (size_t i = 0; rc == MDBX_SUCCESS && i < workers; ++i)
+    rc = reducer ? reducer(context, pool[i].arg, pool[i].rc) : pool[i].rc;
+
+bailout:
+  mdbx_cursor_close(mc);
+  osal_free(array);
+  osal_free(splits);
+  osal_free(pool);
+  return LOG_IFERR(rc);
+}
+
 int mdbx_cursor_scroll(MDBX_cursor *mc, intptr_t amount, unsigned deepness) {
   int rc = cursor_check_ro(mc);
   if (unlikely(rc != MDBX_SUCCESS))
@@ -7193,7 +9101,8 @@ __cold int mdbx_env_create(MDBX_env **penv) {
 
   env->max_readers = DEFAULT_READERS;
   env->max_dbi = env->n_dbi = CORE_DBS;
-  env->lazy_fd = env->dsync_fd = env->fd4meta = env->lck_mmap.fd = INVALID_HANDLE_VALUE;
+  env->lazy_fd = env->dsync_fd = env->fd4meta = env->lck_mmap.fd = env->pgsum.map.fd = env->stream.fd =
+      INVALID_HANDLE_VALUE;
   env->stuck_meta = -1;
 
   env_options_init(env);
@@ -7203,6 +9112,41 @@ __cold int mdbx_env_create(MDBX_env **penv) {
   if (unlikely(rc != MDBX_SUCCESS))
     goto bailout;
 
+  rc = osal_fastmutex_init(&env->group_sync_lock);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    osal_fastmutex_destroy(&env->dbi_lock);
+    goto bailout;
+  }
+
+  rc = osal_condpair_init(&env->flusher.condpair);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    osal_fastmutex_destroy(&env->group_sync_lock);
+    osal_fastmutex_destroy(&env->dbi_lock);
+    goto bailout;
+  }
+
+  rc = osal_condpair_init(&env->defragger.condpair);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    osal_condpair_destroy(&env->flusher.condpair);
+    osal_fastmutex_destroy(&env->group_sync_lock);
+    osal_fastmutex_destroy(&env->dbi_lock);
+    goto bailout;
+  }
+
+  rc = osal_condpair_init(&env->hotmap.condpair);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    osal_condpair_destroy(&env->defragger.condpair);
+    osal_condpair_destroy(&env->flusher.condpair);
+    osal_fastmutex_destroy(&env->group_sync_lock);
+    osal_fastmutex_destroy(&env->dbi_lock);
+    goto bailout;
+  }
+
+#if MDBX_USE_IOURING
+  /* the ioring is created only by a successful env_open(), but destroyed by env_close() anyway */
+  env->ioring.uring.fd = -1;
+#endif /* MDBX_USE_IOURING */
+
 #if defined(_WIN32) || defined(_WIN64)
   imports.srwl_Init(&env->remap_lock);
   InitializeCriticalSection(&env->lck_event_cs);
@@ -7210,6 +9154,10 @@ __cold int mdbx_env_create(MDBX_env **penv) {
 #else
   rc = osal_fastmutex_init(&env->remap_lock);
   if (unlikely(rc != MDBX_SUCCESS)) {
+    osal_condpair_destroy(&env->hotmap.condpair);
+    osal_condpair_destroy(&env->defragger.condpair);
+    osal_condpair_destroy(&env->flusher.condpair);
+    osal_fastmutex_destroy(&env->group_sync_lock);
     osal_fastmutex_destroy(&env->dbi_lock);
     goto bailout;
   }
@@ -7220,6 +9168,10 @@ __cold int mdbx_env_create(MDBX_env **penv) {
 #endif /* MDBX_LOCKING */
   if (unlikely(rc != MDBX_SUCCESS)) {
     osal_fastmutex_destroy(&env->remap_lock);
+    osal_condpair_destroy(&env->hotmap.condpair);
+    osal_condpair_destroy(&env->defragger.condpair);
+    osal_condpair_destroy(&env->flusher.condpair);
+    osal_fastmutex_destroy(&env->group_sync_lock);
     osal_fastmutex_destroy(&env->dbi_lock);
     goto bailout;
   }
@@ -7361,6 +9313,26 @@ __cold int mdbx_env_deleteW(const wchar_t *pathname, MDBX_env_delete_mode_t mode
         err = MDBX_SUCCESS;
     }
 
+    if (err == MDBX_SUCCESS) {
+      pathchar_t *const pgsum_file = pgsum_pathname(dummy_env->pathname.dxb);
+      err = pgsum_file ? osal_removefile(pgsum_file) : MDBX_ENOMEM;
+      osal_free(pgsum_file);
+      if (err == MDBX_SUCCESS)
+        rc = MDBX_SUCCESS;
+      else if (err == MDBX_ENOFILE)
+        err = MDBX_SUCCESS;
+    }
+
+    if (err == MDBX_SUCCESS) {
+      pathchar_t *const hotmap_file = hotmap_pathname(dummy_env->pathname.lck);
+      err = hotmap_file ? osal_removefile(hotmap_file) : MDBX_ENOMEM;
+      osal_free(hotmap_file);
+      if (err == MDBX_SUCCESS)
+        rc = MDBX_SUCCESS;
+      else if (err == MDBX_ENOFILE)
+        err = MDBX_SUCCESS;
+    }
+
     if (err == MDBX_SUCCESS) {
       err = osal_removefile(dummy_env->pathname.lck);
       if (err == MDBX_SUCCESS)
@@ -7527,6 +9499,9 @@ __cold int mdbx_env_resurrect_after_fork(MDBX_env *env) {
 
   if (env->txn)
     txn_abort_after_resurrect(env->basal_txn);
+  env_defragger_stop(env);
+  env_flusher_stop(env);
+  env_hotmap_stop(env, false);
   env->registered_reader_pid = 0;
   int rc = env_close(env, true);
   env->signature.weak = env_signature;
@@ -7560,6 +9535,12 @@ __cold int mdbx_env_close_ex(MDBX_env *env, bool dont_sync) {
     env->flags |= ENV_FATAL_ERROR;
 #endif /* MDBX_ENV_CHECKPID */
 
+  /* the flusher and the defragger hold the write lock while working,
+   * therefore should be stopped before checking the ownership */
+  env_defragger_stop(env);
+  env_flusher_stop(env);
+  env_hotmap_stop(env, true);
+
   if (env->dxb_mmap.base && (env->flags & (MDBX_RDONLY | ENV_FATAL_ERROR)) == 0 && env->basal_txn) {
     if (env->basal_txn->owner && env->basal_txn->owner != osal_thread_self())
       return LOG_IFERR(MDBX_BUSY);
@@ -7597,6 +9578,10 @@ __cold int mdbx_env_close_ex(MDBX_env *env, bool dont_sync) {
   eASSERT0(env, env->signature.weak == 0);
   rc = env_close(env, false) ? MDBX_PANIC : rc;
   ENSURE_OBJ(env, osal_fastmutex_destroy(&env->dbi_lock) == MDBX_SUCCESS);
+  ENSURE_OBJ(env, osal_fastmutex_destroy(&env->group_sync_lock) == MDBX_SUCCESS);
+  ENSURE_OBJ(env, osal_condpair_destroy(&env->flusher.condpair) == MDBX_SUCCESS);
+  ENSURE_OBJ(env, osal_condpair_destroy(&env->defragger.condpair) == MDBX_SUCCESS);
+  ENSURE_OBJ(env, osal_condpair_destroy(&env->hotmap.condpair) == MDBX_SUCCESS);
 #if defined(_WIN32) || defined(_WIN64)
   /* remap_lock don't have destructor (Slim Reader/Writer Lock) */
   DeleteCriticalSection(&env->lck_event_cs);
@@ -7618,6 +9603,8 @@ __cold int mdbx_env_close_ex(MDBX_env *env, bool dont_sync) {
     void *const ptr = ptr_disp(dp, -(ptrdiff_t)sizeof(size_t));
     osal_free(ptr);
   }
+  if (env->stream.buffer)
+    osal_memalign_free(env->stream.buffer);
   VALGRIND_DESTROY_MEMPOOL(env);
   osal_free(env);
 
@@ -7704,6 +9691,7 @@ __must_check_result static int env_info_snap(const MDBX_env *env, const MDBX_txn
     out->mi_geo.current = env->geo_in_bytes.now;
     out->mi_maxreaders = env->max_readers;
     out->mi_dxb_pagesize = env->ps;
+    out->mi_checksum.mode = env->options.page_checksum;
     return MDBX_SUCCESS;
 #else
     /* some users may prefer this behavior: return appropriate error */
@@ -7779,6 +9767,17 @@ __must_check_result static int env_info_snap(const MDBX_env *env, const MDBX_txn
   out->mi_pgop_stat.msync = atomic_load64(&lck->pgops.msync, mo_Relaxed);
   out->mi_pgop_stat.fsync = atomic_load64(&lck->pgops.fsync, mo_Relaxed);
 
+  out->mi_checksum.method = txn_meta->validator_id;
+  out->mi_checksum.mode = env->options.page_checksum;
+  out->mi_checksum.computed = atomic_load64(&lck->pgops.pgsum_computed, mo_Relaxed);
+  out->mi_checksum.verified = atomic_load64(&lck->pgops.pgsum_verified, mo_Relaxed);
+  out->mi_checksum.mismatched = atomic_load64(&lck->pgops.pgsum_mismatch, mo_Relaxed);
+
+  out->mi_rslot.lockfree = atomic_load32(&lck->pgops.rslot.lockfree, mo_Relaxed);
+  out->mi_rslot.locked = atomic_load32(&lck->pgops.rslot.locked, mo_Relaxed);
+  out->mi_rslot.collisions = atomic_load32(&lck->pgops.rslot.collisions, mo_Relaxed);
+  out->mi_rslot.exhausted = atomic_load32(&lck->pgops.rslot.exhausted, mo_Relaxed);
+
   txnid_t overall_latter_reader_txnid = out->mi_recent_txnid;
   txnid_t self_latter_reader_txnid = overall_latter_reader_txnid;
   if (env->lck_mmap.lck) {
@@ -7822,7 +9821,9 @@ __cold int mdbx_env_info_ex(const MDBX_env *env, const MDBX_txn *txn, MDBX_envin
   if (unlikely((env == nullptr && txn == nullptr) || arg == nullptr))
     return LOG_IFERR(MDBX_EINVAL);
 
-  if (unlikely(bytes != sizeof(MDBX_envinfo)))
+  const size_t size_before_checksum = offsetof(MDBX_envinfo, mi_checksum);
+  const size_t size_before_rslot = offsetof(MDBX_envinfo, mi_rslot);
+  if (unlikely(bytes != sizeof(MDBX_envinfo)) && bytes != size_before_checksum && bytes != size_before_rslot)
     return LOG_IFERR(MDBX_EINVAL);
 
   if (txn) {
@@ -7841,7 +9842,13 @@ __cold int mdbx_env_info_ex(const MDBX_env *env, const MDBX_txn *txn, MDBX_envin
   }
 
   troika_t troika;
-  return LOG_IFERR(env_info(env, txn, arg, &troika));
+  if (likely(bytes == sizeof(MDBX_envinfo)))
+    return LOG_IFERR(env_info(env, txn, arg, &troika));
+
+  MDBX_envinfo snap;
+  int err = env_info(env, txn, &snap, &troika);
+  memcpy(arg, &snap, bytes);
+  return LOG_IFERR(err);
 }
 
 __cold int mdbx_preopen_snapinfo(const char *pathname, MDBX_envinfo *out, size_t bytes) {
@@ -7860,7 +9867,9 @@ __cold int mdbx_preopen_snapinfoW(const wchar_t *pathname, MDBX_envinfo *out, si
   if (unlikely(!out))
     return LOG_IFERR(MDBX_EINVAL);
 
-  if (unlikely(bytes != sizeof(MDBX_envinfo)))
+  const size_t size_before_checksum = offsetof(MDBX_envinfo, mi_checksum);
+  const size_t size_before_rslot = offsetof(MDBX_envinfo, mi_rslot);
+  if (unlikely(bytes != sizeof(MDBX_envinfo)) && bytes != size_before_checksum && bytes != size_before_rslot)
     return LOG_IFERR(MDBX_EINVAL);
 
   if (unlikely(!is_powerof2(globals.sys_pagesize) || globals.sys_pagesize < MDBX_MIN_PAGESIZE)) {
@@ -7878,6 +9887,7 @@ __cold int mdbx_preopen_snapinfoW(const wchar_t *pathname, MDBX_envinfo *out, si
   env.lazy_fd = INVALID_HANDLE_VALUE;
   env.dsync_fd = INVALID_HANDLE_VALUE;
   env.fd4meta = INVALID_HANDLE_VALUE;
+  env.pgsum.map.fd = INVALID_HANDLE_VALUE;
 #if defined(_WIN32) || defined(_WIN64)
   env.dxb_lock_event = INVALID_HANDLE_VALUE;
   env.lck_lock_event = INVALID_HANDLE_VALUE;
@@ -7910,6 +9920,8 @@ __cold int mdbx_preopen_snapinfoW(const wchar_t *pathname, MDBX_envinfo *out, si
   out->mi_meta_sign[n] = unaligned_peek_u64(4, &header.sign);
   memcpy(&out->mi_bootid.meta[n], &header.bootid, 16);
   memcpy(&out->mi_dxbid, &header.dxbid, 16);
+  if (bytes > size_before_checksum)
+    out->mi_checksum.method = header.validator_id;
 
 bailout:
   err = env_info_sys(&env, out);
@@ -8174,7 +10186,7 @@ __cold int mdbx_env_set_geometry(MDBX_env *env, intptr_t size_lower, intptr_t si
   } else {
     /* apply new params to opened environment */
     ENSURE_OBJ(env, pagesize == (intptr_t)env->ps);
-    meta_t meta;
+    meta_t meta, stream_base;
     memset(&meta, 0, sizeof(meta));
     if (!env->txn) {
       const meta_ptr_t head = meta_recent(env, &env->basal_txn->wr.troika);
@@ -8189,6 +10201,7 @@ __cold int mdbx_env_set_geometry(MDBX_env *env, intptr_t size_lower, intptr_t si
           goto bailout;
       }
       meta = *head.ptr_c;
+      stream_base = meta;
       const txnid_t txnid = safe64_txnid_next(head.txnid);
       if (unlikely(txnid > MAX_TXNID)) {
         rc = MDBX_TXN_FULL;
@@ -8276,6 +10289,9 @@ __cold int mdbx_env_set_geometry(MDBX_env *env, intptr_t size_lower, intptr_t si
         if (likely(rc == MDBX_SUCCESS)) {
           env->geo_in_bytes.now = pgno2bytes(env, new_geo.now = meta.geometry.now);
           env->geo_in_bytes.upper = pgno2bytes(env, new_geo.upper = meta.geometry.upper);
+          if (copy_commit_streaming(env))
+            /* the replicas must receive the new txnid to keep the stream continuous */
+            copy_commit_stream(env, nullptr, &stream_base, meta_recent(env, &env->basal_txn->wr.troika).ptr_c);
         }
       }
     }
@@ -8303,6 +10319,39 @@ __cold int mdbx_env_sync_ex(MDBX_env *env, bool force, bool nonblock) {
   return LOG_IFERR(env_sync(env, force, nonblock));
 }
 
+int mdbx_env_wait_durable(MDBX_env *env, uint64_t txnid, bool nonblock) {
+  int rc = check_env(env, true);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  if (unlikely(env->flags & MDBX_RDONLY))
+    return LOG_IFERR(MDBX_EACCESS);
+
+  const troika_t troika = meta_tap(env);
+  const meta_ptr_t steady = meta_prefer_steady(env, &troika);
+  if (steady.is_steady && steady.txnid >= txnid)
+    return MDBX_SUCCESS;
+  if (nonblock)
+    return MDBX_RESULT_TRUE;
+
+  if (unlikely(env->basal_txn && env->basal_txn->owner == osal_thread_self()))
+    return LOG_IFERR(MDBX_BUSY);
+  return LOG_IFERR(env_group_sync(env, txnid));
+}
+
+__cold int mdbx_env_set_durable_notify(MDBX_env *env, MDBX_durable_notify_func *func, void *ctx) {
+  int rc = check_env(env, false);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  rc = osal_condpair_lock(&env->flusher.condpair);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+  env->flusher.notify = func;
+  env->flusher.notify_ctx = ctx;
+  return LOG_IFERR(osal_condpair_unlock(&env->flusher.condpair));
+}
+
 __cold int mdbx_env_stat_ex(const MDBX_env *env, const MDBX_txn *txn, MDBX_stat *dest, size_t bytes) {
   if (unlikely(!dest))
     return LOG_IFERR(MDBX_EINVAL);
@@ -8463,6 +10512,7 @@ __cold int mdbx_thread_unregister(const MDBX_env *env) {
     return LOG_IFERR(MDBX_BUSY) /* transaction is still active */;
 
   atomic_store32(&slot->pid, 0, mo_Relaxed);
+  rdt_vacated(env->lck, slot);
   atomic_store32(&env->lck->rdt_refresh_flag, true, mo_AcquireRelease);
   thread_rthc_set(env->me_txkey, nullptr);
   return MDBX_SUCCESS;
@@ -8625,6 +10675,14 @@ __cold int mdbx_gc_info(MDBX_txn *txn, MDBX_gc_info_t *info, size_t bytes, MDBX_
 __cold int mdbx_env_defrag(MDBX_env *env, size_t defrag_atleast, size_t time_atleast_dot16, size_t defrag_enough,
                            size_t time_limit_dot16, intptr_t acceptable_backlash, intptr_t preferred_batch,
                            MDBX_defrag_notify_func progress_callback, void *ctx, MDBX_defrag_result_t *result) {
+  return env_defrag(env, false, defrag_atleast, time_atleast_dot16, defrag_enough, time_limit_dot16,
+                    acceptable_backlash, preferred_batch, progress_callback, ctx, result);
+}
+
+__cold int env_defrag(MDBX_env *env, bool dont_wait, size_t defrag_atleast, size_t time_atleast_dot16,
+                      size_t defrag_enough, size_t time_limit_dot16, intptr_t acceptable_backlash,
+                      intptr_t preferred_batch, MDBX_defrag_notify_func progress_callback, void *ctx,
+                      MDBX_defrag_result_t *result) {
   if (result)
     memset(result, 0, sizeof(*result));
   if (unlikely(defrag_enough < defrag_atleast) && defrag_enough)
@@ -8650,9 +10708,9 @@ __cold int mdbx_env_defrag(MDBX_env *env, size_t defrag_atleast, size_t time_atl
     if (unlikely(rc != MDBX_SUCCESS))
       return LOG_IFERR(rc);
   } else {
-    rc = txn_basal_start(txn = env->basal_txn, MDBX_TXN_READWRITE | MDBX_TXN_NOWEAKING);
+    rc = txn_basal_start(txn = env->basal_txn, MDBX_TXN_READWRITE | MDBX_TXN_NOWEAKING | (dont_wait ? MDBX_TXN_TRY : 0));
     if (unlikely(rc != MDBX_SUCCESS))
-      return LOG_IFERR(rc);
+      return (rc == MDBX_BUSY && dont_wait) ? rc : LOG_IFERR(rc);
     txn->signature = txn_signature;
     txn->userctx = &dfc;
   }
@@ -9115,6 +11173,310 @@ __hot MDBX_cache_result_t mdbx_cache_get_SingleThreaded(const MDBX_txn *txn, MDB
   return cache_get(txn, dbi, key, data, entry);
 }
 
+/*----------------------------------------------------------------------------*/
+
+struct MDBX_hcache {
+  int32_t signature;
+  MDBX_dbi dbi;
+  MDBX_env *env;
+  size_t mask;
+  hcache_header_t *header;
+  hcache_slot_t *slots;
+  osal_mmap_t map;
+};
+
+#define HCACHE_LAYOUT ((uint32_t)sizeof(hcache_slot_t) << 16 | MDBX_HCACHE_WAYS << 8 | (uint32_t)sizeof(size_t))
+
+static uint64_t hcache_hash(const void *ptr, size_t bytes) {
+  uint64_t h = UINT64_C(0x9E3779B97F4A7C15) ^ bytes;
+  while (bytes >= 8) {
+    h = (h ^ unaligned_peek_u64(1, ptr)) * UINT64_C(0xBF58476D1CE4E5B9);
+    h ^= h >> 31;
+    ptr = ptr_disp(ptr, 8);
+    bytes -= 8;
+  }
+  uint64_t tail = 0;
+  memcpy(&tail, ptr, bytes);
+  h = (h ^ tail) * UINT64_C(0x94D049BB133111EB);
+  return h ^ (h >> 29);
+}
+
+static void hcache_confirm(hcache_header_t *header, const txnid_t txnid) {
+  uint64_t confirmed = atomic_load64(&header->confirmed, mo_Relaxed);
+  while (confirmed < txnid && !atomic_cas64(&header->confirmed, confirmed, txnid))
+    confirmed = atomic_load64(&header->confirmed, mo_Relaxed);
+}
+
+/* Stores the entry and the key into the slot, unless the slot was changed
+ * by someone else since the given sequence value was read. */
+static bool hcache_store(hcache_header_t *header, hcache_slot_t *slot, const uint32_t seq, const uint32_t hash,
+                         const MDBX_val *key, const MDBX_cache_entry_t *entry) {
+  if (unlikely((seq & 1) || !atomic_cas32(&slot->seq, seq, seq + 1)))
+    return false;
+
+  if (slot->hash != hash || slot->klen != key->iov_len || memcmp(slot->key, key->iov_base, key->iov_len) != 0) {
+    /* a new key is not referenced yet */
+    slot->hash = hash;
+    slot->klen = (uint16_t)key->iov_len;
+    memcpy(slot->key, key->iov_base, key->iov_len);
+    atomic_store32(&slot->clock, 0, mo_Relaxed);
+  }
+  slot->entry = *entry;
+  atomic_store32(&slot->seq, seq + 2, mo_AcquireRelease);
+  hcache_confirm(header, entry->last_confirmed_txnid);
+  return true;
+}
+
+/* Chooses a slot for a new key within the set, i.e. an empty one if any,
+ * otherwise the first one without the reference bit, while clearing the bits
+ * of passed ones for a second chance. */
+static hcache_slot_t *hcache_victim(hcache_slot_t *set, const uint32_t hash) {
+  STATIC_ASSERT((MDBX_HCACHE_WAYS & (MDBX_HCACHE_WAYS - 1)) == 0);
+  for (size_t i = 0; i < MDBX_HCACHE_WAYS; ++i)
+    if (set[i].klen == 0)
+      return set + i;
+
+  const size_t hand = hash >> 29;
+  for (size_t i = 0; i < MDBX_HCACHE_WAYS; ++i) {
+    hcache_slot_t *const slot = set + ((hand + i) & (MDBX_HCACHE_WAYS - 1));
+    if (atomic_load32(&slot->clock, mo_Relaxed) == 0)
+      return slot;
+    atomic_store32(&slot->clock, 0, mo_Relaxed);
+  }
+  return set + (hand & (MDBX_HCACHE_WAYS - 1));
+}
+
+__hot MDBX_cache_result_t mdbx_hcache_get(const MDBX_txn *txn, MDBX_hcache *cache, const MDBX_val *key,
+                                          MDBX_val *data) {
+  if (unlikely(!cache || !key || !data))
+    return cache_error(LOG_IFERR(MDBX_EINVAL));
+  if (unlikely(cache->signature != hcache_signature))
+    return cache_error(LOG_IFERR(MDBX_EBADSIGN));
+
+  int err = check_txn(txn, MDBX_TXN_BLOCKED);
+  if (unlikely(err != MDBX_SUCCESS))
+    return cache_error(LOG_IFERR(err));
+  if (unlikely(txn->env != cache->env))
+    return cache_error(LOG_IFERR(MDBX_EINVAL));
+
+  if (unlikely(key->iov_len - 1 >= MDBX_HCACHE_KEYMAX))
+    return cache_fallback(txn, cache->dbi, key, data, MDBX_CACHE_UNABLE);
+
+  const uint64_t h = hcache_hash(key->iov_base, key->iov_len);
+  const uint32_t hash = (uint32_t)(h >> 32);
+  hcache_slot_t *const set = cache->slots + (h & cache->mask) * MDBX_HCACHE_WAYS;
+  for (size_t i = 0; i < MDBX_HCACHE_WAYS; ++i) {
+    hcache_slot_t *const slot = set + i;
+    if (slot->hash != hash || slot->klen != key->iov_len)
+      continue;
+
+    const uint32_t seq = atomic_load32(&slot->seq, mo_AcquireRelease);
+    MDBX_cache_entry_t local = slot->entry;
+    const bool match =
+        slot->hash == hash && slot->klen == key->iov_len && memcmp(slot->key, key->iov_base, key->iov_len) == 0;
+    osal_memory_fence(mo_AcquireRelease, false);
+    if (unlikely((seq & 1) || seq != atomic_load32(&slot->seq, mo_Relaxed)))
+      return cache_fallback(txn, cache->dbi, key, data, MDBX_CACHE_RACE);
+    if (!match)
+      continue;
+
+    if (!atomic_load32(&slot->clock, mo_Relaxed))
+      atomic_store32(&slot->clock, 1, mo_Relaxed);
+    MDBX_cache_result_t result = cache_get(txn, cache->dbi, key, data, &local);
+    if (result.status > MDBX_CACHE_HIT && !hcache_store(cache->header, slot, seq, hash, key, &local))
+      result.status = MDBX_CACHE_RACE;
+    return result;
+  }
+
+  MDBX_cache_entry_t local = {.last_confirmed_txnid = 0, .trunk_txnid = 0};
+  MDBX_cache_result_t result = cache_get(txn, cache->dbi, key, data, &local);
+  if (result.status > MDBX_CACHE_HIT) {
+    hcache_slot_t *const slot = hcache_victim(set, hash);
+    if (!hcache_store(cache->header, slot, atomic_load32(&slot->seq, mo_AcquireRelease), hash, key, &local))
+      result.status = MDBX_CACHE_RACE;
+  }
+  return result;
+}
+
+/* Checks the header of the cache and (re)initializes it when the cache is new or stale, i.e. belongs to other
+ * database or its restored copy. The (re)initialization is only allowed for the first/sole user of the cache,
+ * i.e. for a private cache or under the exclusive lock of the cache file, since others may map it. */
+__cold static int hcache_attach(MDBX_hcache *cache, const size_t sets, const uint64_t table_hash, const bool sole) {
+  MDBX_env *const env = cache->env;
+  hcache_header_t *const header = cache->header;
+  const troika_t troika = meta_tap(env);
+  const meta_ptr_t head = meta_recent(env, &troika);
+  if (atomic_load32(&header->state, mo_AcquireRelease) == hcache_ready) {
+    if (unlikely(header->magic_and_version != MDBX_HCACHE_MAGIC || header->layout != HCACHE_LAYOUT ||
+                 header->sets != sets || header->table_hash != table_hash)) {
+      ERROR("hot-key cache mismatch the %s", "layout or table");
+      return MDBX_INCOMPATIBLE;
+    }
+    /* The confirmed txnid is checked only by the sole user, since others could confirm entries
+     * for a transaction which is more recent than the head tapped here. */
+    if (likely(memcmp(&header->dxbid, &head.ptr_c->dxbid, sizeof(bin128_t)) == 0 &&
+               (!sole || atomic_load64(&header->confirmed, mo_AcquireRelease) <= head.txnid)))
+      return MDBX_SUCCESS;
+    if (!sole) {
+      ERROR("hot-key cache mismatch the %s", "database");
+      return MDBX_INCOMPATIBLE;
+    }
+    NOTICE("hot-key cache is stale (confirmed %" PRIaTXN ", recent %" PRIaTXN "), reinitialize it",
+           atomic_load64(&header->confirmed, mo_Relaxed), head.txnid);
+  } else if (!sole) {
+    ERROR("hot-key cache is %s", "not initialized by the first user");
+    return MDBX_BUSY;
+  }
+
+  atomic_store32(&header->state, hcache_initializing, mo_AcquireRelease);
+  memset(cache->slots, 0, sizeof(hcache_slot_t) * MDBX_HCACHE_WAYS * sets);
+  header->magic_and_version = MDBX_HCACHE_MAGIC;
+  header->layout = HCACHE_LAYOUT;
+  header->sets = sets;
+  header->table_hash = table_hash;
+  header->dxbid = head.ptr_c->dxbid;
+  atomic_store64(&header->confirmed, 0, mo_Relaxed);
+  atomic_store32(&header->state, hcache_ready, mo_AcquireRelease);
+  return MDBX_SUCCESS;
+}
+
+__cold static void hcache_release(MDBX_hcache *cache) {
+  cache->signature = 0;
+  if (cache->map.base)
+    osal_munmap(&cache->map);
+  else if (cache->header)
+    osal_memalign_free(cache->header);
+  if (cache->map.fd != INVALID_HANDLE_VALUE)
+    (void)osal_closefile(cache->map.fd);
+  osal_free(cache);
+}
+
+__cold static int hcache_open(MDBX_env *env, MDBX_dbi dbi, size_t budget, const pathchar_t *pathname,
+                              mdbx_mode_t mode, MDBX_hcache **pcache) {
+  STATIC_ASSERT(sizeof(hcache_slot_t) == MDBX_HCACHE_SLOT_SIZE && sizeof(hcache_header_t) == MDBX_HCACHE_SLOT_SIZE);
+  if (unlikely(!pcache))
+    return MDBX_EINVAL;
+  *pcache = nullptr;
+
+  int err = check_env(env, true);
+  if (unlikely(err != MDBX_SUCCESS))
+    return err;
+  if (unlikely(dbi < CORE_DBS ? dbi != MAIN_DBI : (dbi >= env->n_dbi || !(env->dbs_flags[dbi] & DB_VALID))))
+    return MDBX_BAD_DBI;
+
+  const size_t set_bytes = sizeof(hcache_slot_t) * MDBX_HCACHE_WAYS;
+  if (unlikely(budget < sizeof(hcache_header_t) + set_bytes))
+    return MDBX_EINVAL;
+  const size_t limit = (((budget < MAX_MAPSIZE) ? budget : MAX_MAPSIZE) - sizeof(hcache_header_t)) / set_bytes;
+  size_t sets = 1;
+  while (sets <= limit / 2)
+    sets <<= 1;
+
+  MDBX_hcache *cache = osal_calloc(1, sizeof(MDBX_hcache));
+  if (unlikely(!cache))
+    return MDBX_ENOMEM;
+  cache->signature = hcache_signature;
+  cache->env = env;
+  cache->dbi = dbi;
+  cache->map.fd = INVALID_HANDLE_VALUE;
+
+  size_t bytes = sizeof(hcache_header_t) + set_bytes * sets;
+  bool sole = true;
+  if (!pathname) {
+    err = osal_memalign_alloc(globals.sys_pagesize, bytes, (void **)&cache->header);
+    if (unlikely(err != MDBX_SUCCESS))
+      goto bailout;
+    memset(cache->header, 0, sizeof(hcache_header_t));
+  } else {
+    err = osal_openfile(MDBX_OPEN_DXB_LAZY, env, pathname, &cache->map.fd, mode);
+    if (unlikely(err != MDBX_SUCCESS)) {
+      ERROR("unable to open hot-key cache file %" MDBX_PRIsPATH ", err %d", pathname, err);
+      goto bailout;
+    }
+
+    /* the lock is held until the cache is closed, and only the sole user may (re)initialize the cache */
+    err = osal_lockfile_probe(cache->map.fd);
+    if (unlikely(MDBX_IS_ERROR(err))) {
+      ERROR("unable to lock hot-key cache file %" MDBX_PRIsPATH ", err %d", pathname, err);
+      goto bailout;
+    }
+    sole = err == MDBX_RESULT_TRUE;
+
+    uint64_t filesize;
+    err = osal_filesize(cache->map.fd, &filesize);
+    if (unlikely(err != MDBX_SUCCESS))
+      goto bailout;
+    if (filesize) {
+      /* the geometry of the existing cache is preserved */
+      sets = (filesize > sizeof(hcache_header_t)) ? (size_t)((filesize - sizeof(hcache_header_t)) / set_bytes) : 0;
+      if (unlikely(!is_powerof2(sets) || filesize != sizeof(hcache_header_t) + set_bytes * (uint64_t)sets ||
+                   sets > MAX_MAPSIZE / set_bytes)) {
+        ERROR("hot-key cache file %" MDBX_PRIsPATH " has an unexpected size %" PRIu64, pathname, filesize);
+        err = MDBX_INCOMPATIBLE;
+        goto bailout;
+      }
+      bytes = (size_t)filesize;
+    } else if (unlikely(!sole)) {
+      ERROR("hot-key cache is %s", "not initialized by the first user");
+      err = MDBX_BUSY;
+      goto bailout;
+    }
+
+    err = osal_mmap(MDBX_WRITEMAP, &cache->map, bytes, bytes, filesize ? 0 : MMAP_OPTION_SETLENGTH, pathname);
+    if (unlikely(err != MDBX_SUCCESS)) {
+      ERROR("unable to map hot-key cache file %" MDBX_PRIsPATH ", err %d", pathname, err);
+      goto bailout;
+    }
+    cache->header = cache->map.base;
+  }
+
+  cache->mask = sets - 1;
+  cache->slots = ptr_disp(cache->header, sizeof(hcache_header_t));
+  err = hcache_attach(cache, sets, hcache_hash(env->kvs[dbi].name.iov_base, env->kvs[dbi].name.iov_len), sole);
+  if (likely(err == MDBX_SUCCESS) && pathname && sole) {
+    err = osal_lockfile_downgrade(cache->map.fd);
+    if (unlikely(err != MDBX_SUCCESS))
+      ERROR("unable to downgrade lock of hot-key cache file %" MDBX_PRIsPATH ", err %d", pathname, err);
+  }
+  if (likely(err == MDBX_SUCCESS)) {
+    *pcache = cache;
+    return MDBX_SUCCESS;
+  }
+
+bailout:
+  hcache_release(cache);
+  return err;
+}
+
+__cold int mdbx_hcache_open(MDBX_env *env, MDBX_dbi dbi, size_t budget, const char *pathname, mdbx_mode_t mode,
+                            MDBX_hcache **pcache) {
+#if defined(_WIN32) || defined(_WIN64)
+  wchar_t *pathnameW = nullptr;
+  if (pathname) {
+    int err = osal_mb2w(pathname, &pathnameW);
+    if (unlikely(err != MDBX_SUCCESS))
+      return LOG_IFERR(err);
+  }
+  int rc = mdbx_hcache_openW(env, dbi, budget, pathnameW, mode, pcache);
+  osal_free(pathnameW);
+  return LOG_IFERR(rc);
+}
+
+__cold int mdbx_hcache_openW(MDBX_env *env, MDBX_dbi dbi, size_t budget, const wchar_t *pathname, mdbx_mode_t mode,
+                             MDBX_hcache **pcache) {
+#endif /* Windows */
+  return LOG_IFERR(hcache_open(env, dbi, budget, pathname, mode, pcache));
+}
+
+__cold int mdbx_hcache_close(MDBX_hcache *cache) {
+  if (unlikely(!cache))
+    return LOG_IFERR(MDBX_EINVAL);
+  if (unlikely(cache->signature != hcache_signature))
+    return LOG_IFERR(MDBX_EBADSIGN);
+  hcache_release(cache);
+  return MDBX_SUCCESS;
+}
+
 #ifndef LIBMDBX_NO_EXPORTS_LEGACY_API
 
 LIBMDBX_API void mdbx_cache_init(MDBX_cache_entry_t *entry) { __inline_mdbx_cache_init(entry); }
@@ -9670,6 +12032,16 @@ static uint16_t default_subpage_reserve_limit(const MDBX_env *env) {
   return 2753 /* 4.2% */;
 }
 
+static unsigned default_defrag_auto_batch(const MDBX_env *env) {
+  (void)env;
+  return 1024;
+}
+
+static uint32_t default_defrag_auto_time_limit_dot16(const MDBX_env *env) {
+  (void)env;
+  return 6554 /* 100 milliseconds */;
+}
+
 static uint16_t default_merge_threshold_dot16(const MDBX_env *env) {
   (void)env;
   return 65536 / 3 /* 33% */;
@@ -9732,6 +12104,8 @@ void env_options_init(MDBX_env *env) {
   env->options.subpage.room_threshold = default_subpage_room_threshold(env);
   env->options.subpage.reserve_prereq = default_subpage_reserve_prereq(env);
   env->options.subpage.reserve_limit = default_subpage_reserve_limit(env);
+  env->options.defrag_auto_batch = default_defrag_auto_batch(env);
+  env->options.defrag_auto_time_limit_dot16 = default_defrag_auto_time_limit_dot16(env);
 }
 
 void env_options_adjust_dp_limit(MDBX_env *env) {
@@ -10070,6 +12444,94 @@ __cold int mdbx_env_set_option(MDBX_env *env, const MDBX_option_t option, uint64
       env->options.split_reserve_dot16 = (uint16_t)value;
     break;
 
+  case MDBX_opt_page_checksum:
+    if (value == /* default */ UINT64_MAX)
+      value = 0;
+    if (unlikely(value > 2))
+      return LOG_IFERR(MDBX_EINVAL);
+    if (unlikely(env->flags & ENV_ACTIVE) && (value == 0) != (env->options.page_checksum == 0))
+      /* the checksums file is opened/closed together with the environment */
+      return LOG_IFERR(MDBX_EPERM);
+    env->options.page_checksum = (uint8_t)value;
+    env->pgsum.verify = value > 1 && env->pgsum.map.base;
+    break;
+
+  case MDBX_opt_group_commit:
+    if (value == /* default */ UINT64_MAX)
+      env->options.group_commit = false;
+    else if (value > 1)
+      err = MDBX_EINVAL;
+    else
+      env->options.group_commit = value != 0;
+    break;
+
+  case MDBX_opt_defrag_auto_threshold:
+    if (value == /* default */ UINT64_MAX)
+      env->options.defrag_auto_threshold_dot16 = 0;
+    else if (value > 65535)
+      err = MDBX_EINVAL;
+    else
+      env->options.defrag_auto_threshold_dot16 = (uint16_t)value;
+    break;
+
+  case MDBX_opt_defrag_auto_batch:
+    if (value == /* default */ UINT64_MAX)
+      env->options.defrag_auto_batch = default_defrag_auto_batch(env);
+    else if (value > MAX_PAGENO)
+      err = MDBX_EINVAL;
+    else
+      env->options.defrag_auto_batch = (unsigned)value;
+    break;
+
+  case MDBX_opt_defrag_auto_time_limit:
+    if (value == /* default */ UINT64_MAX)
+      env->options.defrag_auto_time_limit_dot16 = default_defrag_auto_time_limit_dot16(env);
+    else if (value > UINT32_MAX)
+      err = MDBX_EINVAL;
+    else
+      env->options.defrag_auto_time_limit_dot16 = (uint32_t)value;
+    break;
+
+  case MDBX_opt_gc_adaptive:
+    if (value == /* default */ UINT64_MAX)
+      env->options.gc_adaptive = false;
+    else if (value > 1)
+      err = MDBX_EINVAL;
+    else
+      env->options.gc_adaptive = value != 0;
+    break;
+
+  case MDBX_opt_spill_policy:
+    if (value == /* default */ UINT64_MAX)
+      env->options.spill_policy = MDBX_spill_lru;
+    else if (value > MDBX_spill_clock)
+      err = MDBX_EINVAL;
+    else
+      env->options.spill_policy = (uint8_t)value;
+    break;
+
+  case MDBX_opt_hotmap_interval:
+    if (value == /* default */ UINT64_MAX)
+      value = 0;
+    if (unlikely(value > UINT32_MAX))
+      err = MDBX_EINVAL;
+    else if (!MDBX_USE_MINCORE && value)
+      /* the residency of pages can't be sampled without mincore() */
+      err = MDBX_ENOSYS;
+    else {
+      /* the interval is read by the hotmap thread under the condpair lock */
+      osal_condpair_lock(&env->hotmap.condpair);
+      env->options.hotmap_interval_dot16 = (uint32_t)value;
+      osal_condpair_unlock(&env->hotmap.condpair);
+      if (env->flags & ENV_ACTIVE) {
+        if (value)
+          env_hotmap_start(env);
+        else
+          env_hotmap_stop(env, false);
+      }
+    }
+    break;
+
   default:
     return LOG_IFERR(MDBX_EINVAL);
   }
@@ -10180,6 +12642,38 @@ __cold int mdbx_env_get_option(const MDBX_env *env, const MDBX_option_t option,
     *pvalue = env->options.split_reserve_dot16;
     break;
 
+  case MDBX_opt_page_checksum:
+    *pvalue = env->options.page_checksum;
+    break;
+
+  case MDBX_opt_group_commit:
+    *pvalue = env->options.group_commit;
+    break;
+
+  case MDBX_opt_defrag_auto_threshold:
+    *pvalue = env->options.defrag_auto_threshold_dot16;
+    break;
+
+  case MDBX_opt_defrag_auto_batch:
+    *pvalue = env->options.defrag_auto_batch;
+    break;
+
+  case MDBX_opt_defrag_auto_time_limit:
+    *pvalue = env->options.defrag_auto_time_limit_dot16;
+    break;
+
+  case MDBX_opt_gc_adaptive:
+    *pvalue = env->options.gc_adaptive;
+    break;
+
+  case MDBX_opt_spill_policy:
+    *pvalue = env->options.spill_policy;
+    break;
+
+  case MDBX_opt_hotmap_interval:
+    *pvalue = env->options.hotmap_interval_dot16;
+    break;
+
   default:
     return LOG_IFERR(MDBX_EINVAL);
   }
@@ -10678,6 +13172,62 @@ int mdbx_get_ex(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, MDBX_val *data
   return MDBX_SUCCESS;
 }
 
+/* For an ascending batch of keys predicts that the next key is on the right sibling of the current leaf,
+ * and prefetches such page while the current key is being completed. */
+static inline void get_many_prefetch(const MDBX_cursor *mc, const MDBX_val *next) {
+  const page_t *const mp = mc->pg[mc->top];
+  if (mc->top < 1 || is_dupfix_leaf(mp))
+    return;
+  const MDBX_val last = get_key(page_node(mp, page_numkeys(mp) - 1));
+  if (mc->clc->k.cmp(next, &last) <= 0)
+    return;
+  const page_t *const parent = mc->pg[mc->top - 1];
+  const size_t ki = mc->ki[mc->top - 1] + 1;
+  if (ki < page_numkeys(parent)) {
+    const MDBX_env *const env = mc->txn->env;
+    const pgno_t pgno = node_pgno(page_node(parent, ki));
+    if (likely(pgno < mc->txn->geo.first_unallocated)) {
+      const page_t *const sibling = pgno2page(env, pgno);
+      __prefetch(sibling);
+      __prefetch(ptr_disp(sibling, env->ps >> 1));
+    }
+  }
+}
+
+int mdbx_get_many(const MDBX_txn *txn, MDBX_dbi dbi, const MDBX_val *keys, size_t count, MDBX_val *values,
+                  int *statuses) {
+  if (unlikely((!keys || !values) && count))
+    return LOG_IFERR(MDBX_EINVAL);
+
+  int rc = check_txn(txn, MDBX_TXN_BLOCKED);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  cursor_couple_t cx;
+  rc = cursor_init(&cx.outer, txn, dbi);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  /* The same cursor is used for all the keys, so cursor_seek() stays on the current leaf when it possible,
+   * and otherwise tree_search() climbs up only as far as the lowest common ancestor page. */
+  for (size_t i = 0; i < count; ++i) {
+    cx.outer.flags |= z_tree_search_fastpath;
+    const int err = cursor_seek(&cx.outer, (MDBX_val *)&keys[i], &values[i], MDBX_SET).err;
+    if (likely(err == MDBX_SUCCESS)) {
+      if (i + 1 < count)
+        get_many_prefetch(&cx.outer, &keys[i + 1]);
+    } else if (err == MDBX_NOTFOUND) {
+      values[i].iov_base = nullptr;
+      values[i].iov_len = 0;
+      rc = MDBX_NOTFOUND;
+    } else
+      return LOG_IFERR(err);
+    if (statuses)
+      statuses[i] = err;
+  }
+  return LOG_IFERR(rc);
+}
+
 /*----------------------------------------------------------------------------*/
 
 int mdbx_canary_put(MDBX_txn *txn, const MDBX_canary *canary) {
@@ -10851,6 +13401,45 @@ int mdbx_put(MDBX_txn *txn, MDBX_dbi dbi, const MDBX_val *key, MDBX_val *data, M
   return LOG_IFERR(rc);
 }
 
+int mdbx_table_bulk_load(MDBX_txn *txn, MDBX_dbi dbi, MDBX_bulk_load_func source, void *context,
+                         unsigned fill_percent) {
+  if (unlikely(!source || (fill_percent && (fill_percent < 50 || fill_percent > 100))))
+    return LOG_IFERR(MDBX_EINVAL);
+
+  if (unlikely(dbi <= FREE_DBI))
+    return LOG_IFERR(MDBX_BAD_DBI);
+
+  int rc = check_txn_rw(txn, MDBX_TXN_BLOCKED);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  cursor_couple_t cx;
+  rc = cursor_init(&cx.outer, txn, dbi);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  cx.outer.next = txn->cursors[dbi];
+  txn->cursors[dbi] = &cx.outer;
+
+  if (cx.outer.tree->height == 0 && (cx.outer.tree->flags & MDBX_DUPSORT) == 0)
+    rc = cursor_bulk_load(&cx.outer, source, context, fill_percent ? fill_percent : 100);
+  else {
+    /* Для непустых таблиц и таблиц с дубликатами выполняется обычное добавление в конец. */
+    const unsigned flags = (cx.outer.tree->flags & MDBX_DUPSORT) ? MDBX_APPEND | MDBX_APPENDDUP : MDBX_APPEND;
+    MDBX_val key, data;
+    while ((rc = source(context, &key, &data)) == MDBX_SUCCESS) {
+      rc = cursor_put_checklen(&cx.outer, &key, &data, flags);
+      if (unlikely(rc != MDBX_SUCCESS))
+        break;
+    }
+    if (rc == MDBX_NOTFOUND)
+      rc = MDBX_SUCCESS;
+  }
+  txn->cursors[dbi] = cx.outer.next;
+
+  return LOG_IFERR(rc);
+}
+
 //------------------------------------------------------------------------------
 
 /* Позволяет обновить или удалить существующую запись с получением
@@ -11453,7 +14042,7 @@ done:
   return LOG_IFERR(rc);
 }
 
-int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency) {
+static int txn_commit_api(MDBX_txn *txn, MDBX_commit_latency *latency, txnid_t *async) {
   STATIC_ASSERT(MDBX_TXN_FINISHED == MDBX_TXN_BLOCKED - MDBX_TXN_HAS_CHILD - MDBX_TXN_ERROR - MDBX_TXN_PARKED);
 
   struct commit_timestamp ts;
@@ -11461,7 +14050,7 @@ int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency) {
 
   int rc = check_txn(txn, MDBX_TXN_FINISHED);
   if (unlikely(rc != MDBX_SUCCESS)) {
-    if (rc == MDBX_BAD_TXN && F_ISSET(txn->flags, MDBX_TXN_FINISHED | txn_ro_flat)) {
+    if (rc == MDBX_BAD_TXN && F_ISSET(txn->flags, MDBX_TXN_FINISHED | txn_ro_flat) && !async) {
       rc = MDBX_RESULT_TRUE;
       mdbx_txn_abort(txn);
       goto done;
@@ -11474,6 +14063,9 @@ int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency) {
   if (unlikely(rc != MDBX_SUCCESS))
     return LOG_IFERR(rc);
 
+  if (async && unlikely(txn != env->basal_txn))
+    return LOG_IFERR(MDBX_EINVAL);
+
 #if MDBX_TXN_CHECKOWNER
   if ((txn->flags & MDBX_NOSTICKYTHREADS) && txn == env->basal_txn && unlikely(txn->owner != osal_thread_self())) {
     mdbx_txn_break(txn);
@@ -11491,12 +14083,27 @@ int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency) {
     }
   }
 
-  rc = txn_commit(txn, latency, latency ? &ts : nullptr);
+  const bool defrag_auto = txn == env->basal_txn && env->options.defrag_auto_threshold_dot16;
+  rc = txn_commit(txn, latency, latency ? &ts : nullptr, async);
+  if (defrag_auto && rc == MDBX_SUCCESS)
+    env_defragger_kick(env);
 done:
   txn_latency_done(latency, &ts);
   return LOG_IFERR(rc);
 }
 
+int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency) { return txn_commit_api(txn, latency, nullptr); }
+
+int mdbx_txn_commit_async(MDBX_txn *txn, MDBX_commit_latency *latency, uint64_t *committed_txnid) {
+  txnid_t txnid = 0;
+  int rc = txn_commit_api(txn, latency, &txnid);
+  if (committed_txnid)
+    *committed_txnid = txnid;
+  if (likely(rc == MDBX_SUCCESS) && txnid && mdbx_env_wait_durable(txn->env, txnid, true) != MDBX_SUCCESS)
+    rc = LOG_IFERR(env_flusher_kick(txn->env, txnid));
+  return rc;
+}
+
 int mdbx_txn_info(const MDBX_txn *txn, MDBX_txn_info *info, bool scan_rlt) {
   int rc = check_txn(txn, MDBX_TXN_FINISHED);
   if (unlikely(rc != MDBX_SUCCESS))
@@ -11538,6 +14145,7 @@ int mdbx_txn_info(const MDBX_txn *txn, MDBX_txn_info *info, bool scan_rlt) {
 
     info->txn_reader_lag = head.txnid - info->txn_id;
     info->txn_space_dirty = info->txn_space_retired = 0;
+    info->txn_spilled = info->txn_unspilled = 0;
     uint64_t reader_snapshot_pages_retired = 0;
     if (txn->ro.slot &&
         ((txn->flags & MDBX_TXN_PARKED) == 0 || safe64_read(&txn->ro.slot->tid) != MDBX_TID_TXN_OUSTED) &&
@@ -11582,6 +14190,8 @@ int mdbx_txn_info(const MDBX_txn *txn, MDBX_txn_info *info, bool scan_rlt) {
     info->txn_space_retired =
         pgno2bytes(env, txn->nested ? (size_t)txn->wr.retired_pages : pnl_size(txn->wr.retired_pages));
     info->txn_space_leftover = pgno2bytes(env, txn->wr.dirtyroom);
+    info->txn_spilled = txn->wr.spill_stat.spilled;
+    info->txn_unspilled = txn->wr.spill_stat.unspilled;
     info->txn_space_dirty =
         pgno2bytes(env, txn->wr.dirtylist ? txn->wr.dirtylist->pages_including_loose
                                           : (txn->wr.writemap_dirty_npages + txn->wr.writemap_spilled_npages));
@@ -11906,7 +14516,6 @@ typedef struct MDBX_chk_internal {
   bool got_break;
   bool write_locked;
   uint8_t scope_depth;
-  pgno_t last_nested_root;
 
   MDBX_chk_table_t table_gc, table_main;
   int16_t *pagemap;
@@ -12507,12 +15116,19 @@ __cold static void chk_verbose_meta(MDBX_chk_scope_t *const scope, const unsigne
   }
 }
 
+/* The state of a page walker, which depends on the order of walking. */
+typedef struct chk_walker {
+  MDBX_chk_scope_t *scope;
+  pgno_t last_nested_root;
+} chk_walker_t;
+
 __cold static int chk_pgvisitor(const size_t pgno, const unsigned npages, void *const ctx, const unsigned deep,
                                 const walk_tbl_t *tbl_info, const size_t page_size, const page_type_t pagetype,
                                 const txnid_t page_txnid, const MDBX_error_t page_err, const size_t nentries,
                                 const size_t payload_bytes, const size_t header_bytes, const size_t unused_bytes,
                                 const size_t parent_pgno) {
-  MDBX_chk_scope_t *const scope = ctx;
+  chk_walker_t *const walker = ctx;
+  MDBX_chk_scope_t *const scope = walker->scope;
   MDBX_chk_internal_t *const chk = scope->internal;
   MDBX_chk_context_t *const usr = chk->usr;
   MDBX_env *const env = usr->env;
@@ -12617,9 +15233,9 @@ __cold static int chk_pgvisitor(const size_t pgno, const unsigned npages, void *
       pagetype_caption = (pagetype == page_leaf) ? "nested-leaf" : "nested-leaf-dupfix";
       tbl->pages.nested_leaf += 1;
       density = &tbl->histogram.large_or_nested_density;
-      if (chk->last_nested_root != nested->root) {
+      if (walker->last_nested_root != nested->root) {
         histogram_acc(height, &tbl->histogram.nested_height_or_gc_span_length);
-        chk->last_nested_root = nested->root;
+        walker->last_nested_root = nested->root;
       }
       if (height != nested->height)
         chk_object_issue(scope, "page", pgno, "wrong nested-tree height", "actual %i != %i dupsort-node %s, parent %zu",
@@ -12737,7 +15353,25 @@ __cold static int chk_tree(MDBX_chk_scope_t *const scope) {
   /* always skip key ordering checking
    * to avoid MDBX_CORRUPTED in case custom comparators were used */
   usr->result.processed_pages = NUM_METAS;
-  int err = walk_pages(txn, chk_pgvisitor, scope, dont_check_keys_ordering);
+  int err;
+  if (usr->walk_threads > 1) {
+    const size_t threads = usr->walk_threads;
+    chk_walker_t *const walkers = osal_calloc(threads, sizeof(chk_walker_t));
+    void **const users = osal_calloc(threads, sizeof(void *));
+    if (likely(walkers && users)) {
+      for (size_t i = 0; i < threads; ++i) {
+        walkers[i].scope = scope;
+        users[i] = walkers + i;
+      }
+      err = walk_pages_parallel(txn, chk_pgvisitor, users, threads, dont_check_keys_ordering);
+    } else
+      err = MDBX_ENOMEM;
+    osal_free(users);
+    osal_free(walkers);
+  } else {
+    chk_walker_t walker = {.scope = scope};
+    err = walk_pages(txn, chk_pgvisitor, &walker, dont_check_keys_ordering);
+  }
   if (err != MDBX_SUCCESS) {
     chk_error_rc(scope, err, "walk_pages");
     return err;
@@ -14405,6 +17039,203 @@ __hot int cursor_touch(MDBX_cursor *const mc, const MDBX_val *key, const MDBX_va
 
 /*----------------------------------------------------------------------------*/
 
+/* Построение b-дерева снизу-вверх из упорядоченной последовательности пар ключ-значение.
+ *
+ * Листовые страницы заполняются последовательно до заданного порога, а при заведении очередной страницы
+ * её первый ключ добавляется разделителем в крайнюю правую страницу вышележащего уровня, которая в свою очередь
+ * заводится по мере необходимости. Таким образом дерево остаётся согласованным после добавления каждой пары,
+ * а на каждую пару приходится только сравнение с предыдущим ключом и копирование, без поиска, split-а страниц
+ * и перемещения узлов. */
+typedef struct bulk_builder {
+  MDBX_cursor *mc;
+  /* порог заполнения листовых страниц в байтах */
+  size_t fill_limit;
+  /* текущая высота дерева */
+  size_t height;
+  /* крайние правые страницы каждого уровня, начиная с листового */
+  page_t *tail[CURSOR_STACK_SIZE];
+} bulk_builder_t;
+
+/* Отражает крайний правый путь строящегося дерева в стеке курсора, чтобы страницы этого пути не выталкивались
+ * при spilling-е, а также устанавливает вершину стека на страницу заданного уровня для node_add_xyz(). */
+static void bulk_focus(bulk_builder_t *bb, const size_t level) {
+  MDBX_cursor *const mc = bb->mc;
+  cASSERT0(mc, level < bb->height);
+  for (size_t i = 0; i < bb->height; ++i) {
+    page_t *const mp = bb->tail[bb->height - 1 - i];
+    const size_t nkeys = page_numkeys(mp);
+    mc->pg[i] = mp;
+    mc->ki[i] = (indx_t)(nkeys ? nkeys - 1 : 0);
+  }
+  mc->top = (int8_t)(bb->height - 1 - level);
+  mc->flags &= z_clear_mask;
+}
+
+/* Добавляет на уровень level ссылку на новую страницу pgno, которая следует за текущей крайней правой страницей
+ * нижележащего уровня и начинается с ключа key. */
+static int bulk_link(bulk_builder_t *bb, const size_t level, const MDBX_val *key, const pgno_t pgno) {
+  MDBX_cursor *const mc = bb->mc;
+  cASSERT0(mc, level > 0 && level <= bb->height);
+  int err;
+  if (level == bb->height) {
+    /* new root */
+    if (unlikely(level >= CURSOR_STACK_SIZE - 1))
+      return MDBX_CURSOR_FULL;
+    const pgr_t npr = page_new(mc, P_BRANCH);
+    if (unlikely(npr.err != MDBX_SUCCESS))
+      return npr.err;
+    bb->tail[level] = npr.page;
+    bb->height += 1;
+    mc->tree->root = npr.page->pgno;
+    mc->tree->height = (uint16_t)bb->height;
+    bulk_focus(bb, level);
+    err = node_add_branch(mc, 0, nullptr, bb->tail[level - 1]->pgno);
+    return likely(err == MDBX_SUCCESS) ? node_add_branch(mc, 1, key, pgno) : err;
+  }
+
+  page_t *const mp = bb->tail[level];
+  if (likely(branch_size(mc->txn->env, key) <= page_room(mp))) {
+    bulk_focus(bb, level);
+    return node_add_branch(mc, page_numkeys(mp), key, pgno);
+  }
+
+  /* Страница заполнена. Последний узел переносится на новую страницу вместе с добавляемым,
+   * так как в странице ветвления должно быть не менее двух узлов. */
+  const pgr_t npr = page_new(mc, P_BRANCH);
+  if (unlikely(npr.err != MDBX_SUCCESS))
+    return npr.err;
+  const size_t last = page_numkeys(mp) - 1;
+  cASSERT0(mc, last >= 2);
+  const node_t *const node = page_node(mp, last);
+  const pgno_t child = node_pgno(node);
+  const MDBX_val separator = {.iov_base = node_key(node), .iov_len = node_ks(node)};
+  err = bulk_link(bb, level + 1, &separator, npr.page->pgno);
+  if (unlikely(err != MDBX_SUCCESS))
+    return err;
+
+  bulk_focus(bb, level);
+  mc->ki[mc->top] = (indx_t)last;
+  node_del(mc, 0);
+  bb->tail[level] = npr.page;
+  bulk_focus(bb, level);
+  err = node_add_branch(mc, 0, nullptr, child);
+  return likely(err == MDBX_SUCCESS) ? node_add_branch(mc, 1, key, pgno) : err;
+}
+
+static int bulk_append(bulk_builder_t *bb, const MDBX_val *key, MDBX_val *data) {
+  MDBX_cursor *const mc = bb->mc;
+  MDBX_env *const env = mc->txn->env;
+  const size_t bytes = leaf_size(env, key, data);
+  page_t *mp = bb->height ? bb->tail[0] : nullptr;
+  if (!mp || bytes > page_room(mp) || page_used(env, mp) + bytes > bb->fill_limit) {
+    const pgr_t npr = page_new(mc, P_LEAF);
+    if (unlikely(npr.err != MDBX_SUCCESS))
+      return npr.err;
+    if (mp) {
+      int err = bulk_link(bb, 1, key, npr.page->pgno);
+      if (unlikely(err != MDBX_SUCCESS))
+        return err;
+    } else {
+      bb->height = 1;
+      mc->tree->root = npr.page->pgno;
+      mc->tree->height = 1;
+    }
+    bb->tail[0] = mp = npr.page;
+  }
+
+  bulk_focus(bb, 0);
+  int err = node_add_leaf(mc, page_numkeys(mp), key, data, 0);
+  if (likely(err == MDBX_SUCCESS))
+    mc->tree->items += 1;
+  return err;
+}
+
+int cursor_bulk_load(MDBX_cursor *mc, MDBX_bulk_load_func source, void *context, unsigned fill_percent) {
+  cASSERT0(mc, (mc->flags & z_inner) == 0 && (mc->tree->flags & MDBX_DUPSORT) == 0);
+  cASSERT0(mc, mc->tree->height == 0 && mc->tree->items == 0 && is_poor(mc));
+  cASSERT0(mc, fill_percent >= 50 && fill_percent <= 100);
+  cASSERT1(mc, cursor_is_tracked(mc));
+  MDBX_txn *const txn = mc->txn;
+  MDBX_env *const env = txn->env;
+
+  bulk_builder_t bb;
+  bb.mc = mc;
+  bb.height = 0;
+  bb.fill_limit = page_space(env) * fill_percent / 100;
+
+  int err = MDBX_SUCCESS;
+  if ((*cursor_dbi_state(mc) & DBI_DIRTY) == 0) {
+    err = touch_dbi(mc);
+    if (unlikely(err != MDBX_SUCCESS))
+      goto bailout;
+  }
+
+  while (true) {
+    MDBX_val key, data;
+    err = source(context, &key, &data);
+    if (err != MDBX_SUCCESS) {
+      if (err == MDBX_NOTFOUND)
+        err = MDBX_SUCCESS;
+      break;
+    }
+
+    if (unlikely(key.iov_len > mc->clc->k.lmax || key.iov_len < mc->clc->k.lmin ||
+                 data.iov_len > mc->clc->v.lmax || data.iov_len < mc->clc->v.lmin)) {
+      err = MDBX_BAD_VALSIZE;
+      break;
+    }
+
+    uint64_t aligned_keybytes;
+    if (mc->tree->flags & MDBX_INTEGERKEY) {
+      if (key.iov_len == 8) {
+        if (unlikely(7 & (uintptr_t)key.iov_base))
+          key.iov_base = bcopy_8(&aligned_keybytes, key.iov_base);
+      } else if (key.iov_len == 4) {
+        if (unlikely(3 & (uintptr_t)key.iov_base))
+          key.iov_base = bcopy_4(&aligned_keybytes, key.iov_base);
+      } else {
+        err = MDBX_BAD_VALSIZE;
+        break;
+      }
+      mc->clc->k.lmin = mc->clc->k.lmax = key.iov_len;
+    }
+
+    if (bb.height) {
+      const page_t *const leaf = bb.tail[0];
+      const node_t *const node = page_node(leaf, page_numkeys(leaf) - 1);
+      const MDBX_val last = {.iov_base = node_key(node), .iov_len = node_ks(node)};
+      if (unlikely(mc->clc->k.cmp(&key, &last) <= 0)) {
+        err = MDBX_EKEYMISMATCH;
+        break;
+      }
+      bulk_focus(&bb, 0);
+    }
+
+    /* Оценка количества страниц, которые могут потребоваться для добавления пары, аналогично cursor_touch():
+     * по одной на каждый уровень с запасом на рост высоты, для large-страницы и для обновления GC и MainDB. */
+    txn_dpl_lru_turn(txn);
+    const size_t need = (bb.height + 3) * 2 + txn->dbs[FREE_DBI].height + txn->dbs[MAIN_DBI].height + 6 +
+                        bytes2pgno(env, node_size(&key, &data)) + 1;
+    err = txn_spill(txn, mc, need);
+    if (unlikely(err != MDBX_SUCCESS))
+      goto bailout;
+
+    err = bulk_append(&bb, &key, &data);
+    if (unlikely(err != MDBX_SUCCESS))
+      goto bailout;
+  }
+
+  be_poor(mc);
+  return err;
+
+bailout:
+  be_poor(mc);
+  txn->flags |= MDBX_TXN_ERROR;
+  return err;
+}
+
+/*----------------------------------------------------------------------------*/
+
 int cursor_shadow(MDBX_cursor *cursor, MDBX_txn *nested, const size_t dbi) {
   tASSERT0(nested, cursor->signature == cur_signature_live);
   tASSERT0(nested, cursor->txn != nested);
@@ -19605,7 +22436,7 @@ __noinline void txn_dpl_lru_reduce(MDBX_txn *txn) {
     dpl_t *dl = txn->wr.dirtylist;
     for (size_t i = 1; i <= dl->length; ++i) {
       size_t *const ptr = ptr_disp(dl->items[i].ptr, -(ptrdiff_t)sizeof(size_t));
-      *ptr >>= 1;
+      *ptr = ((*ptr & ~(size_t)DPL_LRU_REFBIT) >> 1) | (*ptr & DPL_LRU_REFBIT);
     }
     txn = txn->parent;
   } while (txn);
@@ -20200,6 +23031,39 @@ __cold int dxb_set_readahead(const MDBX_env *env, const pgno_t edge, const bool
   return err;
 }
 
+/* Асинхронная подсказка ядру о скором обращении к страницам, т.е. без ожидания их чтения с диска. */
+void dxb_prefetch(const MDBX_env *env, const pgno_t pgno, const size_t npages) {
+  const size_t limit = env->dxb_mmap.current;
+  const size_t offset = floor_powerof2(pgno2bytes(env, pgno), globals.sys_pagesize);
+  if (unlikely(offset >= limit))
+    return;
+  size_t length = ceil_powerof2(pgno2bytes(env, pgno + npages), globals.sys_pagesize);
+  length = ((length < limit) ? length : limit) - offset;
+
+#if defined(F_RDADVISE)
+  /* NOTE: MADV_WILLNEED with offset != 0 may cause SIGBUS on Darwin, see dxb_set_readahead() */
+  struct radvisory hint;
+  hint.ra_offset = offset;
+  hint.ra_count = (int)length;
+  (void)fcntl(env->lazy_fd, F_RDADVISE, &hint);
+#elif defined(MADV_WILLNEED)
+  (void)madvise(ptr_disp(env->dxb_mmap.base, offset), length, MADV_WILLNEED);
+#elif defined(POSIX_MADV_WILLNEED)
+  (void)posix_madvise(ptr_disp(env->dxb_mmap.base, offset), length, POSIX_MADV_WILLNEED);
+#elif defined(_WIN32) || defined(_WIN64)
+  if (imports.PrefetchVirtualMemory) {
+    WIN32_MEMORY_RANGE_ENTRY hint;
+    hint.VirtualAddress = ptr_disp(env->dxb_mmap.base, offset);
+    hint.NumberOfBytes = length;
+    (void)imports.PrefetchVirtualMemory(GetCurrentProcess(), 1, &hint, 0);
+  }
+#elif defined(POSIX_FADV_WILLNEED)
+  (void)posix_fadvise(env->lazy_fd, offset, length, POSIX_FADV_WILLNEED);
+#else
+  (void)length;
+#endif
+}
+
 __cold int dxb_setup(MDBX_env *env, const int lck_rc, const mdbx_mode_t mode_bits) {
   meta_t header;
   eASSERT0(env, !(env->flags & ENV_ACTIVE));
@@ -20224,7 +23088,7 @@ __cold int dxb_setup(MDBX_env *env, const int lck_rc, const mdbx_mode_t mode_bit
     if (unlikely(err != MDBX_SUCCESS))
       return err;
 
-    header = *meta_init_triplet(env, env->page_auxbuf);
+    header = *meta_init_triplet(env, env->page_auxbuf, nullptr);
     err = osal_pwrite(env->lazy_fd, env->page_auxbuf, env->ps * (size_t)NUM_METAS, 0);
     if (unlikely(err != MDBX_SUCCESS))
       return err;
@@ -20587,6 +23451,7 @@ __cold int dxb_setup(MDBX_env *env, const int lck_rc, const mdbx_mode_t mode_bit
                 recent_pgno, recent.txnid, header.unsafe_txnid);
           return MDBX_PROBLEM;
         }
+        const meta_t stream_base = *recent.ptr_c;
         meta_set_txnid(env, &header, next_txnid);
         err = dxb_sync_locked(env, env->flags | txn_shrink_allowed, &header, &troika);
         if (err) {
@@ -20599,6 +23464,8 @@ __cold int dxb_setup(MDBX_env *env, const int lck_rc, const mdbx_mode_t mode_bit
                 pv2pages(header.geometry.grow_pv), header.unsafe_txnid);
           return err;
         }
+        if (copy_commit_streaming(env))
+          copy_commit_stream(env, nullptr, &stream_base, meta_recent(env, &troika).ptr_c);
       }
     }
 
@@ -20804,6 +23671,13 @@ int dxb_sync_locked(MDBX_env *env, unsigned flags, meta_t *const pending, troika
     }
   }
 
+  if (env->pgsum.dirty && (flags & MDBX_SAFE_NOSYNC) == 0) {
+    /* checksums should be durable not later than the steady meta-page */
+    rc = pgsum_sync(env);
+    if (unlikely(rc != MDBX_SUCCESS))
+      goto fail;
+  }
+
   /* LY: step#1 - sync previously written/updated data-pages */
   rc = MDBX_RESULT_FALSE /* carry steady */;
   const uint64_t snap_unsynced_pages = atomic_load64(&env->lck->unsynced_pages, mo_Relaxed);
@@ -21213,6 +24087,338 @@ bailout:
   return rc;
 }
 
+int env_group_sync(MDBX_env *env, txnid_t txnid) {
+  /* Writers of the process are queued on the group_sync_lock, while the first
+   * one makes durable all transactions committed to that moment. Therefore the
+   * others likely will find their transactions already covered by the steady
+   * meta-page and will return without any sync. */
+  int rc = osal_fastmutex_acquire(&env->group_sync_lock);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  troika_t troika = meta_tap(env);
+  meta_ptr_t steady = meta_prefer_steady(env, &troika);
+  if (!steady.is_steady || steady.txnid < txnid) {
+    /* The write lock is acquired explicitly, since with MDBX_NOSTICKYTHREADS
+     * the env_sync() treats a write transaction of any thread as owned. */
+    rc = lck_txn_lock(env, false);
+    if (likely(rc == MDBX_SUCCESS)) {
+      troika = env->basal_txn->wr.troika = meta_tap(env);
+      steady = meta_prefer_steady(env, &troika);
+      if (!steady.is_steady || steady.txnid < txnid) {
+        rc = env_sync(env, true, false);
+        if (rc == MDBX_RESULT_TRUE)
+          rc = MDBX_SUCCESS;
+      }
+      lck_txn_unlock(env);
+    }
+  }
+
+  int err = osal_fastmutex_release(&env->group_sync_lock);
+  return (rc == MDBX_SUCCESS) ? err : rc;
+}
+
+/* Background thread which makes durable the asynchronously committed
+ * transactions, see mdbx_txn_commit_async(). */
+static THREAD_RESULT THREAD_CALL env_flusher_thread(void *arg) {
+  MDBX_env *const env = arg;
+  osal_condpair_lock(&env->flusher.condpair);
+  while (true) {
+    while (!env->flusher.pending && !env->flusher.stop) {
+      int err = osal_condpair_wait(&env->flusher.condpair, true);
+      if (unlikely(err != MDBX_SUCCESS)) {
+        ERROR("flusher: wait error %d", err);
+        goto bailout;
+      }
+    }
+    /* pending transactions are made durable even when stopping */
+    const txnid_t txnid = env->flusher.pending;
+    if (!txnid)
+      break;
+    env->flusher.pending = 0;
+    osal_condpair_unlock(&env->flusher.condpair);
+
+    const int err = env_group_sync(env, txnid);
+    const troika_t troika = meta_tap(env);
+    const meta_ptr_t steady = meta_prefer_steady(env, &troika);
+    if (unlikely(err != MDBX_SUCCESS))
+      ERROR("flusher: sync txn %" PRIaTXN " error %d", txnid, err);
+
+    osal_condpair_lock(&env->flusher.condpair);
+    MDBX_durable_notify_func *const notify = env->flusher.notify;
+    void *const notify_ctx = env->flusher.notify_ctx;
+    if (notify) {
+      osal_condpair_unlock(&env->flusher.condpair);
+      notify(env, notify_ctx, steady.is_steady ? steady.txnid : 0, err);
+      osal_condpair_lock(&env->flusher.condpair);
+    }
+  }
+bailout:
+  osal_condpair_unlock(&env->flusher.condpair);
+  return (THREAD_RESULT)0;
+}
+
+int env_flusher_kick(MDBX_env *env, txnid_t txnid) {
+  int rc = osal_condpair_lock(&env->flusher.condpair);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+  if (!env->flusher.running) {
+    env->flusher.stop = false;
+    rc = osal_thread_create(&env->flusher.thread, env_flusher_thread, env);
+    env->flusher.running = rc == MDBX_SUCCESS;
+  }
+  if (likely(rc == MDBX_SUCCESS)) {
+    if (env->flusher.pending < txnid)
+      env->flusher.pending = txnid;
+    rc = osal_condpair_signal(&env->flusher.condpair, true);
+  }
+  int err = osal_condpair_unlock(&env->flusher.condpair);
+  return (rc == MDBX_SUCCESS) ? err : rc;
+}
+
+void env_flusher_stop(MDBX_env *env) {
+  if (!env->flusher.running)
+    return;
+  if (likely(env->pid == osal_getpid())) {
+    osal_condpair_lock(&env->flusher.condpair);
+    env->flusher.stop = true;
+    osal_condpair_signal(&env->flusher.condpair, true);
+    osal_condpair_unlock(&env->flusher.condpair);
+    int err = osal_thread_join(env->flusher.thread);
+    if (unlikely(err != MDBX_SUCCESS))
+      ERROR("flusher: join error %d", err);
+  }
+  /* the thread is not inherited by a child process after fork() */
+  env->flusher.running = env->flusher.stop = false;
+  env->flusher.pending = 0;
+}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+void env_flusher_afterfork(MDBX_env *env) {
+  /* The thread is not inherited by a child process, but the condpair and the group_sync_lock
+   * could be inherited in the locked state, i.e. locked by the flusher or a writer of the parent. */
+  env->flusher.running = env->flusher.stop = false;
+  env->flusher.pending = 0;
+  int err = osal_condpair_init(&env->flusher.condpair);
+  if (unlikely(err != MDBX_SUCCESS))
+    ERROR("flusher: condpair init error %d after fork", err);
+  err = osal_fastmutex_init(&env->group_sync_lock);
+  if (unlikely(err != MDBX_SUCCESS))
+    ERROR("flusher: group-sync mutex init error %d after fork", err);
+  if (env->basal_txn && !env->txn)
+    /* the write lock was held by the flusher of the parent, not by a transaction */
+    env->basal_txn->owner = 0;
+}
+#endif /* !Windows */
+
+/* Background defragmentation, see MDBX_opt_defrag_auto_threshold.
+ * The thread is kicked by the write transactions commits, checks the GC
+ * fragmentation via a read transaction and then performs a time-limited
+ * defragmentation only if the write lock is not held by anyone. */
+static int env_defragger_yield(void *ctx, const MDBX_defrag_result_t *progress) {
+  MDBX_env *const env = ctx;
+  (void)progress;
+  if (atomic_load32(&env->defragger.writers_waiting, mo_AcquireRelease))
+    return /* discontinue to yield the write lock */ 1;
+  osal_condpair_lock(&env->defragger.condpair);
+  const bool stop = env->defragger.stop;
+  osal_condpair_unlock(&env->defragger.condpair);
+  return stop ? 1 : 0;
+}
+
+static bool env_defragger_worthwhile(MDBX_env *env) {
+  MDBX_txn *txn;
+  int err = mdbx_txn_begin(env, nullptr, MDBX_TXN_RDONLY, &txn);
+  if (unlikely(err != MDBX_SUCCESS)) {
+    ERROR("defragger: begin txn error %d", err);
+    return false;
+  }
+
+  MDBX_gc_info_t info;
+  err = mdbx_gc_info(txn, &info, sizeof(info), nullptr, nullptr);
+  mdbx_txn_abort(txn);
+  if (unlikely(err != MDBX_SUCCESS)) {
+    ERROR("defragger: gc-info error %d", err);
+    return false;
+  }
+
+  const uint64_t threshold = env->options.defrag_auto_threshold_dot16;
+  return info.gc_reclaimable.pages > CURSOR_STACK_SIZE * 2 &&
+         info.gc_reclaimable.pages * UINT64_C(65536) >= info.pages_allocated * threshold;
+}
+
+static THREAD_RESULT THREAD_CALL env_defragger_thread(void *arg) {
+  MDBX_env *const env = arg;
+  uint64_t next_check = 0;
+  osal_condpair_lock(&env->defragger.condpair);
+  while (true) {
+    while (!env->defragger.pending && !env->defragger.stop) {
+      int err = osal_condpair_wait(&env->defragger.condpair, true);
+      if (unlikely(err != MDBX_SUCCESS)) {
+        ERROR("defragger: wait error %d", err);
+        goto bailout;
+      }
+    }
+    if (env->defragger.stop)
+      break;
+    env->defragger.pending = false;
+    /* the kicks are coalesced and rate-limited, so the write lock is held
+     * by the defragger no more than 1/16 of the time */
+    if (osal_monotime() < next_check)
+      continue;
+    osal_condpair_unlock(&env->defragger.condpair);
+
+    const uint32_t time_limit_dot16 = env->options.defrag_auto_time_limit_dot16;
+    if (env->options.defrag_auto_threshold_dot16 && env_defragger_worthwhile(env)) {
+      MDBX_defrag_result_t result;
+      const int err = env_defrag(env, true, 0, 0, 0, time_limit_dot16, -1, env->options.defrag_auto_batch,
+                                 env_defragger_yield, env, &result);
+      if (err == MDBX_BUSY)
+        DEBUG("defragger: %s", "skipped since the write lock is busy");
+      else if (MDBX_IS_ERROR(err) && err != MDBX_LAGGARD_READER)
+        ERROR("defragger: defrag error %d", err);
+      else
+        VERBOSE("defragger: shrinked by %zi pages, %zu moved, %u cycle(s), stopping reasons 0x%x",
+                result.pages_shrinked, result.pages_moved, result.cycles, result.stopping_reasons);
+    }
+    next_check = osal_monotime() + osal_16dot16_to_monotime(time_limit_dot16) * 16;
+
+    osal_condpair_lock(&env->defragger.condpair);
+  }
+bailout:
+  osal_condpair_unlock(&env->defragger.condpair);
+  return (THREAD_RESULT)0;
+}
+
+void env_defragger_kick(MDBX_env *env) {
+  int rc = osal_condpair_lock(&env->defragger.condpair);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    ERROR("defragger: lock error %d", rc);
+    return;
+  }
+  if (!env->defragger.running) {
+    env->defragger.stop = false;
+    rc = osal_thread_create(&env->defragger.thread, env_defragger_thread, env);
+    env->defragger.running = rc == MDBX_SUCCESS;
+    if (unlikely(rc != MDBX_SUCCESS))
+      ERROR("defragger: thread create error %d", rc);
+  }
+  if (likely(rc == MDBX_SUCCESS)) {
+    env->defragger.pending = true;
+    osal_condpair_signal(&env->defragger.condpair, true);
+  }
+  osal_condpair_unlock(&env->defragger.condpair);
+}
+
+void env_defragger_stop(MDBX_env *env) {
+  if (!env->defragger.running)
+    return;
+  if (likely(env->pid == osal_getpid())) {
+    osal_condpair_lock(&env->defragger.condpair);
+    env->defragger.stop = true;
+    osal_condpair_signal(&env->defragger.condpair, true);
+    osal_condpair_unlock(&env->defragger.condpair);
+    int err = osal_thread_join(env->defragger.thread);
+    if (unlikely(err != MDBX_SUCCESS))
+      ERROR("defragger: join error %d", err);
+  }
+  /* the thread is not inherited by a child process after fork() */
+  env->defragger.running = env->defragger.stop = env->defragger.pending = false;
+}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+void env_defragger_afterfork(MDBX_env *env) {
+  /* The condpair could be inherited in the locked state by the defragger or a kicking writer of the parent.
+   * A write transaction of the defragger, if any, is aborted by mdbx_env_resurrect_after_fork(). */
+  env->defragger.running = env->defragger.stop = env->defragger.pending = false;
+  atomic_store32(&env->defragger.writers_waiting, 0, mo_Relaxed);
+  int err = osal_condpair_init(&env->defragger.condpair);
+  if (unlikely(err != MDBX_SUCCESS))
+    ERROR("defragger: condpair init error %d after fork", err);
+}
+#endif /* !Windows */
+
+/* Periodic saving of the hot-page map, see MDBX_opt_hotmap_interval.
+ * The thread doesn't use transactions, since the map is just a hint, but
+ * hotmap_save() takes the remap_lock around the sampling of the mapping. */
+
+static THREAD_RESULT THREAD_CALL env_hotmap_thread(void *arg) {
+  MDBX_env *const env = arg;
+  osal_condpair_lock(&env->hotmap.condpair);
+  while (!env->hotmap.stop) {
+    const uint64_t interval_ms = ((uint64_t)env->options.hotmap_interval_dot16 * 1000) >> 16;
+    int err = osal_condpair_timedwait(&env->hotmap.condpair, true,
+                                      (interval_ms < 1) ? 1 : (interval_ms < UINT_MAX) ? (unsigned)interval_ms : UINT_MAX);
+    if (err == MDBX_RESULT_TRUE) {
+      if (env->hotmap.stop)
+        break;
+      osal_condpair_unlock(&env->hotmap.condpair);
+      err = hotmap_save(env);
+      if (unlikely(err != MDBX_SUCCESS))
+        DEBUG("hot-page map: save error %d", err);
+      osal_condpair_lock(&env->hotmap.condpair);
+    } else if (unlikely(err != MDBX_SUCCESS)) {
+      ERROR("hot-page map: wait error %d", err);
+      break;
+    }
+  }
+  osal_condpair_unlock(&env->hotmap.condpair);
+  return (THREAD_RESULT)0;
+}
+
+void env_hotmap_start(MDBX_env *env) {
+  if (!MDBX_USE_MINCORE)
+    /* nothing to save, since hotmap_save() always fails with MDBX_ENOSYS */
+    return;
+  int rc = osal_condpair_lock(&env->hotmap.condpair);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    ERROR("hot-page map: lock error %d", rc);
+    return;
+  }
+  if (!env->hotmap.running) {
+    env->hotmap.stop = false;
+    rc = osal_thread_create(&env->hotmap.thread, env_hotmap_thread, env);
+    env->hotmap.running = rc == MDBX_SUCCESS;
+    if (unlikely(rc != MDBX_SUCCESS))
+      ERROR("hot-page map: thread create error %d", rc);
+  } else
+    /* restart waiting with a new interval */
+    osal_condpair_signal(&env->hotmap.condpair, true);
+  osal_condpair_unlock(&env->hotmap.condpair);
+}
+
+void env_hotmap_stop(MDBX_env *env, bool save) {
+  if (env->hotmap.running && likely(env->pid == osal_getpid())) {
+    osal_condpair_lock(&env->hotmap.condpair);
+    env->hotmap.stop = true;
+    osal_condpair_signal(&env->hotmap.condpair, true);
+    osal_condpair_unlock(&env->hotmap.condpair);
+    int err = osal_thread_join(env->hotmap.thread);
+    if (unlikely(err != MDBX_SUCCESS))
+      ERROR("hot-page map: join error %d", err);
+  }
+  /* the thread is not inherited by a child process after fork() */
+  env->hotmap.running = env->hotmap.stop = false;
+
+  if (save && env->options.hotmap_interval_dot16 && env->dxb_mmap.base && env->lck_mmap.lck &&
+      (env->flags & (ENV_ACTIVE | ENV_FATAL_ERROR)) == ENV_ACTIVE) {
+    /* the last snapshot of the hot pages, just before closing */
+    int err = hotmap_save(env);
+    if (unlikely(err != MDBX_SUCCESS))
+      DEBUG("hot-page map: save error %d", err);
+  }
+}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+void env_hotmap_afterfork(MDBX_env *env) {
+  /* The condpair could be inherited in the locked state by the hotmap thread of the parent. */
+  env->hotmap.running = env->hotmap.stop = false;
+  int err = osal_condpair_init(&env->hotmap.condpair);
+  if (unlikely(err != MDBX_SUCCESS))
+    ERROR("hot-page map: condpair init error %d after fork", err);
+}
+#endif /* !Windows */
+
 __cold int env_open(MDBX_env *env, mdbx_mode_t mode) {
   /* Использование O_DSYNC или FILE_FLAG_WRITE_THROUGH:
    *
@@ -21509,6 +24715,12 @@ __cold int env_open(MDBX_env *env, mdbx_mode_t mode) {
     }
   }
 
+  if (env->options.page_checksum) {
+    rc = pgsum_open(env, mode);
+    if (unlikely(rc != MDBX_SUCCESS))
+      return rc;
+  }
+
   rc = (env->flags & MDBX_RDONLY) ? MDBX_SUCCESS
                                   : osal_ioring_create(&env->ioring
 #if defined(_WIN32) || defined(_WIN64)
@@ -21516,6 +24728,9 @@ __cold int env_open(MDBX_env *env, mdbx_mode_t mode) {
                                                        ior_direct, env->ioring.overlapped_fd
 #endif /* Windows */
                                     );
+  env->hotmap.mode = mode;
+  if (rc == MDBX_SUCCESS && env->options.hotmap_interval_dot16)
+    env_hotmap_start(env);
   return rc;
 }
 
@@ -21544,6 +24759,7 @@ __cold int env_close(MDBX_env *env, bool resurrect_after_fork) {
 
   if ((env->flags & MDBX_RDONLY) == 0)
     osal_ioring_destroy(&env->ioring);
+  pgsum_close(env);
 
   env->lck = nullptr;
   if (env->lck_mmap.lck)
@@ -21635,6 +24851,18 @@ static inline bool bit_tas(uint64_t *field, char bit) {
   return r;
 }
 
+int mincore_probe(const MDBX_env *env, size_t offset, size_t length, uint8_t *vector) {
+  if (MDBX_ENABLE_PGOP_STAT)
+    env->lck->pgops.mincore.weak += 1;
+
+  if (unlikely(mincore(ptr_disp(env->dxb_mmap.base, offset), length, (void *)vector))) {
+    const int err = errno;
+    NOTICE("mincore(+%zu, %zu), err %d", offset, length, err);
+    return err;
+  }
+  return MDBX_SUCCESS;
+}
+
 static bool mincore_fetch(MDBX_env *const env, const size_t unit_begin) {
   lck_t *const lck = env->lck;
   for (size_t i = 1; i < ARRAY_LENGTH(lck->mincore_cache.begin); ++i) {
@@ -21668,14 +24896,9 @@ static bool mincore_fetch(MDBX_env *const env, const size_t unit_begin) {
     pages = length >> globals.sys_pagesize_ln2;
   }
 
-  if (MDBX_ENABLE_PGOP_STAT)
-    env->lck->pgops.mincore.weak += 1;
-
   uint8_t *const vector = alloca(pages);
-  if (unlikely(mincore(ptr_disp(env->dxb_mmap.base, offset), length, (void *)vector))) {
-    NOTICE("mincore(+%zu, %zu), err %d", offset, length, errno);
+  if (unlikely(mincore_probe(env, offset, length, vector) != MDBX_SUCCESS))
     return false;
-  }
 
   for (size_t i = 1; i < ARRAY_LENGTH(lck->mincore_cache.begin); ++i) {
     lck->mincore_cache.begin[i] = lck->mincore_cache.begin[i - 1];
@@ -22207,6 +25430,76 @@ static inline bool is_reclaimable(MDBX_txn *txn, const MDBX_cursor *mc, const ui
   return true;
 }
 
+#if MDBX_GC_PREFETCH_LOOKAHEAD
+static void gc_prefetch(const MDBX_env *env, const pgno_t pgno, const size_t npages) {
+  /* Не суетимся если страницы в зоне включенного упреждающего чтения */
+  const bool readahead_enabled = env->lck->readahead_anchor & 1;
+  const pgno_t readahead_edge = env->lck->readahead_anchor >> 1;
+  if (readahead_enabled && pgno + npages <= readahead_edge)
+    return;
+
+  dxb_prefetch(env, pgno, npages);
+}
+
+/* Содержимое выделяемых из repnl страниц читается только в режиме MDBX_WRITEMAP, и только если
+ * не используется prefault-write, который заполняет страницы записью без чтения с диска. */
+static inline bool gc_prefetch_targets(const MDBX_txn *txn) {
+  return (txn->env->flags & MDBX_WRITEMAP) && !txn->env->incore && !txn->wr.prefault_write_activated;
+}
+
+/* Упреждающее чтение страниц, которые будут выделены из repnl следующими, с пропуском уже запрошенных.
+ * Близко расположенные страницы объединяются в общие регионы, а уже находящиеся в ОЗУ пропускаются
+ * посредством кэшируемого mincore(), чтобы не плодить системные вызовы. */
+static void gc_prefetch_repnl(MDBX_txn *txn, size_t skip) {
+  const size_t len = pnl_size(txn->wr.repnl);
+  const size_t window = (len < MDBX_GC_PREFETCH_LOOKAHEAD) ? len : MDBX_GC_PREFETCH_LOOKAHEAD;
+  /* перевзводим с перекрытием, чтобы следующая порция была запрошена до исчерпания текущей */
+  txn->wr.gc.prefetch_countdown = (len > MDBX_GC_PREFETCH_LOOKAHEAD) ? (MDBX_GC_PREFETCH_LOOKAHEAD + 1) / 2 : 0;
+  if (skip >= window)
+    return;
+
+  MDBX_env *const env = txn->env;
+  const ptrdiff_t dir = MDBX_PNL_ASCENDING ? 1 : -1;
+  const pgno_t *scan = MDBX_PNL_EDGE(txn->wr.repnl) + dir * (ptrdiff_t)skip;
+  const pgno_t *const end = scan + dir * (ptrdiff_t)(window - skip);
+  pgno_t span = *scan, span_end = span + 1;
+  while ((scan += dir) != end) {
+    const pgno_t pgno = *scan;
+    if (pgno <= span_end + MDBX_GC_PREFETCH_LOOKAHEAD / 8)
+      span_end = pgno + 1;
+    else {
+      if (!env_is_page_incore(env, span))
+        gc_prefetch(env, span, span_end - span);
+      span = pgno;
+      span_end = pgno + 1;
+    }
+  }
+  if (!env_is_page_incore(env, span))
+    gc_prefetch(env, span, span_end - span);
+}
+
+/* Упреждающее чтение следующей по ходу просмотра GC листовой страницы, а также large-страниц
+ * следующей записи, чтобы чтение с диска происходило параллельно с обработкой текущей записи. */
+static void gc_prefetch_ahead(const MDBX_cursor *gc, const bool lifo) {
+  const MDBX_env *const env = gc->txn->env;
+  const page_t *const mp = gc->pg[gc->top];
+  const size_t ki = gc->ki[gc->top];
+  const size_t nkeys = page_numkeys(mp);
+  const size_t next = lifo ? ki - 1 : ki + 1;
+  if (next < nkeys) {
+    const node_t *const node = page_node(mp, next);
+    if (node_flags(node) & N_BIG)
+      gc_prefetch(env, node_largedata_pgno(node), largechunk_npages(env, node_ds(node)));
+  } else if (gc->top > 0) {
+    const page_t *const parent = gc->pg[gc->top - 1];
+    const size_t pki = gc->ki[gc->top - 1];
+    const size_t sibling = lifo ? pki - 1 : pki + 1;
+    if (sibling < page_numkeys(parent))
+      gc_prefetch(env, node_pgno(page_node(parent, sibling)), 1);
+  }
+}
+#endif /* MDBX_GC_PREFETCH_LOOKAHEAD */
+
 __hot static pgno_t repnl_get_single(MDBX_txn *txn) {
   const size_t len = pnl_size(txn->wr.repnl);
   ASSERT(len > 0);
@@ -22474,7 +25767,10 @@ bailout:
 }
 
 static txnid_t shapshot_oldest_force_rescan(MDBX_txn *const txn) {
-  atomic_store32(&txn->env->lck->rdt_refresh_flag, true, mo_AcquireRelease);
+  lck_t *const lck = txn->env->lck;
+  for (size_t shard = 0; shard < MDBX_RDT_SHARDS; ++shard)
+    atomic_store32(&lck->rdt_shard_refresh[shard], true, mo_Relaxed);
+  atomic_store32(&lck->rdt_refresh_flag, true, mo_AcquireRelease);
   return mvcc_shapshot_oldest_rw(txn).oldest_txnid;
 }
 
@@ -22515,6 +25811,78 @@ MDBX_cursor *gc_cursor_init(MDBX_txn *txn) {
   return gc;
 }
 
+/* Выбор между LIFO и FIFO переработкой GC для очередной пишущей транзакции, см. MDBX_opt_gc_adaptive.
+ *
+ * LIFO сокращает цикл оборота страниц и поэтому выгоден при наличии кэша обратной записи, но только пока
+ * переработке доступны недавно освобожденные страницы. Поэтому FIFO выбирается если:
+ *  - мета-страницы не фиксируются на диске, так как тогда страницы переиспользуются только до последней
+ *    устойчивой точки фиксации и разница между LIFO и FIFO нивелируется;
+ *  - читатели удерживают от переработки больше страниц чем лимит грязных страниц транзакции,
+ *    т.е. доступные для переработки страницы уже заведомо "остыли";
+ *  - в GC накопился "хвост" из старых записей, которые при LIFO не перерабатываются;
+ *  - повторные просмотры GC при LIFO (каждый поиск начинается от читателя) стали слишком затратными. */
+void gc_policy_setup(MDBX_txn *txn) {
+  MDBX_env *const env = txn->env;
+  const size_t rsteps = txn->wr.gc.rsteps /* of the previous txn */;
+  const bool was_lifo = txn->wr.gc.lifo;
+  txn->wr.gc.rsteps = 0;
+  txn->wr.gc.prefetch_countdown = 0;
+  txn->wr.gc.rp_augment_limit = env->options.rp_augment_limit;
+  if (!env->options.gc_adaptive) {
+    txn->wr.gc.lifo = (env->flags & MDBX_LIFORECLAIM) != 0;
+    txn->wr.gc.policy = MDBX_gc_policy_static;
+    return;
+  }
+
+  const size_t backlog_hi = 256, backlog_lo = 16, rsteps_limit = 1024, penalty = 16;
+  unsigned reasons = MDBX_gc_policy_adaptive;
+  if ((env->flags | txn->flags) & MDBX_SAFE_NOSYNC)
+    reasons |= MDBX_gc_policy_nosync;
+
+  const lck_t *const lck = env->lck;
+  const meta_ptr_t recent = meta_recent(env, &txn->wr.troika);
+  const txnid_t oldest = atomic_load64(&lck->cached_oldest_txnid, mo_Relaxed);
+  const uint64_t retired = unaligned_peek_u64(4, recent.ptr_c->pages_retired);
+  const uint64_t oldest_retired = atomic_load64(&lck->cached_oldest_retired, mo_Relaxed);
+  if (retired > oldest_retired && retired - oldest_retired > env->options.dp_limit)
+    reasons |= MDBX_gc_policy_reader_lag;
+
+  /* не более одной записи GC на транзакцию новее самого старого читателя,
+   * поэтому остальные образуют доступный для переработки "хвост" */
+  const size_t lag = (recent.txnid > oldest) ? (size_t)(recent.txnid - oldest) : 0;
+  const size_t records = (size_t)txn->dbs[FREE_DBI].items;
+  const size_t backlog = (records > lag) ? records - lag : 0;
+  if (!env->gc.draining) {
+    /* при переходе к LIFO остаются записи созданные при FIFO, поэтому учитывается только рост "хвоста" */
+    if (env->gc.backlog_base > backlog)
+      env->gc.backlog_base = backlog;
+    if (backlog > env->gc.backlog_base + backlog_hi) {
+      env->gc.draining = true;
+      env->gc.drain_edge = recent.txnid;
+    }
+  } else if (env->gc.fifo_progress >= env->gc.drain_edge || backlog < backlog_lo) {
+    env->gc.draining = false;
+    env->gc.backlog_base = backlog;
+  }
+  if (env->gc.draining) {
+    reasons |= MDBX_gc_policy_backlog;
+    if (!env->options.flags.non_auto.rp_augment_limit && txn->wr.gc.rp_augment_limit < PAGELIST_LIMIT / 2) {
+      txn->wr.gc.rp_augment_limit *= 2;
+      reasons |= MDBX_gc_policy_augmented;
+    }
+  }
+
+  if (was_lifo && rsteps > rsteps_limit)
+    env->gc.fifo_penalty = penalty;
+  else if (env->gc.fifo_penalty)
+    env->gc.fifo_penalty -= 1;
+  if (env->gc.fifo_penalty)
+    reasons |= MDBX_gc_policy_rescans;
+
+  txn->wr.gc.lifo = (reasons & ~(MDBX_gc_policy_adaptive | MDBX_gc_policy_augmented)) == 0;
+  txn->wr.gc.policy = (uint8_t)reasons;
+}
+
 pgr_t gc_alloc_ex(const MDBX_cursor *const mc, const size_t num, uint8_t flags) {
   pgr_t ret;
   MDBX_txn *const txn = mc->txn;
@@ -22567,7 +25935,7 @@ pgr_t gc_alloc_ex(const MDBX_cursor *const mc, const size_t num, uint8_t flags)
   }
 
   eASSERT0(env, (flags & (ALLOC_COALESCE | ALLOC_LIFO | ALLOC_SHOULD_SCAN)) == 0);
-  flags += (env->flags & MDBX_LIFORECLAIM) ? ALLOC_LIFO : 0;
+  flags += txn->wr.gc.lifo ? ALLOC_LIFO : 0;
 
   /* Не коагулируем записи в случае запроса слота для возврата страниц в GC. Иначе попытка увеличить резерв
    * может приводить к необходимости ещё большего резерва из-за увеличения списка переработанных страниц. */
@@ -22619,6 +25987,7 @@ retry_gc_have_detent:
   }
 
 next_gc:
+  env->basal_txn->wr.gc.rsteps += 1;
 #if MDBX_ENABLE_PROFGC
   prof->rsteps += 1
 #endif /* MDBX_ENABLE_PROFGC */
@@ -22649,6 +26018,10 @@ next_gc:
   }
 
   id = unaligned_peek_u64(4, key.iov_base);
+#if MDBX_GC_PREFETCH_LOOKAHEAD
+  if (!env->incore)
+    gc_prefetch_ahead(gc, (flags & ALLOC_LIFO) != 0);
+#endif /* MDBX_GC_PREFETCH_LOOKAHEAD */
   if (flags & ALLOC_LIFO) {
     op = MDBX_PREV;
     if (id > txn->env->gc.detent || gc_is_reclaimed(txn, id))
@@ -22659,6 +26032,8 @@ next_gc:
     op = MDBX_NEXT;
     if (gc_is_reclaimed(txn, id))
       goto next_gc;
+    if (txn->env->gc.fifo_progress < id)
+      txn->env->gc.fifo_progress = id;
   }
   txn->flags &= ~txn_gc_drained;
 
@@ -22711,7 +26086,7 @@ next_gc:
       }
     }
     flags &= ~(ALLOC_COALESCE | ALLOC_SHOULD_SCAN);
-    if (unlikely(/* list is too long already */ pnl_size(txn->wr.repnl) >= env->options.rp_augment_limit) &&
+    if (unlikely(/* list is too long already */ pnl_size(txn->wr.repnl) >= txn->wr.gc.rp_augment_limit) &&
         ((/* not a slot-request from gc-update */ num &&
           /* have enough unallocated space */ txn->geo.upper >= txn->geo.first_unallocated + num &&
           monotime_since_cached(monotime_begin, &now_cache) + txn->wr.gc.spent >= env->options.gc_time_limit) ||
@@ -22723,7 +26098,7 @@ next_gc:
              "(chunk) >= %zu, rp_augment_limit %u",
              likely(gc_len + pnl_size(txn->wr.repnl) < PAGELIST_LIMIT) ? "since rp_augment_limit was reached"
                                                                        : "to avoid PNL overflow",
-             pnl_size(txn->wr.repnl), gc_len, gc_len + pnl_size(txn->wr.repnl), env->options.rp_augment_limit);
+             pnl_size(txn->wr.repnl), gc_len, gc_len + pnl_size(txn->wr.repnl), txn->wr.gc.rp_augment_limit);
       goto depleted_gc;
     }
   }
@@ -22808,6 +26183,10 @@ next_gc:
   }
 
 scan:
+#if MDBX_GC_PREFETCH_LOOKAHEAD
+  if (num < 2 && gc_prefetch_targets(txn))
+    gc_prefetch_repnl(txn, 0);
+#endif /* MDBX_GC_PREFETCH_LOOKAHEAD */
   if ((flags & ALLOC_RESERVE) && num < 2) {
     /* Если был нужен только slot/id для gc_reclaim_slot() или gc_reserve4stockpile() */
     TRACE("%s: last id #%" PRIaTXN ", re-len %zu", "reserve-done", id, pnl_size(txn->wr.repnl));
@@ -23069,8 +26448,13 @@ __hot pgr_t gc_alloc_single(const MDBX_cursor *const mc) {
     return ret;
   }
 
-  if (likely(pnl_size(txn->wr.repnl) > 0))
+  if (likely(pnl_size(txn->wr.repnl) > 0)) {
+#if MDBX_GC_PREFETCH_LOOKAHEAD
+    if (txn->wr.gc.prefetch_countdown && --txn->wr.gc.prefetch_countdown == 0)
+      gc_prefetch_repnl(txn, MDBX_GC_PREFETCH_LOOKAHEAD / 2);
+#endif /* MDBX_GC_PREFETCH_LOOKAHEAD */
     return page_alloc_finalize(txn->env, txn, mc, repnl_get_single(txn), 1);
+  }
 
   return gc_alloc_ex(mc, 1, ALLOC_DEFAULT);
 }
@@ -23109,9 +26493,7 @@ static int gc_peekid(const MDBX_val *key, txnid_t *id) {
            LVL <= globals.loglevel)
 #endif /* MDBX_DEBUG_GCU */
 
-MDBX_NOTHROW_PURE_FUNCTION static bool is_lifo(const MDBX_txn *txn) {
-  return (txn->env->flags & MDBX_LIFORECLAIM) != 0;
-}
+MDBX_NOTHROW_PURE_FUNCTION static bool is_lifo(const MDBX_txn *txn) { return txn->wr.gc.lifo; }
 
 MDBX_NOTHROW_PURE_FUNCTION MDBX_MAYBE_UNUSED static inline const char *dbg_prefix(const gcu_t *ctx) {
   return is_lifo(ctx->cursor.txn) ? "    lifo" : "    fifo";
@@ -24790,6 +28172,8 @@ __cold static void mdbx_init(void) {
   osal_ctor();
   ASSERT(globals.sys_pagesize > 0 && (globals.sys_pagesize & (globals.sys_pagesize - 1)) == 0);
   rthc_ctor();
+  pgsum_ctor();
+  tree_search_ctor();
 #if MDBX_CHECKING > 0
   ENSURE(troika_verify_fsm());
   ENSURE(pv2pages_verify());
@@ -24994,6 +28378,7 @@ __dll_export
     " LOCKING=" MDBX_LOCKING_CONFIG
     " OFDLOCKS=" MDBX_USE_OFDLOCKS_CONFIG
     " FALLOCATE=" MDBX_USE_FALLOCATE_CONFIG
+    " IOURING=" MDBX_USE_IOURING_CONFIG
 #endif /* !Windows */
     " CACHELINE_SIZE=" MDBX_STRINGIFY(MDBX_CACHELINE_SIZE)
     " CPU_WRITEBACK_INCOHERENT=" MDBX_STRINGIFY(MDBX_CPU_WRITEBACK_INCOHERENT)
@@ -25473,6 +28858,24 @@ int osal_lockfile(mdbx_filehandle_t fd, bool wait) {
   return lck_op(fd, wait ? op_setlkw : op_setlk, F_WRLCK, 0, OFF_T_MAX);
 }
 
+/* Locks the whole file exclusively if it is not used by anyone else and returns MDBX_RESULT_TRUE,
+ * otherwise waits for a shared lock and returns MDBX_RESULT_FALSE. */
+int osal_lockfile_probe(mdbx_filehandle_t fd) {
+#if MDBX_USE_OFDLOCKS
+  if (unlikely(op_setlk == 0))
+    choice_fcntl();
+#endif /* MDBX_USE_OFDLOCKS */
+  int rc = lck_op(fd, op_setlk, F_WRLCK, 0, OFF_T_MAX);
+  if (rc == MDBX_SUCCESS)
+    return MDBX_RESULT_TRUE;
+  if (rc == EAGAIN || rc == EACCES || rc == EBUSY || rc == EWOULDBLOCK)
+    rc = lck_op(fd, op_setlkw, F_RDLCK, 0, OFF_T_MAX);
+  return rc;
+}
+
+/* Converts the exclusive lock acquired by osal_lockfile_probe() to the shared one. */
+int osal_lockfile_downgrade(mdbx_filehandle_t fd) { return lck_op(fd, op_setlk, F_RDLCK, 0, OFF_T_MAX); }
+
 int lck_rpid_set(MDBX_env *env) {
   ASSERT(env->lck_mmap.fd != INVALID_HANDLE_VALUE);
   ASSERT(env->pid > 0);
@@ -26353,6 +29756,22 @@ int osal_lockfile(mdbx_filehandle_t fd, bool wait) {
   return flock_ex(fd, 0, wait ? LCK_EXCLUSIVE | LCK_WAITFOR : LCK_EXCLUSIVE | LCK_DONTWAIT, 0, DXB_MAXLEN, 0);
 }
 
+int osal_lockfile_probe(mdbx_filehandle_t fd) {
+  int rc = flock_ex(fd, 0, LCK_EXCLUSIVE | LCK_DONTWAIT, 0, DXB_MAXLEN, 0);
+  if (rc == MDBX_SUCCESS)
+    return MDBX_RESULT_TRUE;
+  if (rc == ERROR_LOCK_VIOLATION)
+    rc = flock_ex(fd, 0, LCK_SHARED | LCK_WAITFOR, 0, DXB_MAXLEN, 0);
+  return rc;
+}
+
+int osal_lockfile_downgrade(mdbx_filehandle_t fd) {
+  /* a shared lock could overlap an exclusive one of the same handle,
+   * and then the first unlocking releases the exclusive lock */
+  int rc = flock_ex(fd, 0, LCK_SHARED | LCK_DONTWAIT, 0, DXB_MAXLEN, 0);
+  return (rc == MDBX_SUCCESS) ? funlock(fd, 0, DXB_MAXLEN) : rc;
+}
+
 static int suspend_and_append(mdbx_handle_array_t **array, const DWORD ThreadId) {
   const unsigned limit = (*array)->limit;
   if ((*array)->count == limit) {
@@ -27581,12 +31000,17 @@ __cold static page_t *meta_model(const MDBX_env *env, page_t *model, size_t num,
   return ptr_disp(model, env->ps);
 }
 
-__cold meta_t *meta_init_triplet(const MDBX_env *env, void *buffer) {
-  const bin128_t guid = osal_guid(env);
+/* Makes the meta-pages triplet of the given GUID, which may be unaligned, or of a new one if nullptr. */
+__cold meta_t *meta_init_triplet(const MDBX_env *env, void *buffer, const void *guid) {
+  bin128_t dxbid;
+  if (guid)
+    memcpy(&dxbid, guid, sizeof(dxbid));
+  else
+    dxbid = osal_guid(env);
   page_t *page0 = (page_t *)buffer;
-  page_t *page1 = meta_model(env, page0, 0, &guid);
-  page_t *page2 = meta_model(env, page1, 1, &guid);
-  meta_model(env, page2, 2, &guid);
+  page_t *page1 = meta_model(env, page0, 0, &dxbid);
+  page_t *page2 = meta_model(env, page1, 1, &dxbid);
+  meta_model(env, page2, 2, &dxbid);
   return page_meta(page2);
 }
 
@@ -27904,12 +31328,57 @@ __cold int meta_validate_copy(MDBX_env *env, const meta_t *meta, meta_t *dest) {
   return meta_validate(env, dest, payload2page(meta), bytes2pgno(env, ptr_dist(meta, env->dxb_mmap.base)), nullptr);
 }
 
+static inline void rdt_hint_advance(lck_t *lck, uint32_t hint, size_t slot) {
+  /* Moves the hint beyond the just claimed slot, but only if no one has
+   * changed it meanwhile, since concurrent release could have lowered it. */
+  if (hint <= slot)
+    atomic_cas32(&lck->rdt_free_hint, hint, (uint32_t)slot + 1);
+}
+
+static inline void rdt_slot_setup(const MDBX_env *env, reader_slot_t *slot) {
+  safe64_reset(&slot->txnid, true);
+  slot->tid.weak = (env->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self();
+}
+
+/* Tries to claim a free slot among the already used part of the readers table
+ * without acquiring the rdt_lock. Free slots are seized by CAS of the pid,
+ * therefore the lock is needed only to extend the table or to clean up the
+ * slots of dead processes. */
+static reader_slot_t *rdt_claim_lockfree(MDBX_env *env) {
+  lck_t *const lck = env->lck;
+  const uint32_t hint = atomic_load32(&lck->rdt_free_hint, mo_Relaxed);
+  const size_t nreaders = atomic_load32(&lck->rdt_length, mo_AcquireRelease);
+  for (size_t slot = hint; slot < nreaders; ++slot) {
+    if (atomic_load_pid(&lck->rdt[slot].pid, mo_Relaxed))
+      continue;
+    if (likely(atomic_cas32(&lck->rdt[slot].pid, 0, env->pid))) {
+      rdt_slot_setup(env, &lck->rdt[slot]);
+      rdt_hint_advance(lck, hint, slot);
+#if MDBX_ENABLE_PGOP_STAT
+      atomic_add32(&lck->pgops.rslot.lockfree, 1);
+#endif /* MDBX_ENABLE_PGOP_STAT */
+      return &lck->rdt[slot];
+    }
+#if MDBX_ENABLE_PGOP_STAT
+    atomic_add32(&lck->pgops.rslot.collisions, 1);
+#endif /* MDBX_ENABLE_PGOP_STAT */
+  }
+  return nullptr;
+}
+
 bsr_t mvcc_bind_slot(MDBX_env *env) {
   eASSERT0(env, env->lck_mmap.lck);
   eASSERT0(env, env->lck->magic_and_version == MDBX_LOCK_MAGIC);
   eASSERT0(env, env->lck->os_and_format == MDBX_LOCK_FORMAT);
 
-  bsr_t result = {lck_rdt_lock(env), nullptr};
+  bsr_t result = {MDBX_SUCCESS, nullptr};
+  if (likely(env->registered_reader_pid == env->pid && env->dxb_mmap.base && !(env->flags & ENV_FATAL_ERROR))) {
+    result.slot = rdt_claim_lockfree(env);
+    if (likely(result.slot))
+      goto bound;
+  }
+
+  result.err = lck_rdt_lock(env);
   if (unlikely(MDBX_IS_ERROR(result.err)))
     return result;
   if (unlikely(env->flags & ENV_FATAL_ERROR)) {
@@ -27933,16 +31402,44 @@ bsr_t mvcc_bind_slot(MDBX_env *env) {
   }
 
   result.err = MDBX_SUCCESS;
+  lck_t *const lck = env->lck;
   size_t slot, nreaders;
   while (1) {
-    nreaders = env->lck->rdt_length.weak;
+    const uint32_t hint = atomic_load32(&lck->rdt_free_hint, mo_Relaxed);
+    nreaders = lck->rdt_length.weak;
+    /* Other readers could seize free slots without the lock,
+     * so the slot is claimed by CAS in the same manner. */
     for (slot = 0; slot < nreaders; slot++)
-      if (!atomic_load_pid(&env->lck->rdt[slot].pid, mo_AcquireRelease))
-        break;
+      if (!atomic_load_pid(&lck->rdt[slot].pid, mo_AcquireRelease)) {
+        if (likely(atomic_cas32(&lck->rdt[slot].pid, 0, env->pid))) {
+          rdt_slot_setup(env, &lck->rdt[slot]);
+          rdt_hint_advance(lck, hint, slot);
+          break;
+        }
+#if MDBX_ENABLE_PGOP_STAT
+        atomic_add32(&lck->pgops.rslot.collisions, 1);
+#endif /* MDBX_ENABLE_PGOP_STAT */
+      }
+
+    if (likely(slot < nreaders))
+      break;
 
-    if (likely(slot < env->max_readers))
+    if (likely(slot < env->max_readers)) {
+      /* Claim the reader slot, carefully since other code
+       * uses the reader table un-mutexed: First setup the
+       * slot, next publish it in lck->rdt_length.  After
+       * that, it is safe for mdbx_env_close() to touch it
+       * as well as for other readers to see it. */
+      rdt_slot_setup(env, &lck->rdt[slot]);
+      atomic_store32(&lck->rdt[slot].pid, env->pid, mo_AcquireRelease);
+      atomic_store32(&lck->rdt_length, (uint32_t)++nreaders, mo_AcquireRelease);
+      rdt_hint_advance(lck, hint, slot);
       break;
+    }
 
+#if MDBX_ENABLE_PGOP_STAT
+    atomic_add32(&lck->pgops.rslot.exhausted, 1);
+#endif /* MDBX_ENABLE_PGOP_STAT */
     result.err = mvcc_cleanup_dead(env, true, nullptr);
     if (result.err != MDBX_RESULT_TRUE) {
       lck_rdt_unlock(env);
@@ -27950,21 +31447,13 @@ bsr_t mvcc_bind_slot(MDBX_env *env) {
       return result;
     }
   }
-
-  result.slot = &env->lck->rdt[slot];
-  /* Claim the reader slot, carefully since other code
-   * uses the reader table un-mutexed: First reset the
-   * slot, next publish it in lck->rdt_length.  After
-   * that, it is safe for mdbx_env_close() to touch it.
-   * When it will be closed, we can finally claim it. */
-  atomic_store32(&result.slot->pid, 0, mo_AcquireRelease);
-  safe64_reset(&result.slot->txnid, true);
-  if (slot == nreaders)
-    env->lck->rdt_length.weak = (uint32_t)++nreaders;
-  result.slot->tid.weak = (env->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self();
-  atomic_store32(&result.slot->pid, env->pid, mo_AcquireRelease);
   lck_rdt_unlock(env);
+  result.slot = &lck->rdt[slot];
+#if MDBX_ENABLE_PGOP_STAT
+  atomic_add32(&lck->pgops.rslot.locked, 1);
+#endif /* MDBX_ENABLE_PGOP_STAT */
 
+bound:
   if (likely(env->flags & ENV_TXKEY)) {
     eASSERT0(env, env->registered_reader_pid == env->pid);
     thread_rthc_set(env->me_txkey, result.slot);
@@ -28023,35 +31512,56 @@ __hot orsi_rw_t mvcc_shapshot_oldest_rw(const MDBX_txn *const txn) {
     result.oldest_txnid = result.steady_txnid;
     oldest_retired_pages = unaligned_peek_u64(4, steady.ptr_c->pages_retired);
 
-    for (size_t i = 0; i < snap_nreaders; ++i) {
-    retry:;
-      const mdbx_pid_t pid = atomic_load_pid(&lck->rdt[i].pid, mo_AcquireRelease);
-      if (!pid)
-        continue;
-      jitter4testing(true);
+    /* Only the shards changed since the previous scan are rescanned,
+     * for others the cached minimums are used. */
+    const size_t snap_shards = (snap_nreaders < MDBX_RDT_SHARDS) ? snap_nreaders : MDBX_RDT_SHARDS;
+    for (size_t shard = 0; shard < snap_shards; ++shard) {
+      if (nothing_changed_signature != atomic_load32(&lck->rdt_shard_refresh[shard], mo_AcquireRelease) ||
+          unlikely(lck->rdt_shard_cache[shard].oldest == 0)) {
+        lck->rdt_shard_cache[shard].oldest = /* unknown until the rescan is completed */ 0;
+        atomic_store32(&lck->rdt_shard_refresh[shard], nothing_changed_signature, mo_AcquireRelease);
+        txnid_t shard_oldest = UINT64_MAX;
+        uint64_t shard_retired = 0;
+        for (size_t i = shard; i < snap_nreaders; i += MDBX_RDT_SHARDS) {
+        retry:;
+          const mdbx_pid_t pid = atomic_load_pid(&lck->rdt[i].pid, mo_AcquireRelease);
+          if (!pid)
+            continue;
+          jitter4testing(true);
 
-      const uint64_t reader_retired = atomic_load64(&lck->rdt[i].snapshot_pages_retired, mo_Relaxed);
-      const txnid_t reader_txnid = atomic_load64(&lck->rdt[i].txnid, mo_Relaxed);
-      if (unlikely(reader_retired != atomic_load64(&lck->rdt[i].snapshot_pages_retired, mo_AcquireRelease) ||
-                   reader_txnid != atomic_load64(&lck->rdt[i].txnid, mo_AcquireRelease))) {
-        atomic_yield();
-        goto retry;
-      }
+          const uint64_t reader_retired = atomic_load64(&lck->rdt[i].snapshot_pages_retired, mo_Relaxed);
+          const txnid_t reader_txnid = atomic_load64(&lck->rdt[i].txnid, mo_Relaxed);
+          if (unlikely(reader_retired != atomic_load64(&lck->rdt[i].snapshot_pages_retired, mo_AcquireRelease) ||
+                       reader_txnid != atomic_load64(&lck->rdt[i].txnid, mo_AcquireRelease))) {
+            atomic_yield();
+            goto retry;
+          }
+
+          if (unlikely(reader_txnid < prev_oldest)) {
+            if (unlikely(nothing_changed_signature == atomic_load32(&lck->rdt_refresh_flag, mo_AcquireRelease)) &&
+                safe64_reset_compare(&lck->rdt[i].txnid, reader_txnid)) {
+              NOTICE("kick stuck reader[%zu of %zu].pid_%zu %" PRIaTXN " < prev-oldest %" PRIaTXN
+                     ", steady-txn %" PRIaTXN,
+                     i, snap_nreaders, (size_t)pid, reader_txnid, prev_oldest, steady.txnid);
+            }
+            continue;
+          }
 
-      if (unlikely(reader_txnid < prev_oldest)) {
-        if (unlikely(nothing_changed_signature == atomic_load32(&lck->rdt_refresh_flag, mo_AcquireRelease)) &&
-            safe64_reset_compare(&lck->rdt[i].txnid, reader_txnid)) {
-          NOTICE("kick stuck reader[%zu of %zu].pid_%zu %" PRIaTXN " < prev-oldest %" PRIaTXN ", steady-txn %" PRIaTXN,
-                 i, snap_nreaders, (size_t)pid, reader_txnid, prev_oldest, steady.txnid);
+          if (reader_txnid < shard_oldest) {
+            shard_oldest = reader_txnid;
+            shard_retired = reader_retired;
+            if (MDBX_CHECKING < 1 && shard_oldest == prev_oldest)
+              break;
+          }
         }
-        continue;
+        lck->rdt_shard_cache[shard].retired = shard_retired;
+        osal_compiler_barrier();
+        lck->rdt_shard_cache[shard].oldest = shard_oldest;
       }
 
-      if (reader_txnid < result.oldest_txnid) {
-        result.oldest_txnid = reader_txnid;
-        oldest_retired_pages = reader_retired;
-        if (MDBX_CHECKING < 1 && result.oldest_txnid == prev_oldest)
-          break;
+      if (lck->rdt_shard_cache[shard].oldest < result.oldest_txnid) {
+        result.oldest_txnid = lck->rdt_shard_cache[shard].oldest;
+        oldest_retired_pages = lck->rdt_shard_cache[shard].retired;
       }
     }
   }
@@ -28228,6 +31738,7 @@ __cold int mvcc_cleanup_dead(MDBX_env *env, int rdt_locked, int *dead) {
       if (lck->rdt[ii].pid.weak == (size_t)pid) {
         DEBUG("clear stale reader pid %" PRIuPTR " txn %" PRIaTXN, (size_t)pid, lck->rdt[ii].txnid.weak);
         atomic_store32(&lck->rdt[ii].pid, 0, mo_Relaxed);
+        rdt_vacated(lck, &lck->rdt[ii]);
         atomic_store32(&lck->rdt_refresh_flag, true, mo_AcquireRelease);
         count++;
       }
@@ -28310,6 +31821,7 @@ __cold bool mvcc_kick_laggards(MDBX_txn *txn, const txnid_t straggler,
 #endif
           if (likely(ousted)) {
             ousted = safe64_reset_compare(&slot->txnid, slot_snap_mvcc);
+            rdt_shard_touch(lck, slot);
             NOTICE("ousted-%s parked read-txn %" PRIaTXN ", pid %zu, tid 0x%" PRIx64, ousted ? "complete" : "half",
                    slot_snap_mvcc, (size_t)pid, tid);
             eASSERT0(env, ousted || safe64_read(&slot->txnid) > orsi.oldest_txnid);
@@ -28355,11 +31867,13 @@ __cold bool mvcc_kick_laggards(MDBX_txn *txn, const txnid_t straggler,
       if (rc == 1) {
         /* hsr reported transaction (will be) aborted asynchronous */
         safe64_reset_compare(&stucked->txnid, straggler);
+        rdt_shard_touch(lck, stucked);
       } else {
         /* hsr reported reader process was killed and slot should be cleared */
         safe64_reset(&stucked->txnid, true);
         atomic_store64(&stucked->tid, MDBX_TID_TXN_OUSTED, mo_Relaxed);
         atomic_store32(&stucked->pid, 0, mo_AcquireRelease);
+        rdt_vacated(lck, stucked);
       }
     } else if (!notify_eof_of_loop) {
 #if MDBX_ENABLE_PROFGC
@@ -29055,6 +32569,31 @@ int osal_condpair_wait(osal_condpair_t *condpair, bool part) {
 #endif
 }
 
+int osal_condpair_timedwait(osal_condpair_t *condpair, bool part, unsigned timeout_ms) {
+#if defined(_WIN32) || defined(_WIN64)
+  DWORD code = SignalObjectAndWait(condpair->mutex, condpair->event[part], timeout_ms, FALSE);
+  if (code == WAIT_OBJECT_0 || code == WAIT_TIMEOUT) {
+    const DWORD relock = WaitForSingleObject(condpair->mutex, INFINITE);
+    if (relock == WAIT_OBJECT_0)
+      return (code == WAIT_TIMEOUT) ? MDBX_RESULT_TRUE : MDBX_SUCCESS;
+    code = relock;
+  }
+  return osal_waitstatus2errcode(code);
+#else
+  struct timespec abstime;
+  if (unlikely(clock_gettime(CLOCK_REALTIME, &abstime)))
+    return errno;
+  abstime.tv_sec += timeout_ms / 1000;
+  abstime.tv_nsec += (long)(timeout_ms % 1000) * 1000000l;
+  if (abstime.tv_nsec >= 1000000000l) {
+    abstime.tv_nsec -= 1000000000l;
+    abstime.tv_sec += 1;
+  }
+  const int err = pthread_cond_timedwait(&condpair->cond[part], &condpair->mutex, &abstime);
+  return (err == ETIMEDOUT) ? MDBX_RESULT_TRUE : err;
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 
 int osal_fastmutex_init(osal_fastmutex_t *fastmutex) {
@@ -29204,6 +32743,9 @@ int osal_ioring_create(osal_ioring_t *ior
 #if MDBX_HAVE_PWRITEV && defined(_SC_IOV_MAX)
   ASSERT(osal_iov_max > 0);
 #endif /* MDBX_HAVE_PWRITEV && _SC_IOV_MAX */
+#if MDBX_USE_IOURING
+  ior->uring.fd = -1 /* io_uring will be set up lazily */;
+#endif /* MDBX_USE_IOURING */
 
   ior->boundary = ptr_disp(ior->pool, ior->allocated);
   return MDBX_SUCCESS;
@@ -29383,6 +32925,222 @@ void osal_ioring_walk(osal_ioring_t *ior, iov_ctx_t *ctx,
   }
 }
 
+#if MDBX_USE_IOURING
+/* Количество одновременно находящихся в полёте операций записи, а также
+ * минимальное количество элементов ioring для использования io_uring вместо
+ * последовательных вызовов pwritev(). */
+#define IOR_URING_ENTRIES 128
+#define IOR_URING_THRESHOLD 4
+
+/* Ненулевое значение запоминает неудачу io_uring_setup() на уровне процесса,
+ * чтобы не повторять бесполезные попытки при каждом открытии БД. */
+static int osal_iouring_unavailable;
+
+static int ior_uring_setup(osal_ioring_t *ior) {
+  ASSERT(ior->uring.fd < 0 && !ior->uring.disabled);
+  ior->uring.disabled = true;
+  if (osal_iouring_unavailable)
+    return osal_iouring_unavailable;
+
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  const int fd = (int)syscall(__NR_io_uring_setup, IOR_URING_ENTRIES, &params);
+  if (fd < 0) {
+    const int err = errno;
+    NOTICE("io_uring is unavailable (err %d), fallback to %s", err, "pwritev()");
+    osal_iouring_unavailable = err ? err : MDBX_ENOSYS;
+    return osal_iouring_unavailable;
+  }
+
+  /* Ядро создаёт дескриптор io_uring с O_CLOEXEC, но явно убеждаемся в этом,
+   * чтобы дескриптор не унаследовался порожденными через fork()+exec() процессами. */
+  int err = MDBX_SUCCESS;
+  const int fd_flags = fcntl(fd, F_GETFD);
+  if (unlikely(fd_flags < 0 || (!(fd_flags & FD_CLOEXEC) && fcntl(fd, F_SETFD, fd_flags | FD_CLOEXEC) < 0))) {
+    err = errno;
+    ERROR("%s: io_uring %d, err %d", "fcntl(FD_CLOEXEC)", fd, err);
+    close(fd);
+    return err;
+  }
+
+  ior->uring.sq_ring_bytes = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ior->uring.cq_ring_bytes = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    if (ior->uring.cq_ring_bytes > ior->uring.sq_ring_bytes)
+      ior->uring.sq_ring_bytes = ior->uring.cq_ring_bytes;
+    ior->uring.cq_ring_bytes = 0;
+  }
+
+  ior->uring.sq_ring =
+      mmap(nullptr, ior->uring.sq_ring_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (unlikely(ior->uring.sq_ring == MAP_FAILED))
+    goto bailout;
+  ior->uring.cq_ring = ior->uring.sq_ring;
+  if (ior->uring.cq_ring_bytes) {
+    ior->uring.cq_ring = mmap(nullptr, ior->uring.cq_ring_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                              IORING_OFF_CQ_RING);
+    if (unlikely(ior->uring.cq_ring == MAP_FAILED))
+      goto bailout;
+  }
+  ior->uring.sqes = mmap(nullptr, params.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (unlikely(ior->uring.sqes == MAP_FAILED))
+    goto bailout;
+
+  ior->uring.sq_entries = params.sq_entries;
+  ior->uring.cq_entries = params.cq_entries;
+  ior->uring.sq_head = ptr_disp(ior->uring.sq_ring, params.sq_off.head);
+  ior->uring.sq_tail = ptr_disp(ior->uring.sq_ring, params.sq_off.tail);
+  ior->uring.sq_mask = ptr_disp(ior->uring.sq_ring, params.sq_off.ring_mask);
+  ior->uring.sq_array = ptr_disp(ior->uring.sq_ring, params.sq_off.array);
+  ior->uring.cq_head = ptr_disp(ior->uring.cq_ring, params.cq_off.head);
+  ior->uring.cq_tail = ptr_disp(ior->uring.cq_ring, params.cq_off.tail);
+  ior->uring.cq_mask = ptr_disp(ior->uring.cq_ring, params.cq_off.ring_mask);
+  ior->uring.cqes = ptr_disp(ior->uring.cq_ring, params.cq_off.cqes);
+  ior->uring.fd = fd;
+  ior->uring.disabled = false;
+  VERBOSE("io_uring %d: sq %u, cq %u entries", fd, params.sq_entries, params.cq_entries);
+  return MDBX_SUCCESS;
+
+bailout:
+  err = errno;
+  ERROR("%s: io_uring %d, err %d", "mmap", fd, err);
+  if (ior->uring.cq_ring != MAP_FAILED && ior->uring.cq_ring && ior->uring.cq_ring != ior->uring.sq_ring)
+    munmap(ior->uring.cq_ring, ior->uring.cq_ring_bytes);
+  if (ior->uring.sq_ring != MAP_FAILED && ior->uring.sq_ring)
+    munmap(ior->uring.sq_ring, ior->uring.sq_ring_bytes);
+  close(fd);
+  memset(&ior->uring, 0, sizeof(ior->uring));
+  ior->uring.fd = -1;
+  ior->uring.disabled = true;
+  return err;
+}
+
+static void ior_uring_destroy(osal_ioring_t *ior) {
+  if (ior->uring.fd >= 0) {
+    munmap(ior->uring.sqes, ior->uring.sq_entries * sizeof(struct io_uring_sqe));
+    if (ior->uring.cq_ring != ior->uring.sq_ring)
+      munmap(ior->uring.cq_ring, ior->uring.cq_ring_bytes);
+    munmap(ior->uring.sq_ring, ior->uring.sq_ring_bytes);
+    close(ior->uring.fd);
+  }
+  memset(&ior->uring, 0, sizeof(ior->uring));
+  ior->uring.fd = -1;
+}
+
+static inline int ior_uring_enter(const osal_ioring_t *ior, unsigned to_submit, unsigned min_complete) {
+  const int rc = (int)syscall(__NR_io_uring_enter, ior->uring.fd, to_submit, min_complete,
+                              min_complete ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+  return (rc >= 0) ? rc : -errno;
+}
+
+static inline size_t ior_item_bytes(const ior_item_t *item) {
+  size_t bytes = 0;
+  for (size_t i = 0; i < item->sgvcnt; ++i)
+    bytes += item->sgv[i].iov_len;
+  return bytes;
+}
+
+static unsigned ior_uring_reap(osal_ioring_t *ior, mdbx_filehandle_t fd, osal_ioring_write_result_t *r) {
+  unsigned head = *ior->uring.cq_head, reaped = 0;
+  const unsigned tail = atomic_load32((mdbx_atomic_uint32_t *)ior->uring.cq_tail, mo_AcquireRelease);
+  while (head != tail) {
+    const struct io_uring_cqe *const cqe = &ior->uring.cqes[head & *ior->uring.cq_mask];
+    ior_item_t *const item = (ior_item_t *)(uintptr_t)cqe->user_data;
+    const size_t expected = ior_item_bytes(item);
+    if (unlikely(cqe->res < 0 || (size_t)cqe->res != expected)) {
+      /* Ошибка или частичная запись: повторяем запись элемента целиком синхронно,
+       * так как повторная запись уже записанных данных безопасна. */
+      int err = (cqe->res < 0) ? -cqe->res : MDBX_SUCCESS;
+      if (err == MDBX_SUCCESS || err == EINTR || err == EAGAIN) {
+        WARNING("io_uring: %s write at offset %zu (%d of %zu bytes), retry with %s", err ? "failed" : "partial",
+                item->offset, cqe->res, expected, "pwritev()");
+        err = (item->sgvcnt == 1) ? osal_pwrite(fd, item->sgv[0].iov_base, item->sgv[0].iov_len, item->offset)
+                                  : osal_pwritev(fd, item->sgv, item->sgvcnt, item->offset);
+        r->wops += 1;
+      }
+      if (unlikely(err != MDBX_SUCCESS)) {
+        ERROR("io_uring: item %p (%zu), pgno %u, bytes %zu, offset %zu, err %d", __Wpedantic_format_voidptr(item),
+              item - ior->pool, ((page_t *)item->sgv[0].iov_base)->pgno, expected, item->offset, err);
+        if (r->err == MDBX_SUCCESS)
+          r->err = err;
+      }
+    }
+    r->wops += 1;
+    reaped += 1;
+    head += 1;
+  }
+  atomic_store32((mdbx_atomic_uint32_t *)ior->uring.cq_head, head, mo_AcquireRelease);
+  return reaped;
+}
+
+static osal_ioring_write_result_t ior_uring_write(osal_ioring_t *ior, mdbx_filehandle_t fd) {
+  osal_ioring_write_result_t r = {MDBX_SUCCESS, 0};
+  const unsigned mask = *ior->uring.sq_mask;
+  const unsigned limit = (ior->uring.sq_entries < ior->uring.cq_entries) ? ior->uring.sq_entries : ior->uring.cq_entries;
+  unsigned inflight = 0, unsubmitted = 0;
+  int uring_err = MDBX_SUCCESS;
+  ior_item_t *item = ior->pool;
+  while (true) {
+    unsigned tail = *ior->uring.sq_tail;
+    while (item <= ior->last && r.err == MDBX_SUCCESS && uring_err == MDBX_SUCCESS && inflight + unsubmitted < limit) {
+      ASSERT(item->sgvcnt > 0);
+      const unsigned index = tail & mask;
+      struct io_uring_sqe *const sqe = &ior->uring.sqes[index];
+      memset(sqe, 0, sizeof(*sqe));
+      sqe->opcode = IORING_OP_WRITEV;
+      sqe->fd = fd;
+      sqe->off = item->offset;
+      sqe->addr = (uintptr_t)item->sgv;
+      sqe->len = (unsigned)item->sgvcnt;
+      sqe->user_data = (uintptr_t)item;
+      ior->uring.sq_array[index] = index;
+      tail += 1;
+      unsubmitted += 1;
+      item = ior_next(item, item->sgvcnt);
+    }
+    atomic_store32((mdbx_atomic_uint32_t *)ior->uring.sq_tail, tail, mo_AcquireRelease);
+    if (!inflight && (!unsubmitted || uring_err != MDBX_SUCCESS))
+      break;
+
+    const int rc = ior_uring_enter(ior, uring_err ? 0 : unsubmitted, inflight + unsubmitted ? 1 : 0);
+    if (likely(rc >= 0)) {
+      ASSERT((unsigned)rc <= unsubmitted);
+      unsubmitted -= rc;
+      inflight += rc;
+      inflight -= ior_uring_reap(ior, fd, &r);
+    } else if (rc != -EINTR && rc != -EAGAIN && rc != -EBUSY) {
+      ERROR("%s: io_uring %d, err %d", "io_uring_enter", ior->uring.fd, -rc);
+      uring_err = -rc;
+      /* Обязательно дожидаемся завершения всех операций в полёте, так как
+       * сразу по возвращении буферы грязных страниц будут освобождены. */
+      while (inflight) {
+        const unsigned reaped = ior_uring_reap(ior, fd, &r);
+        inflight -= reaped;
+        if (!reaped)
+          osal_yield();
+      }
+    } else
+      inflight -= ior_uring_reap(ior, fd, &r);
+  }
+
+  if (unlikely(uring_err != MDBX_SUCCESS)) {
+    /* Отказ самого io_uring, а не ввода-вывода: отключаем io_uring и повторяем
+     * запись синхронно, так как повторная запись уже записанных данных безопасна. */
+    WARNING("disable io_uring %d due error %d, fallback to %s", ior->uring.fd, uring_err, "pwritev()");
+    ior_uring_destroy(ior);
+    ior->uring.disabled = true;
+    r.err = MDBX_SUCCESS;
+    for (item = ior->pool; item <= ior->last && r.err == MDBX_SUCCESS; item = ior_next(item, item->sgvcnt)) {
+      r.err = osal_pwritev(fd, item->sgv, item->sgvcnt, item->offset);
+      r.wops += 1;
+    }
+  }
+  ASSERT(inflight == 0);
+  return r;
+}
+#endif /* MDBX_USE_IOURING */
+
 osal_ioring_write_result_t osal_ioring_write(osal_ioring_t *ior, mdbx_filehandle_t fd) {
   osal_ioring_write_result_t r = {MDBX_SUCCESS, 0};
 
@@ -29576,6 +33334,12 @@ osal_ioring_write_result_t osal_ioring_write(osal_ioring_t *ior, mdbx_filehandle
 
 #else
   STATIC_ASSERT_MSG(sizeof(off_t) >= sizeof(size_t), "libmdbx requires 64-bit file I/O on 64-bit systems");
+#if MDBX_USE_IOURING
+  if (osal_ioring_used(ior) >= IOR_URING_THRESHOLD && !ior->uring.disabled &&
+      (ior->uring.fd >= 0 || ior_uring_setup(ior) == MDBX_SUCCESS))
+    return ior_uring_write(ior, fd);
+#endif /* MDBX_USE_IOURING */
+
   for (ior_item_t *item = ior->pool; item <= ior->last;) {
 #if MDBX_HAVE_PWRITEV
     ASSERT(item->sgvcnt > 0);
@@ -29583,9 +33347,6 @@ osal_ioring_write_result_t osal_ioring_write(osal_ioring_t *ior, mdbx_filehandle
       r.err = osal_pwrite(fd, item->sgv[0].iov_base, item->sgv[0].iov_len, item->offset);
     else
       r.err = osal_pwritev(fd, item->sgv, item->sgvcnt, item->offset);
-
-    // TODO: io_uring_prep_write(sqe, fd, ...);
-
     item = ior_next(item, item->sgvcnt);
 #else
     r.err = osal_pwrite(fd, item->single.iov_base, item->single.iov_len, item->offset);
@@ -29595,11 +33356,6 @@ osal_ioring_write_result_t osal_ioring_write(osal_ioring_t *ior, mdbx_filehandle
     if (unlikely(r.err != MDBX_SUCCESS))
       break;
   }
-
-  // TODO: io_uring_submit(&ring)
-  // TODO: err = io_uring_wait_cqe(&ring, &cqe);
-  // TODO: io_uring_cqe_seen(&ring, cqe);
-
 #endif /* !Windows */
   return r;
 }
@@ -29708,9 +33464,15 @@ void osal_ioring_destroy(osal_ioring_t *ior) {
   if (ior->overlapped_fd)
     CloseHandle(ior->overlapped_fd);
 #else
+#if MDBX_USE_IOURING
+  ior_uring_destroy(ior);
+#endif /* MDBX_USE_IOURING */
   osal_free(ior->pool);
 #endif
   memset(ior, 0, sizeof(osal_ioring_t));
+#if MDBX_USE_IOURING
+  ior->uring.fd = -1;
+#endif /* MDBX_USE_IOURING */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -30086,6 +33848,34 @@ int osal_write(mdbx_filehandle_t fd, const void *buf, size_t bytes) {
   }
 }
 
+int osal_read(mdbx_filehandle_t fd, void *buf, size_t bytes) {
+  const void *const begin = buf;
+  while (bytes > 0) {
+#if defined(_WIN32) || defined(_WIN64)
+    DWORD got = 0;
+    if (unlikely(!ReadFile(fd, buf, likely(bytes <= MAX_WRITE) ? (DWORD)bytes : MAX_WRITE, &got, nullptr))) {
+      const int rc = (int)GetLastError();
+      if (rc != ERROR_HANDLE_EOF && rc != ERROR_BROKEN_PIPE)
+        return rc;
+      got = 0;
+    }
+#else
+    const intptr_t got = read(fd, buf, likely(bytes <= MAX_WRITE) ? bytes : MAX_WRITE);
+    if (got < 0) {
+      const int rc = errno;
+      if (rc != EINTR)
+        return rc;
+      continue;
+    }
+#endif
+    if (unlikely(got == 0))
+      return (buf == begin) ? MDBX_RESULT_TRUE /* EOF */ : MDBX_ENODATA /* unexpected EOF */;
+    bytes -= got;
+    buf = ptr_disp(buf, got);
+  }
+  return MDBX_SUCCESS;
+}
+
 int osal_pwritev(mdbx_filehandle_t fd, struct iovec *iov, size_t sgvcnt, uint64_t offset) {
   size_t expected = 0;
   for (size_t i = 0; i < sgvcnt; ++i)
@@ -30309,6 +34099,19 @@ int osal_thread_join(osal_thread_t thread) {
 #endif
 }
 
+unsigned osal_cpu_count(void) {
+#if defined(_WIN32) || defined(_WIN64)
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  return si.dwNumberOfProcessors ? (unsigned)si.dwNumberOfProcessors : 1;
+#elif defined(_SC_NPROCESSORS_ONLN)
+  const long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return (n > 0) ? (unsigned)n : 1;
+#else
+  return 1;
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 
 int osal_msync(const osal_mmap_t *map, size_t length, enum osal_syncmode_bits mode_bits) {
@@ -32170,6 +35973,11 @@ void osal_ctor(void) {
     /* чтобы не описывать все 1024 исключения в valgrind_suppress.txt */
     osal_iov_max = 64;
 #endif /* MDBX_HAVE_PWRITEV */
+#if MDBX_USE_IOURING
+  if (RUNNING_ON_VALGRIND)
+    /* valgrind не отслеживает доступ ядра к буферам io_uring */
+    osal_iouring_unavailable = MDBX_ENOSYS;
+#endif /* MDBX_USE_IOURING */
 
 #if defined(_WIN32) || defined(_WIN64)
   SYSTEM_INFO si;
@@ -32264,6 +36072,567 @@ __cold void MDBX_PRINTF_ARGS(2, 3) poor_page(const page_t *mp, const char *fmt,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/* Page checksums, see MDBX_opt_page_checksum */
+
+static uint32_t crc32c_table[8][256];
+
+MDBX_MAYBE_UNUSED static uint32_t crc32c_fallback(uint32_t crc, const uint8_t *ptr, size_t bytes) {
+  /* slicing-by-8, bytewise loads to be independent of endianness */
+  while (bytes >= 8) {
+    crc ^= ptr[0] | (uint32_t)ptr[1] << 8 | (uint32_t)ptr[2] << 16 | (uint32_t)ptr[3] << 24;
+    crc = crc32c_table[7][crc & 0xff] ^ crc32c_table[6][(crc >> 8) & 0xff] ^ crc32c_table[5][(crc >> 16) & 0xff] ^
+          crc32c_table[4][crc >> 24] ^ crc32c_table[3][ptr[4]] ^ crc32c_table[2][ptr[5]] ^ crc32c_table[1][ptr[6]] ^
+          crc32c_table[0][ptr[7]];
+    ptr += 8;
+    bytes -= 8;
+  }
+  while (bytes--)
+    crc = crc32c_table[0][(crc ^ *ptr++) & 0xff] ^ (crc >> 8);
+  return crc;
+}
+
+#if !defined(MDBX_ATTRIBUTE_TARGET) && (__has_attribute(__target__) || __GNUC_PREREQ(5, 0))
+#define MDBX_ATTRIBUTE_TARGET(target) __attribute__((__target__(target)))
+#endif /* MDBX_ATTRIBUTE_TARGET */
+
+#if defined(__SSE4_2__)
+#define MDBX_ATTRIBUTE_TARGET_SSE42 /* nope */
+#elif defined(MDBX_ATTRIBUTE_TARGET) && defined(__ia32__)
+#define MDBX_ATTRIBUTE_TARGET_SSE42 MDBX_ATTRIBUTE_TARGET("sse4.2")
+#endif /* __SSE4_2__ */
+
+#ifdef MDBX_ATTRIBUTE_TARGET_SSE42
+MDBX_MAYBE_UNUSED MDBX_ATTRIBUTE_TARGET_SSE42 static uint32_t crc32c_sse42(uint32_t crc, const uint8_t *ptr,
+                                                                          size_t bytes) {
+#if defined(__x86_64__) || defined(__amd64__)
+  uint64_t crc64 = crc;
+  while (bytes >= 8) {
+    crc64 = _mm_crc32_u64(crc64, unaligned_peek_u64(1, ptr));
+    ptr += 8;
+    bytes -= 8;
+  }
+  crc = (uint32_t)crc64;
+#endif /* x86_64 */
+  while (bytes >= 4) {
+    crc = _mm_crc32_u32(crc, unaligned_peek_u32(1, ptr));
+    ptr += 4;
+    bytes -= 4;
+  }
+  while (bytes--)
+    crc = _mm_crc32_u8(crc, *ptr++);
+  return crc;
+}
+#endif /* MDBX_ATTRIBUTE_TARGET_SSE42 */
+
+#if defined(__ARM_FEATURE_CRC32) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#include <arm_acle.h>
+static uint32_t crc32c_armv8(uint32_t crc, const uint8_t *ptr, size_t bytes) {
+  while (bytes >= 8) {
+    crc = __crc32cd(crc, unaligned_peek_u64(1, ptr));
+    ptr += 8;
+    bytes -= 8;
+  }
+  while (bytes--)
+    crc = __crc32cb(crc, *ptr++);
+  return crc;
+}
+#define crc32c_impl crc32c_armv8
+#elif defined(__SSE4_2__) && defined(MDBX_ATTRIBUTE_TARGET_SSE42)
+#define crc32c_impl crc32c_sse42
+#elif defined(MDBX_ATTRIBUTE_TARGET_SSE42) && MDBX_HAVE_BUILTIN_CPU_SUPPORTS
+/* Selecting at runtime by pgsum_ctor(), depending on the available CPU features.
+ * Please don't ask to implement cpuid-based detection and don't make such PRs. */
+static uint32_t (*crc32c_impl)(uint32_t crc, const uint8_t *ptr, size_t bytes) = crc32c_fallback;
+#define CRC32C_RUNTIME_CHOICE 1
+#else
+#define crc32c_impl crc32c_fallback
+#endif /* crc32c_impl */
+
+__cold void pgsum_ctor(void) {
+  for (unsigned i = 0; i < 256; ++i) {
+    uint32_t crc = i;
+    for (unsigned bit = 0; bit < 8; ++bit)
+      crc = (crc >> 1) ^ (UINT32_C(0x82F63B78) & (0 - (crc & 1)));
+    crc32c_table[0][i] = crc;
+  }
+  for (unsigned i = 0; i < 256; ++i)
+    for (unsigned n = 1; n < 8; ++n)
+      crc32c_table[n][i] = (crc32c_table[n - 1][i] >> 8) ^ crc32c_table[0][crc32c_table[n - 1][i] & 0xff];
+
+#ifdef CRC32C_RUNTIME_CHOICE
+#if __has_builtin(__builtin_cpu_init) || defined(__BUILTIN_CPU_INIT__) || __GNUC_PREREQ(4, 8)
+  __builtin_cpu_init();
+#endif /* __builtin_cpu_init() */
+  if (__builtin_cpu_supports("sse4.2"))
+    crc32c_impl = crc32c_sse42;
+#endif /* CRC32C_RUNTIME_CHOICE */
+}
+
+static inline uint32_t pgsum_calc(const MDBX_env *env, const page_t *mp, const size_t npages) {
+  return ~crc32c_impl(~UINT32_C(0), (const uint8_t *)mp, pgno2bytes(env, npages));
+}
+
+static inline pgsum_header_t *pgsum_header(const MDBX_env *env) { return env->pgsum.map.base; }
+
+static inline mdbx_atomic_uint64_t *pgsum_entry(const MDBX_env *env, const pgno_t pgno) {
+  return ptr_disp(env->pgsum.map.base, sizeof(pgsum_header_t) + sizeof(uint64_t) * pgno);
+}
+
+#define PGSUM_SEEN_CACHE_SIZE 4096
+
+static inline mdbx_atomic_uint64_t *pgsum_seen(const MDBX_env *env, const uint64_t key) {
+  STATIC_ASSERT((PGSUM_SEEN_CACHE_SIZE & (PGSUM_SEEN_CACHE_SIZE - 1)) == 0);
+  return env->pgsum.seen + ((key * UINT64_C(0x9E3779B97F4A7C15)) >> 32) % PGSUM_SEEN_CACHE_SIZE;
+}
+
+static bool pgsum_header_valid(const MDBX_env *env, const meta_t *meta) {
+  const pgsum_header_t *const header = pgsum_header(env);
+  return env->pgsum.map.current >= sizeof(pgsum_header_t) && header->magic_and_version == MDBX_PGSUM_MAGIC &&
+         header->validator_id == MDBX_VALIDATOR_CRC32C && header->pagesize == env->ps &&
+         memcmp(&header->dxbid, &meta->dxbid, sizeof(bin128_t)) == 0;
+}
+
+static size_t pgsum_capacity(const MDBX_env *env) {
+  return (env->pgsum.map.current > sizeof(pgsum_header_t))
+             ? (env->pgsum.map.current - sizeof(pgsum_header_t)) / sizeof(uint64_t)
+             : 0;
+}
+
+/* Grows the checksums file to hold entries at least for the given number of
+ * pages. The file is never shrunk, since it could be mapped by other processes. */
+static int pgsum_resize(MDBX_env *env, size_t npages) {
+  size_t bytes = sizeof(pgsum_header_t) + sizeof(uint64_t) * npages;
+  bytes = ceil_powerof2(bytes, globals.sys_allocation_granularity);
+  if (bytes > env->pgsum.map.limit)
+    bytes = env->pgsum.map.limit;
+
+  uint64_t filesize;
+  int err = osal_filesize(env->pgsum.map.fd, &filesize);
+  if (unlikely(err != MDBX_SUCCESS))
+    return err;
+  if (bytes < filesize)
+    bytes = (filesize < env->pgsum.map.limit) ? (size_t)filesize : env->pgsum.map.limit;
+  if (bytes > env->pgsum.map.current) {
+    err = osal_mresize(MDBX_WRITEMAP, &env->pgsum.map, bytes, env->pgsum.map.limit);
+    VERBOSE("resize checksums-file to %zu bytes, err %d", bytes, err);
+  }
+  return err;
+}
+
+pathchar_t *pgsum_pathname(const pathchar_t *dxb_pathname) {
+  static const pathchar_t suffix[] = MDBX_CHECKSUM_SUFFIX;
+#if defined(_WIN32) || defined(_WIN64)
+  const size_t len = wcslen(dxb_pathname);
+#else
+  const size_t len = strlen(dxb_pathname);
+#endif
+  pathchar_t *const pathname = osal_malloc(sizeof(pathchar_t) * len + sizeof(suffix));
+  if (likely(pathname)) {
+    memcpy(pathname, dxb_pathname, sizeof(pathchar_t) * len);
+    memcpy(pathname + len, suffix, sizeof(suffix));
+  }
+  return pathname;
+}
+
+__cold int pgsum_open(MDBX_env *env, const mdbx_mode_t mode_bits) {
+  eASSERT0(env, env->options.page_checksum && env->pgsum.map.fd == INVALID_HANDLE_VALUE);
+
+  pathchar_t *const pathname = pgsum_pathname(env->pathname.dxb);
+  if (unlikely(!pathname))
+    return MDBX_ENOMEM;
+
+  const bool rdonly = (env->flags & MDBX_RDONLY) != 0;
+  int err = osal_openfile(rdonly ? MDBX_OPEN_DXB_READ : MDBX_OPEN_DXB_LAZY, env, pathname, &env->pgsum.map.fd,
+                          rdonly ? 0 : mode_bits);
+  if (unlikely(err != MDBX_SUCCESS)) {
+    if (rdonly && (err == MDBX_ENOFILE || err == MDBX_EACCESS)) {
+      NOTICE("page checksums are unavailable since %" MDBX_PRIsPATH " can't be opened, err %d", pathname, err);
+      err = MDBX_SUCCESS;
+    } else
+      ERROR("unable to open checksums-file %" MDBX_PRIsPATH ", err %d", pathname, err);
+    goto bailout;
+  }
+
+  uint64_t filesize;
+  err = osal_filesize(env->pgsum.map.fd, &filesize);
+  if (unlikely(err != MDBX_SUCCESS))
+    goto bailout;
+
+  const size_t limit = ceil_powerof2(sizeof(pgsum_header_t) + sizeof(uint64_t) * bytes2pgno(env, env->dxb_mmap.limit),
+                                     globals.sys_allocation_granularity);
+  err = osal_mmap(rdonly ? MDBX_RDONLY : MDBX_WRITEMAP, &env->pgsum.map, (filesize < limit) ? (size_t)filesize : limit,
+                  limit, 0, pathname);
+  if (unlikely(err != MDBX_SUCCESS)) {
+    ERROR("unable to map checksums-file %" MDBX_PRIsPATH ", err %d", pathname, err);
+    goto bailout;
+  }
+
+  env->pgsum.seen = osal_calloc(PGSUM_SEEN_CACHE_SIZE, sizeof(mdbx_atomic_uint64_t));
+  if (unlikely(!env->pgsum.seen)) {
+    err = MDBX_ENOMEM;
+    goto bailout;
+  }
+
+  troika_t troika = meta_tap(env);
+  if (pgsum_header_valid(env, meta_recent(env, &troika).ptr_c))
+    env->pgsum.capacity = pgsum_capacity(env);
+  else if (rdonly)
+    NOTICE("page checksums are unavailable since %" MDBX_PRIsPATH " is not initialized or mismatch the database",
+           pathname);
+
+  env->pgsum.writer = !rdonly && (env->flags & MDBX_WRITEMAP) == 0;
+  env->pgsum.verify = env->options.page_checksum > 1;
+  osal_free(pathname);
+  return MDBX_SUCCESS;
+
+bailout:
+  pgsum_close(env);
+  osal_free(pathname);
+  return err;
+}
+
+__cold void pgsum_close(MDBX_env *env) {
+  if (env->pgsum.map.base)
+    osal_munmap(&env->pgsum.map);
+  if (env->pgsum.map.fd != INVALID_HANDLE_VALUE)
+    (void)osal_closefile(env->pgsum.map.fd);
+  osal_free(env->pgsum.seen);
+  memset(&env->pgsum, 0, sizeof(env->pgsum));
+  env->pgsum.map.fd = INVALID_HANDLE_VALUE;
+}
+
+int pgsum_txn_begin(MDBX_env *env, const meta_ptr_t head, const txnid_t txnid) {
+  eASSERT0(env, env->pgsum.writer && env->pgsum.map.base);
+  env->pgsum.incomplete = false;
+  pgsum_header_t *const header = pgsum_header(env);
+  if (unlikely(env->pgsum.capacity == 0)) {
+    int err = pgsum_resize(env, bytes2pgno(env, env->dxb_mmap.current));
+    if (unlikely(err != MDBX_SUCCESS)) {
+      ERROR("unable to resize checksums-file, err %d", err);
+      return err;
+    }
+    if (!pgsum_header_valid(env, head.ptr_c)) {
+      NOTICE("initialize checksums-file for txn#%" PRIaTXN, txnid);
+      memset(header, 0, sizeof(pgsum_header_t));
+      header->validator_id = MDBX_VALIDATOR_CRC32C;
+      header->pagesize = env->ps;
+      memcpy(&header->dxbid, &head.ptr_c->dxbid, sizeof(bin128_t));
+      atomic_store64(&header->epoch, MAX_TXNID, mo_Relaxed);
+      atomic_store64(&header->maintained, 0, mo_AcquireRelease);
+      header->magic_and_version = MDBX_PGSUM_MAGIC;
+      env->pgsum.dirty = true;
+    }
+    env->pgsum.capacity = pgsum_capacity(env);
+  }
+
+  if (atomic_load64(&header->maintained, mo_AcquireRelease) != head.txnid) {
+    /* The previous transaction(s) was committed by the process(es) which
+     * do not maintain checksums, or a rollback to the steady point has been
+     * done. So the checksums are trustworthy only for pages written since now. */
+    DEBUG("restart checksums epoch at txn#%" PRIaTXN, txnid);
+    atomic_store64(&header->epoch, txnid, mo_AcquireRelease);
+    atomic_store64(&header->maintained, head.txnid, mo_AcquireRelease);
+    env->pgsum.dirty = true;
+  }
+  return MDBX_SUCCESS;
+}
+
+void pgsum_txn_committed(MDBX_env *env, const txnid_t head, const txnid_t committed) {
+  eASSERT0(env, env->pgsum.writer && env->pgsum.capacity);
+  pgsum_header_t *const header = pgsum_header(env);
+  if (likely(!env->pgsum.incomplete) && atomic_load64(&header->maintained, mo_Relaxed) == head) {
+    atomic_store64(&header->maintained, committed, mo_AcquireRelease);
+    env->pgsum.dirty = true;
+  }
+}
+
+int pgsum_sync(MDBX_env *env) {
+  eASSERT0(env, env->pgsum.writer && env->pgsum.dirty);
+  int err = osal_msync(&env->pgsum.map, env->pgsum.map.current, MDBX_SYNC_DATA);
+  if (likely(err == MDBX_SUCCESS))
+    env->pgsum.dirty = false;
+  else
+    ERROR("unable to sync checksums-file, err %d", err);
+  return err;
+}
+
+void pgsum_update(MDBX_env *env, const page_t *dp, const size_t npages) {
+  eASSERT0(env, env->pgsum.writer);
+  if (unlikely(dp->pgno >= env->pgsum.capacity)) {
+    int err = (env->pgsum.map.limit > env->pgsum.map.current)
+                  ? pgsum_resize(env, ((size_t)dp->pgno + 1 > bytes2pgno(env, env->dxb_mmap.current))
+                                          ? (size_t)dp->pgno + 1
+                                          : bytes2pgno(env, env->dxb_mmap.current))
+                  : MDBX_RESULT_TRUE;
+    if (err == MDBX_SUCCESS)
+      env->pgsum.capacity = pgsum_capacity(env);
+    if (unlikely(dp->pgno >= env->pgsum.capacity)) {
+      /* Checksum of this page could not be stored, but an obsolete one is
+       * possible to be in the file, therefore the current epoch should be
+       * terminated. */
+      VERBOSE("checksums are incomplete since page #%" PRIaPGNO " is beyond capacity %zu, err %d", dp->pgno,
+              env->pgsum.capacity, err);
+      env->pgsum.incomplete = true;
+      return;
+    }
+  }
+
+  VALGRIND_MAKE_MEM_DEFINED(dp, pgno2bytes(env, npages));
+  const uint32_t crc = pgsum_calc(env, dp, npages);
+  atomic_store64(pgsum_entry(env, dp->pgno), (uint64_t)(uint32_t)dp->txnid << 32 | crc, mo_Relaxed);
+  env->pgsum.dirty = true;
+#if MDBX_ENABLE_PGOP_STAT
+  env->lck->pgops.pgsum_computed.weak += 1;
+#endif /* MDBX_ENABLE_PGOP_STAT */
+}
+
+__hot int pgsum_verify(const MDBX_txn *txn, const page_t *mp) {
+  MDBX_env *const env = txn->env;
+  const pgno_t pgno = mp->pgno;
+  if (unlikely(pgno >= env->pgsum.capacity))
+    return MDBX_SUCCESS;
+
+  const txnid_t txnid = mp->txnid;
+  const uint64_t key = (uint64_t)(uint32_t)txnid << 32 | pgno;
+  mdbx_atomic_uint64_t *const seen = pgsum_seen(env, key);
+  if (atomic_load64(seen, mo_Relaxed) == key)
+    return MDBX_SUCCESS;
+
+  /* the order of loads is important, see pgsum_txn_begin() */
+  const pgsum_header_t *const header = pgsum_header(env);
+  const txnid_t maintained = atomic_load64(&header->maintained, mo_AcquireRelease);
+  const txnid_t epoch = atomic_load64(&header->epoch, mo_AcquireRelease);
+  if (txnid < epoch || txnid > maintained)
+    return MDBX_SUCCESS;
+
+  const uint64_t entry = atomic_load64(pgsum_entry(env, pgno), mo_Relaxed);
+  if (entry == 0 || (uint32_t)(entry >> 32) != (uint32_t)txnid)
+    return MDBX_SUCCESS;
+
+  size_t npages = 1;
+  if (is_largepage(mp)) {
+    npages = mp->pages;
+    if (unlikely(npages < 1 || pgno + npages > txn->geo.first_unallocated))
+      /* leave it for the page_check() */
+      return MDBX_SUCCESS;
+  }
+
+  const uint32_t crc = pgsum_calc(env, mp, npages);
+#if MDBX_ENABLE_PGOP_STAT
+  env->lck->pgops.pgsum_verified.weak += 1;
+#endif /* MDBX_ENABLE_PGOP_STAT */
+  if (unlikely(crc != (uint32_t)entry)) {
+#if MDBX_ENABLE_PGOP_STAT
+    env->lck->pgops.pgsum_mismatch.weak += 1;
+#endif /* MDBX_ENABLE_PGOP_STAT */
+    return bad_page(mp, "checksum mismatch (%08x) != expected (%08x)\n", crc, (uint32_t)entry);
+  }
+
+  atomic_store64(seen, key, mo_Relaxed);
+  return MDBX_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+/* Hot-page map, see mdbx_env_hotmap_save() */
+
+pathchar_t *hotmap_pathname(const pathchar_t *lck_pathname) {
+  static const pathchar_t suffix[] = MDBX_HOTMAP_SUFFIX;
+#if defined(_WIN32) || defined(_WIN64)
+  const size_t len = wcslen(lck_pathname);
+#else
+  const size_t len = strlen(lck_pathname);
+#endif
+  pathchar_t *const pathname = osal_malloc(sizeof(pathchar_t) * len + sizeof(suffix));
+  if (likely(pathname)) {
+    memcpy(pathname, lck_pathname, sizeof(pathchar_t) * len);
+    memcpy(pathname + len, suffix, sizeof(suffix));
+  }
+  return pathname;
+}
+
+static inline unsigned hotmap_unit_ln2(const MDBX_env *env) {
+  return (env->ps2ln > globals.sys_pagesize_ln2) ? env->ps2ln : globals.sys_pagesize_ln2;
+}
+
+static inline size_t hotmap_bytes(const uint64_t units) {
+  return sizeof(hotmap_header_t) + (size_t)((units + 63) / 64) * sizeof(uint64_t);
+}
+
+static uint32_t hotmap_checksum(const hotmap_header_t *map) {
+  return ~crc32c_impl(~UINT32_C(0), (const uint8_t *)(map + 1), hotmap_bytes(map->units) - sizeof(hotmap_header_t));
+}
+
+#if MDBX_USE_MINCORE
+/* Acquire guard to avoid collision with remap, the same way as env_sync() does around dxb_msync(). */
+static int hotmap_remap_guard(MDBX_env *env, bool acquire) {
+#if defined(_WIN32) || defined(_WIN64)
+  if (acquire)
+    imports.srwl_AcquireShared(&env->remap_lock);
+  else
+    imports.srwl_ReleaseShared(&env->remap_lock);
+  return MDBX_SUCCESS;
+#else
+  return acquire ? osal_fastmutex_acquire(&env->remap_lock) : osal_fastmutex_release(&env->remap_lock);
+#endif
+}
+#endif /* MDBX_USE_MINCORE */
+
+__cold int hotmap_save(MDBX_env *env) {
+#if MDBX_USE_MINCORE
+  /* The meta-pages and the mapping are sampled under the remap guard, but it is released between the batches
+   * of mincore() so as not to stall a writer for long, since the map is just a hint. */
+  int err = hotmap_remap_guard(env, true);
+  if (unlikely(err != MDBX_SUCCESS))
+    return err;
+  const troika_t troika = meta_tap(env);
+  const meta_ptr_t head = meta_recent(env, &troika);
+  const txnid_t txnid = head.txnid;
+  bin128_t dxbid;
+  memcpy(&dxbid, &head.ptr_c->dxbid, sizeof(bin128_t));
+  size_t used_bytes = pgno_ceil2os_bytes(env, head.ptr_v->geometry.first_unallocated);
+  if (used_bytes > env->dxb_mmap.current)
+    used_bytes = env->dxb_mmap.current;
+  err = hotmap_remap_guard(env, false);
+  if (unlikely(err != MDBX_SUCCESS))
+    return err;
+
+  const unsigned unit_ln2 = hotmap_unit_ln2(env);
+  const size_t units = (used_bytes + ((size_t)1 << unit_ln2) - 1) >> unit_ln2;
+  const size_t bytes = hotmap_bytes(units);
+  hotmap_header_t *const map = osal_calloc(1, bytes);
+  if (unlikely(!map))
+    return MDBX_ENOMEM;
+
+  /* опрашиваем ядро большими порциями, а не по 64 юнита как в mincore_fetch() */
+  const size_t batch = 65536 /* system pages per a single mincore() */;
+  uint8_t *const vector = osal_malloc(batch);
+  err = vector ? MDBX_SUCCESS : MDBX_ENOMEM;
+  uint64_t *const bitmap = (uint64_t *)(map + 1);
+  const unsigned shift = unit_ln2 - globals.sys_pagesize_ln2;
+  for (size_t offset = 0; err == MDBX_SUCCESS && offset < used_bytes;) {
+    size_t length = batch << globals.sys_pagesize_ln2;
+    if (length > used_bytes - offset)
+      length = used_bytes - offset;
+    err = hotmap_remap_guard(env, true);
+    if (unlikely(err != MDBX_SUCCESS))
+      break;
+    /* the database could be shrunk meanwhile */
+    if (offset + length > env->dxb_mmap.current)
+      length = (offset < env->dxb_mmap.current) ? env->dxb_mmap.current - offset : 0;
+    err = length ? mincore_probe(env, offset, length, vector) : ENOMEM;
+    int unlock_err = hotmap_remap_guard(env, false);
+    if (unlikely(unlock_err != MDBX_SUCCESS) && err == MDBX_SUCCESS)
+      err = unlock_err;
+    if (unlikely(err != MDBX_SUCCESS)) {
+      if (err == ENOMEM)
+        /* the rest is not mapped since the database was shrunk */
+        err = MDBX_SUCCESS;
+      break;
+    }
+#ifdef MINCORE_INCORE
+    STATIC_ASSERT(MINCORE_INCORE == 1);
+#endif
+    const size_t first = offset >> globals.sys_pagesize_ln2;
+    const size_t pages = length >> globals.sys_pagesize_ln2;
+    for (size_t i = 0; i < pages; ++i)
+      if (vector[i] & 1) {
+        const size_t unit = (first + i) >> shift;
+        bitmap[unit / 64] |= UINT64_C(1) << (unit % 64);
+      }
+    offset += length;
+  }
+  osal_free(vector);
+
+  if (likely(err == MDBX_SUCCESS)) {
+    map->magic_and_version = MDBX_HOTMAP_MAGIC;
+    map->pagesize = env->ps;
+    map->unit_ln2 = unit_ln2;
+    map->dxbid = dxbid;
+    map->txnid = txnid;
+    map->units = units;
+    for (size_t i = 0; i < (units + 63) / 64; ++i)
+      for (uint64_t word = bitmap[i]; word; word &= word - 1)
+        map->hot += 1;
+    map->checksum = hotmap_checksum(map);
+
+    pathchar_t *const pathname = hotmap_pathname(env->pathname.lck);
+    mdbx_filehandle_t fd = INVALID_HANDLE_VALUE;
+    err = pathname ? osal_openfile(MDBX_OPEN_DXB_LAZY, env, pathname, &fd, env->hotmap.mode) : MDBX_ENOMEM;
+    if (likely(err == MDBX_SUCCESS)) {
+      /* the file is overwritten in-place, so a torn map will be rejected by the checksum */
+      err = osal_pwrite(fd, map, bytes, 0);
+      if (likely(err == MDBX_SUCCESS))
+        err = osal_fsetsize(fd, bytes);
+      (void)osal_closefile(fd);
+    }
+    if (likely(err == MDBX_SUCCESS))
+      VERBOSE("hot-page map saved: %" PRIu64 " of %zu units, txn#%" PRIaTXN, map->hot, units, txnid);
+    else if (pathname)
+      NOTICE("unable to save hot-page map %" MDBX_PRIsPATH ", err %d", pathname, err);
+    osal_free(pathname);
+  }
+
+  osal_free(map);
+  return err;
+#else
+  (void)env;
+  return MDBX_ENOSYS;
+#endif /* MDBX_USE_MINCORE */
+}
+
+__cold int hotmap_load(const MDBX_env *env, const meta_t *meta, hotmap_header_t **pmap) {
+  *pmap = nullptr;
+  pathchar_t *const pathname = hotmap_pathname(env->pathname.lck);
+  if (unlikely(!pathname))
+    return MDBX_ENOMEM;
+
+  hotmap_header_t *map = nullptr;
+  uint64_t filesize = 0;
+  mdbx_filehandle_t fd = INVALID_HANDLE_VALUE;
+  int err = osal_openfile(MDBX_OPEN_DXB_READ, env, pathname, &fd, 0);
+  if (likely(err == MDBX_SUCCESS)) {
+    err = osal_filesize(fd, &filesize);
+    if (likely(err == MDBX_SUCCESS)) {
+      const unsigned unit_ln2 = hotmap_unit_ln2(env);
+      if (filesize < sizeof(hotmap_header_t) || filesize > hotmap_bytes(env->dxb_mmap.limit >> unit_ln2))
+        err = MDBX_ENODATA;
+      else if (unlikely(!(map = osal_malloc((size_t)filesize))))
+        err = MDBX_ENOMEM;
+      else
+        err = osal_pread(fd, map, (size_t)filesize, 0);
+    }
+    (void)osal_closefile(fd);
+  }
+
+  if (err == MDBX_ENOFILE)
+    err = MDBX_ENODATA;
+  else if (err == MDBX_SUCCESS &&
+           (map->magic_and_version != MDBX_HOTMAP_MAGIC || map->pagesize != env->ps ||
+            map->unit_ln2 != hotmap_unit_ln2(env) || filesize != hotmap_bytes(map->units) ||
+            memcmp(&map->dxbid, &meta->dxbid, sizeof(bin128_t)) != 0 || map->checksum != hotmap_checksum(map))) {
+    NOTICE("hot-page map %" MDBX_PRIsPATH " is stale or corrupted", pathname);
+    err = MDBX_ENODATA;
+  }
+
+  if (likely(err == MDBX_SUCCESS))
+    *pmap = map;
+  else
+    osal_free(map);
+  osal_free(pathname);
+  return err;
+}
+
+__cold int mdbx_env_hotmap_save(const MDBX_env *env) {
+  int rc = check_env(env, true);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  return LOG_IFERR(hotmap_save((MDBX_env *)env));
+}
+
+/*----------------------------------------------------------------------------*/
+
 MDBX_CONST_FUNCTION static clc_t value_clc(const MDBX_cursor *mc) {
   if (likely((mc->flags & z_inner) == 0))
     return mc->clc->v;
@@ -32633,6 +37002,8 @@ static __always_inline int check_page_header(const uint16_t ILL, const page_t *p
 __cold static __noinline pgr_t check_page_complete(const uint16_t ILL, page_t *page, const MDBX_cursor *const mc,
                                                    const txnid_t front) {
   pgr_t r = {page, check_page_header(ILL, page, mc->txn, front)};
+  if (likely(r.err == MDBX_SUCCESS))
+    r.err = pgsum_check(mc->txn, page);
   if (likely(r.err == MDBX_SUCCESS))
     r.err = page_check(mc, page);
   if (unlikely(r.err != MDBX_SUCCESS))
@@ -32695,13 +37066,13 @@ static __always_inline pgr_t page_get_inline(const uint16_t ILL, const MDBX_curs
   pgr_t r = page_get_unchecked(mc->txn, pgno, front);
   if (likely(r.err == MDBX_SUCCESS)) {
     if (likely(mc->checking & z_pagecheck) == 0) {
-#if MDBX_DISABLE_VALIDATION
-      return r;
-#else
+#if !MDBX_DISABLE_VALIDATION
       r.err = check_page_header(ILL, r.page, txn, front);
+#endif /* MDBX_DISABLE_VALIDATION */
+      if (likely(r.err == MDBX_SUCCESS))
+        r.err = pgsum_check(txn, r.page);
       if (likely(r.err == MDBX_SUCCESS))
         return r;
-#endif /* MDBX_DISABLE_VALIDATION */
     } else
       return check_page_complete(ILL, r.page, mc, front);
   }
@@ -32870,6 +37241,8 @@ int iov_page(MDBX_txn *txn, iov_ctx_t *ctx, page_t *dp, size_t npages) {
     cASSERT0(txn, !(txn->flags & MDBX_WRITEMAP));
     dp->txnid = txn->txnid;
     cASSERT0(txn, is_spilled(txn, dp));
+    if (env->pgsum.writer)
+      pgsum_update(env, dp, npages);
 #if MDBX_AVOID_MSYNC
   doit:;
 #endif /* MDBX_AVOID_MSYNC */
@@ -33016,8 +37389,12 @@ __cold pgr_t __must_check_result page_unspill(MDBX_txn *const txn, const page_t
     ret.err = page_dirty(txn, ret.page, npages);
     if (unlikely(ret.err != MDBX_SUCCESS))
       return ret;
+    /* Страница понадобилась после выталкивания, т.е. её повторное выталкивание скорее всего
+     * снова обернется чтением с диска, поэтому взводим бит для MDBX_spill_clock */
+    *(size_t *)ptr_disp(ret.page, -(ptrdiff_t)sizeof(size_t)) |= DPL_LRU_REFBIT;
     if (MDBX_ENABLE_PGOP_STAT)
       txn->env->lck->pgops.unspill.weak += npages;
+    txn->wr.spill_stat.unspilled += npages;
     ret.page->flags |= (scan == txn) ? 0 : P_SPILLED;
     ret.err = MDBX_SUCCESS;
     return ret;
@@ -33043,14 +37420,16 @@ __hot int page_touch_modifable(MDBX_txn *txn, const page_t *const mp) {
     VERBOSE("unspill page %" PRIaPGNO, mp->pgno);
     if (MDBX_ENABLE_PGOP_STAT)
       txn->env->lck->pgops.unspill.weak += 1;
+    txn->wr.spill_stat.unspilled += 1;
     return page_dirty(txn, (page_t *)mp, 1);
   }
 
   cASSERT0(txn, n > 0 && n <= txn->wr.dirtylist->length);
   cASSERT0(txn, txn->wr.dirtylist->items[n].pgno == mp->pgno && txn->wr.dirtylist->items[n].ptr == mp);
   if (!MDBX_AVOID_MSYNC || (txn->flags & MDBX_WRITEMAP) == 0) {
+    /* Повторное обращение к грязной странице, взводим бит для MDBX_spill_clock */
     size_t *const ptr = ptr_disp(txn->wr.dirtylist->items[n].ptr, -(ptrdiff_t)sizeof(size_t));
-    *ptr = txn->wr.dirtylru;
+    *ptr = txn->wr.dirtylru | DPL_LRU_REFBIT;
   }
   return MDBX_SUCCESS;
 }
@@ -35740,7 +40119,8 @@ __cold void rthc_thread_dtor(void *rthc) {
           __Wpedantic_format_voidptr(end), (int)(slot - begin), (size_t)slot->pid.weak, (size_t)current_pid);
     if (atomic_load_pid(&slot->pid, mo_Relaxed) == current_pid) {
       TRACE("==== thread 0x%" PRIxPTR ", rthc %p, cleanup", osal_thread_self(), __Wpedantic_format_voidptr(slot));
-      (void)atomic_cas32(&slot->pid, current_pid, 0);
+      if (atomic_cas32(&slot->pid, current_pid, 0))
+        rdt_vacated(env->lck_mmap.lck, slot);
       atomic_store32(&env->lck->rdt_refresh_flag, true, mo_Relaxed);
     }
   }
@@ -35834,7 +40214,8 @@ __cold static int rthc_drown(MDBX_env *const env) {
       bool cleaned = false;
       for (reader_slot_t *slot = begin; slot < end; ++slot) {
         if (atomic_load_pid(&slot->pid, mo_Relaxed) == current_pid) {
-          (void)atomic_cas32(&slot->pid, current_pid, 0);
+          if (atomic_cas32(&slot->pid, current_pid, 0))
+            rdt_vacated(env->lck_mmap.lck, slot);
           TRACE("== cleanup %p", __Wpedantic_format_voidptr(slot));
           cleaned = true;
         }
@@ -35896,6 +40277,9 @@ __cold void rthc_afterfork(void) {
 #endif /* ENABLE_MEMCHECK */
     }
     env->lck = lckless_stub(env);
+    env_flusher_afterfork(env);
+    env_defragger_afterfork(env);
+    env_hotmap_afterfork(env);
     rthc_drown(env);
   }
   if (rthc_table != rthc_table_static)
@@ -35981,7 +40365,8 @@ __cold void rthc_dtor(const mdbx_pid_t current_pid) {
             i, (uintptr_t)env->me_txkey, __Wpedantic_format_voidptr(begin), __Wpedantic_format_voidptr(end),
             __Wpedantic_format_voidptr(slot), (int)(slot - begin), (size_t)slot->pid.weak, (size_t)current_pid);
       if (atomic_load_pid(&slot->pid, mo_Relaxed) == current_pid) {
-        (void)atomic_cas32(&slot->pid, current_pid, 0);
+        if (atomic_cas32(&slot->pid, current_pid, 0))
+          rdt_vacated(env->lck_mmap.lck, slot);
         TRACE("== cleanup %p", __Wpedantic_format_voidptr(slot));
         cleaned = true;
       }
@@ -36053,6 +40438,7 @@ static int spill_page(MDBX_txn *txn, iov_ctx_t *ctx, page_t *dp, const size_t np
   cASSERT0(txn, !(txn->flags & MDBX_WRITEMAP));
   if (MDBX_ENABLE_PGOP_STAT)
     txn->env->lck->pgops.spill.weak += npages;
+  txn->wr.spill_stat.spilled += npages;
   const pgno_t pgno = dp->pgno;
   int err = iov_page(txn, ctx, dp, npages);
   if (likely(err == MDBX_SUCCESS))
@@ -36079,7 +40465,7 @@ static size_t spill_cursor_keep(const MDBX_txn *const txn, const MDBX_cursor *mc
         if (txn->wr.dirtylist->items[n].pgno == mp->pgno &&
             /* не считаем дважды */ txn_dpl_age(txn, n)) {
           size_t *const ptr = ptr_disp(txn->wr.dirtylist->items[n].ptr, -(ptrdiff_t)sizeof(size_t));
-          *ptr = txn->wr.dirtylru;
+          *ptr = txn->wr.dirtylru | (*ptr & DPL_LRU_REFBIT);
           cASSERT0(txn, txn_dpl_age(txn, n) == 0);
           ++keep;
           DEBUG("keep page %" PRIaPGNO " (%p), dbi %zu, %scursor %p[%zu]", mp->pgno, __Wpedantic_format_voidptr(mp),
@@ -36149,6 +40535,10 @@ MDBX_NOTHROW_PURE_FUNCTION static unsigned spill_prio(const MDBX_txn *txn, const
   cASSERT0(txn, age * (uint64_t)reciprocal < UINT32_MAX);
   unsigned prio = age * reciprocal >> 24;
   cASSERT0(txn, prio < 256);
+  if (txn->env->options.spill_policy == MDBX_spill_clock && txn_dpl_referenced(txn, i))
+    /* Второй шанс: к странице обращались повторно, поэтому после выталкивания она скорее всего
+     * будет прочитана с диска обратно. Учитываем эту цену вдвое уменьшая возраст страницы. */
+    prio >>= 1;
   if (likely(npages == 1))
     return prio = 256 - prio;
 
@@ -36199,6 +40589,7 @@ __cold int spill_slowpath(MDBX_txn *const txn, MDBX_cursor *const m0, const intp
   if (txn->flags & MDBX_WRITEMAP) {
     NOTICE("%s-spilling %zu dirty-entries, %zu dirty-npages", "msync", dirty_entries, dirty_npages);
     const MDBX_env *env = txn->env;
+    txn->wr.spill_stat.spilled += dirty_npages;
     cASSERT0(txn, txn->wr.spilled.list == nullptr);
     rc = dxb_msync(txn->env, txn->geo.first_unallocated, MDBX_SYNC_KICK);
     if (unlikely(rc != MDBX_SUCCESS))
@@ -36273,6 +40664,9 @@ __cold int spill_slowpath(MDBX_txn *const txn, MDBX_cursor *const m0, const intp
    *    повторно изменяются;
    *  - при прочих равных лучше выталкивать смежные страницы, так будет
    *    меньше I/O операций;
+   *  - при MDBX_spill_clock лучше не выталкивать страницы, к которым повторно
+   *    обращались после предыдущего выталкивания, так как их придется читать
+   *    с диска обратно;
    *  - желательно потратить на это меньше времени чем std::partial_sort_copy;
    *
    * Решение:
@@ -36287,7 +40681,10 @@ __cold int spill_slowpath(MDBX_txn *const txn, MDBX_cursor *const m0, const intp
    *    I/O операций выталкиваем и их, если они попадают в первую половину
    *    между выталкиваемыми и самыми свежими lru-метками;
    *  - дополнительно при сортировке умышленно старим large/overflow страницы,
-   *    тем самым повышая их шансы на выталкивание. */
+   *    тем самым повышая их шансы на выталкивание;
+   *  - при MDBX_spill_clock вдвое "омолаживаем" страницы со взведенным битом
+   *    повторного обращения, а после выталкивания сбрасываем эти биты у всех
+   *    оставшихся страниц, подобно стрелке CLOCK. */
 
   /* get min/max of LRU-labels */
   uint32_t age_max = 0;
@@ -36416,6 +40813,12 @@ __cold int spill_slowpath(MDBX_txn *const txn, MDBX_cursor *const m0, const intp
     }
   }
 
+  if (txn->env->options.spill_policy == MDBX_spill_clock)
+    for (size_t i = 1; i <= dl->length; ++i) {
+      size_t *const ptr = ptr_disp(dl->items[i].ptr, -(ptrdiff_t)sizeof(size_t));
+      *ptr &= ~(size_t)DPL_LRU_REFBIT;
+    }
+
 #if xMDBX_DEBUG_SPILLING == 2
   if (txn->wr.loose_count + txn->wr.dirtyroom <= need / 2 + 1)
     ERROR("dirty-list length: before %zu, after %zu, parent %zi, loose %zu; "
@@ -38338,6 +42741,30 @@ __hot __noinline int tree_deepen_lowest(MDBX_cursor *mc) {
   return tree_deepen_edge(mc, Z_FIRST);
 }
 
+/* Checks whether the key is within the subtree of the page at the given level of the cursor stack,
+ * i.e. within the range bounded by the nearest separator keys of the ancestor pages. */
+static bool tree_covers(const MDBX_cursor *mc, intptr_t level, const MDBX_val *key) {
+  bool has_lower = false, has_upper = false;
+  while (--level >= 0 && !(has_lower && has_upper)) {
+    const page_t *const mp = mc->pg[level];
+    const size_t ki = mc->ki[level];
+    cASSERT0(mc, is_branch(mp) && ki < page_numkeys(mp));
+    if (!has_lower && ki > 0) {
+      const MDBX_val separator = get_key(page_node(mp, ki));
+      if (mc->clc->k.cmp(key, &separator) < 0)
+        return false;
+      has_lower = true;
+    }
+    if (!has_upper && ki + 1 < page_numkeys(mp)) {
+      const MDBX_val separator = get_key(page_node(mp, ki + 1));
+      if (mc->clc->k.cmp(key, &separator) >= 0)
+        return false;
+      has_upper = true;
+    }
+  }
+  return true;
+}
+
 __hot int tree_search(MDBX_cursor *mc, const MDBX_val *key, int flags) {
   int err;
   if (unlikely(mc->txn->flags & MDBX_TXN_BLOCKED)) {
@@ -38363,6 +42790,19 @@ __hot int tree_search(MDBX_cursor *mc, const MDBX_val *key, int flags) {
   }
 
   cASSERT0(mc, root >= NUM_METAS && root < mc->txn->geo.first_unallocated);
+  DKBUF_DEBUG;
+  page_t *mp;
+  if (flags == 0 && mc->top > 0 && (mc->flags & z_tree_search_fastpath) != 0 && mc->pg[0]->pgno == root) {
+    /* Fastpath for a cursor which opted in for a series of lookups, i.e. inside mdbx_get_many():
+     * the cursor stack remains valid, so climb up only as far as the lowest common ancestor of the current
+     * position and the key, instead of descending from the root. */
+    intptr_t top = mc->top;
+    while (top > 0 && !tree_covers(mc, top, key))
+      --top;
+    mc->top = (int8_t)top;
+    goto descend;
+  }
+
   if (mc->top < 0 || mc->pg[0]->pgno != root) {
     err = page_get(mc, root, &mc->pg[0], tbl_root_txnid(mc->txn, cursor_dbi(mc)));
     if (unlikely(err != MDBX_SUCCESS))
@@ -38385,8 +42825,8 @@ __hot int tree_search(MDBX_cursor *mc, const MDBX_val *key, int flags) {
   if (flags & (Z_FIRST | Z_LAST))
     return tree_deepen_edge(mc, flags);
 
-  DKBUF_DEBUG;
-  page_t *mp = mc->pg[mc->top];
+descend:
+  mp = mc->pg[mc->top];
   while (is_branch(mp)) {
     DEBUG("branch page %" PRIaPGNO " has %zu keys", mp->pgno, page_numkeys(mp));
     cASSERT0(mc, page_numkeys(mp) > 1);
@@ -38460,6 +42900,286 @@ __hot __noinline int tree_deepen_edge(MDBX_cursor *mc, int flags) {
 
 /* ---------------------------------------------------------------------------------------------------- */
 
+/* Vectorized kernels for the last levels of search within pages with fixed-size integer keys.
+ *
+ * Each kernel returns the count of keys less than the given one within a range of the sorted keys,
+ * i.e. the position of the lower bound relative to the start of the range. DUPFIX-leaves hold keys
+ * at a fixed stride and are loaded directly, whereas keys of branch-pages are referenced through
+ * the entries[] of a page and are gathered. The ranges are small, since the binary search narrows
+ * to the window of SEARCH_SIMD_WINDOW bytes before a kernel is called. */
+
+#define SEARCH_SIMD_WINDOW 128
+
+MDBX_NOTHROW_PURE_FUNCTION static inline size_t dupfix32_rank_tail(const uint8_t *keys, size_t n, const uint32_t key) {
+  size_t r = 0;
+  for (size_t i = 0; i < n; ++i)
+    r += unaligned_peek_u32(4, keys + i * 4) < key;
+  return r;
+}
+
+MDBX_NOTHROW_PURE_FUNCTION static inline size_t dupfix64_rank_tail(const uint8_t *keys, size_t n, const uint64_t key) {
+  size_t r = 0;
+  for (size_t i = 0; i < n; ++i)
+    r += unaligned_peek_u64(4, keys + i * 8) < key;
+  return r;
+}
+
+MDBX_MAYBE_UNUSED MDBX_NOTHROW_PURE_FUNCTION static inline size_t
+branch32_rank_tail(const page_t *mp, size_t i, const size_t end, const uint32_t key) {
+  size_t r = 0;
+  for (; i < end; ++i)
+    r += unaligned_peek_u32(2, node_key(page_node(mp, i))) < key;
+  return r;
+}
+
+MDBX_MAYBE_UNUSED MDBX_NOTHROW_PURE_FUNCTION static inline size_t
+branch64_rank_tail(const page_t *mp, size_t i, const size_t end, const uint64_t key) {
+  size_t r = 0;
+  for (; i < end; ++i)
+    r += unaligned_peek_u64(2, node_key(page_node(mp, i))) < key;
+  return r;
+}
+
+#ifdef MDBX_ATTRIBUTE_TARGET_SSE2
+MDBX_MAYBE_UNUSED __hot MDBX_ATTRIBUTE_TARGET_SSE2 static size_t dupfix32_rank_sse2(const uint8_t *keys, size_t n,
+                                                                                    const uint32_t key) {
+  /* there is no unsigned comparison in SSE2, so flip the sign bits for signed one */
+  const __m128i bias = _mm_set1_epi32(INT32_MIN);
+  const __m128i pattern = _mm_xor_si128(_mm_set1_epi32((int32_t)key), bias);
+  __m128i acc = _mm_setzero_si128();
+  for (; n >= 4; n -= 4, keys += 16) {
+    const __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)keys), bias);
+    acc = _mm_sub_epi32(acc, _mm_cmplt_epi32(v, pattern));
+  }
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+  return (uint32_t)_mm_cvtsi128_si32(acc) + dupfix32_rank_tail(keys, n, key);
+}
+#endif /* MDBX_ATTRIBUTE_TARGET_SSE2 */
+
+#ifdef MDBX_ATTRIBUTE_TARGET_AVX2
+MDBX_ATTRIBUTE_TARGET_AVX2 static __always_inline size_t hsum32_avx2(const __m256i acc) {
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  return (uint32_t)_mm_cvtsi128_si32(sum);
+}
+
+MDBX_ATTRIBUTE_TARGET_AVX2 static __always_inline size_t hsum64_avx2(const __m256i acc) {
+  __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+  sum = _mm_add_epi64(sum, _mm_unpackhi_epi64(sum, sum));
+  /* the counters are small, so the lower 32 bits are enough */
+  return (uint32_t)_mm_cvtsi128_si32(sum);
+}
+
+MDBX_MAYBE_UNUSED __hot MDBX_ATTRIBUTE_TARGET_AVX2 static size_t dupfix32_rank_avx2(const uint8_t *keys, size_t n,
+                                                                                    const uint32_t key) {
+  const __m256i bias = _mm256_set1_epi32(INT32_MIN);
+  const __m256i pattern = _mm256_xor_si256(_mm256_set1_epi32((int32_t)key), bias);
+  __m256i acc = _mm256_setzero_si256();
+  for (; n >= 8; n -= 8, keys += 32) {
+    const __m256i v = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)keys), bias);
+    acc = _mm256_sub_epi32(acc, _mm256_cmpgt_epi32(pattern, v));
+  }
+  return hsum32_avx2(acc) + dupfix32_rank_tail(keys, n, key);
+}
+
+MDBX_MAYBE_UNUSED __hot MDBX_ATTRIBUTE_TARGET_AVX2 static size_t dupfix64_rank_avx2(const uint8_t *keys, size_t n,
+                                                                                    const uint64_t key) {
+  const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+  const __m256i pattern = _mm256_xor_si256(_mm256_set1_epi64x((int64_t)key), bias);
+  __m256i acc = _mm256_setzero_si256();
+  for (; n >= 4; n -= 4, keys += 32) {
+    const __m256i v = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)keys), bias);
+    acc = _mm256_sub_epi64(acc, _mm256_cmpgt_epi64(pattern, v));
+  }
+  return hsum64_avx2(acc) + dupfix64_rank_tail(keys, n, key);
+}
+
+MDBX_MAYBE_UNUSED __hot MDBX_ATTRIBUTE_TARGET_AVX2 static size_t branch32_rank_avx2(const page_t *mp, size_t i,
+                                                                                    const size_t end,
+                                                                                    const uint32_t key) {
+  const int *const base = ptr_disp(mp, PAGEHDRSZ + NODESIZE);
+  const __m256i bias = _mm256_set1_epi32(INT32_MIN);
+  const __m256i pattern = _mm256_xor_si256(_mm256_set1_epi32((int32_t)key), bias);
+  __m256i acc = _mm256_setzero_si256();
+  for (; i + 8 <= end; i += 8) {
+    const __m256i offsets = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(mp->entries + i)));
+    const __m256i v = _mm256_xor_si256(_mm256_i32gather_epi32(base, offsets, 1), bias);
+    acc = _mm256_sub_epi32(acc, _mm256_cmpgt_epi32(pattern, v));
+  }
+  return hsum32_avx2(acc) + branch32_rank_tail(mp, i, end, key);
+}
+
+MDBX_MAYBE_UNUSED __hot MDBX_ATTRIBUTE_TARGET_AVX2 static size_t branch64_rank_avx2(const page_t *mp, size_t i,
+                                                                                    const size_t end,
+                                                                                    const uint64_t key) {
+  const long long *const base = ptr_disp(mp, PAGEHDRSZ + NODESIZE);
+  const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+  const __m256i pattern = _mm256_xor_si256(_mm256_set1_epi64x((int64_t)key), bias);
+  __m256i acc = _mm256_setzero_si256();
+  for (; i + 4 <= end; i += 4) {
+    const __m128i offsets = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)(mp->entries + i)));
+    const __m256i v = _mm256_xor_si256(_mm256_i32gather_epi64(base, offsets, 1), bias);
+    acc = _mm256_sub_epi64(acc, _mm256_cmpgt_epi64(pattern, v));
+  }
+  return hsum64_avx2(acc) + branch64_rank_tail(mp, i, end, key);
+}
+#endif /* MDBX_ATTRIBUTE_TARGET_AVX2 */
+
+#ifdef MDBX_ATTRIBUTE_TARGET_AVX512BW
+MDBX_ATTRIBUTE_TARGET_AVX512BW static __always_inline size_t hsum32_avx512(const __m512i acc) {
+  return hsum32_avx2(_mm256_add_epi32(_mm512_castsi512_si256(acc), _mm512_extracti64x4_epi64(acc, 1)));
+}
+
+MDBX_ATTRIBUTE_TARGET_AVX512BW static __always_inline size_t hsum64_avx512(const __m512i acc) {
+  return hsum64_avx2(_mm256_add_epi64(_mm512_castsi512_si256(acc), _mm512_extracti64x4_epi64(acc, 1)));
+}
+
+MDBX_MAYBE_UNUSED __hot MDBX_ATTRIBUTE_TARGET_AVX512BW static size_t dupfix32_rank_avx512bw(const uint8_t *keys,
+                                                                                            size_t n,
+                                                                                            const uint32_t key) {
+  const __m512i pattern = _mm512_set1_epi32((int32_t)key), one = _mm512_set1_epi32(1);
+  __m512i acc = _mm512_setzero_si512();
+  for (; n >= 16; n -= 16, keys += 64)
+    acc = _mm512_mask_add_epi32(acc, _mm512_cmplt_epu32_mask(_mm512_loadu_si512(keys), pattern), acc, one);
+  return hsum32_avx512(acc) + dupfix32_rank_tail(keys, n, key);
+}
+
+MDBX_MAYBE_UNUSED __hot MDBX_ATTRIBUTE_TARGET_AVX512BW static size_t dupfix64_rank_avx512bw(const uint8_t *keys,
+                                                                                            size_t n,
+                                                                                            const uint64_t key) {
+  const __m512i pattern = _mm512_set1_epi64((int64_t)key), one = _mm512_set1_epi64(1);
+  __m512i acc = _mm512_setzero_si512();
+  for (; n >= 8; n -= 8, keys += 64)
+    acc = _mm512_mask_add_epi64(acc, _mm512_cmplt_epu64_mask(_mm512_loadu_si512(keys), pattern), acc, one);
+  return hsum64_avx512(acc) + dupfix64_rank_tail(keys, n, key);
+}
+
+MDBX_MAYBE_UNUSED __hot MDBX_ATTRIBUTE_TARGET_AVX512BW static size_t branch32_rank_avx512bw(const page_t *mp, size_t i,
+                                                                                            const size_t end,
+                                                                                            const uint32_t key) {
+  const void *const base = ptr_disp(mp, PAGEHDRSZ + NODESIZE);
+  const __m512i pattern = _mm512_set1_epi32((int32_t)key), one = _mm512_set1_epi32(1);
+  __m512i acc = _mm512_setzero_si512();
+  for (; i + 16 <= end; i += 16) {
+    const __m512i offsets = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)(mp->entries + i)));
+    const __m512i v = _mm512_i32gather_epi32(offsets, base, 1);
+    acc = _mm512_mask_add_epi32(acc, _mm512_cmplt_epu32_mask(v, pattern), acc, one);
+  }
+  return hsum32_avx512(acc) + branch32_rank_avx2(mp, i, end, key);
+}
+
+MDBX_MAYBE_UNUSED __hot MDBX_ATTRIBUTE_TARGET_AVX512BW static size_t branch64_rank_avx512bw(const page_t *mp, size_t i,
+                                                                                            const size_t end,
+                                                                                            const uint64_t key) {
+  const void *const base = ptr_disp(mp, PAGEHDRSZ + NODESIZE);
+  const __m512i pattern = _mm512_set1_epi64((int64_t)key), one = _mm512_set1_epi64(1);
+  __m512i acc = _mm512_setzero_si512();
+  for (; i + 8 <= end; i += 8) {
+    const __m256i offsets = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(mp->entries + i)));
+    const __m512i v = _mm512_i32gather_epi64(offsets, base, 1);
+    acc = _mm512_mask_add_epi64(acc, _mm512_cmplt_epu64_mask(v, pattern), acc, one);
+  }
+  return hsum64_avx512(acc) + branch64_rank_avx2(mp, i, end, key);
+}
+#endif /* MDBX_ATTRIBUTE_TARGET_AVX512BW */
+
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+__hot static size_t dupfix32_rank_neon(const uint8_t *keys, size_t n, const uint32_t key) {
+  const uint32x4_t pattern = vmovq_n_u32(key);
+  uint32x4_t acc = vmovq_n_u32(0);
+  for (; n >= 4; n -= 4, keys += 16)
+    acc = vsubq_u32(acc, vcltq_u32(vld1q_u32((const uint32_t *)keys), pattern));
+#if defined(__aarch64__)
+  const size_t r = vaddvq_u32(acc);
+#else
+  const uint32x2_t sum = vadd_u32(vget_low_u32(acc), vget_high_u32(acc));
+  const size_t r = vget_lane_u32(vpadd_u32(sum, sum), 0);
+#endif /* __aarch64__ */
+  return r + dupfix32_rank_tail(keys, n, key);
+}
+
+#if defined(__aarch64__)
+__hot static size_t dupfix64_rank_neon(const uint8_t *keys, size_t n, const uint64_t key) {
+  const uint64x2_t pattern = vmovq_n_u64(key);
+  uint64x2_t acc = vmovq_n_u64(0);
+  for (; n >= 2; n -= 2, keys += 16)
+    acc = vsubq_u64(acc, vcltq_u64(vreinterpretq_u64_u32(vld1q_u32((const uint32_t *)keys)), pattern));
+  return vaddvq_u64(acc) + dupfix64_rank_tail(keys, n, key);
+}
+#endif /* __aarch64__ */
+#endif /* __ARM_NEON || __ARM_NEON__ */
+
+static struct {
+  size_t (*dupfix32)(const uint8_t *keys, size_t n, const uint32_t key);
+  size_t (*dupfix64)(const uint8_t *keys, size_t n, const uint64_t key);
+  size_t (*branch32)(const page_t *mp, size_t i, const size_t end, const uint32_t key);
+  size_t (*branch64)(const page_t *mp, size_t i, const size_t end, const uint64_t key);
+} search_simd;
+
+__cold void tree_search_ctor(void) {
+#if defined(__ia32__) && MDBX_HAVE_BUILTIN_CPU_SUPPORTS
+#if __has_builtin(__builtin_cpu_init) || defined(__BUILTIN_CPU_INIT__) || __GNUC_PREREQ(4, 8)
+  __builtin_cpu_init();
+#endif /* __builtin_cpu_init() */
+#define SEARCH_SIMD_CPU_SUPPORTS(FEATURE, BASELINE) ((BASELINE) || __builtin_cpu_supports(FEATURE))
+#else
+/* Only the baseline will be used since no cpu-features detection support from compiler.
+ * Please don't ask to implement cpuid-based detection and don't make such PRs. */
+#define SEARCH_SIMD_CPU_SUPPORTS(FEATURE, BASELINE) (BASELINE)
+#endif /* MDBX_HAVE_BUILTIN_CPU_SUPPORTS */
+
+#ifdef MDBX_ATTRIBUTE_TARGET_SSE2
+#ifdef __SSE2__
+  const bool sse2 = true;
+#else
+  const bool sse2 = false;
+#endif /* __SSE2__ */
+  if (SEARCH_SIMD_CPU_SUPPORTS("sse2", sse2))
+    search_simd.dupfix32 = dupfix32_rank_sse2;
+#endif /* MDBX_ATTRIBUTE_TARGET_SSE2 */
+
+#ifdef MDBX_ATTRIBUTE_TARGET_AVX2
+#ifdef __AVX2__
+  const bool avx2 = true;
+#else
+  const bool avx2 = false;
+#endif /* __AVX2__ */
+  if (SEARCH_SIMD_CPU_SUPPORTS("avx2", avx2)) {
+    search_simd.dupfix32 = dupfix32_rank_avx2;
+    search_simd.dupfix64 = dupfix64_rank_avx2;
+    search_simd.branch32 = branch32_rank_avx2;
+    search_simd.branch64 = branch64_rank_avx2;
+  }
+#endif /* MDBX_ATTRIBUTE_TARGET_AVX2 */
+
+#ifdef MDBX_ATTRIBUTE_TARGET_AVX512BW
+#ifdef __AVX512BW__
+  const bool avx512bw = true;
+#else
+  const bool avx512bw = false;
+#endif /* __AVX512BW__ */
+  if (SEARCH_SIMD_CPU_SUPPORTS("avx512bw", avx512bw)) {
+    search_simd.dupfix32 = dupfix32_rank_avx512bw;
+    search_simd.dupfix64 = dupfix64_rank_avx512bw;
+    search_simd.branch32 = branch32_rank_avx512bw;
+    search_simd.branch64 = branch64_rank_avx512bw;
+  }
+#endif /* MDBX_ATTRIBUTE_TARGET_AVX512BW */
+
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+  search_simd.dupfix32 = dupfix32_rank_neon;
+#if defined(__aarch64__)
+  search_simd.dupfix64 = dupfix64_rank_neon;
+#endif /* __aarch64__ */
+#endif /* __ARM_NEON || __ARM_NEON__ */
+  /* Choosing of another variants should be added here. */
+#undef SEARCH_SIMD_CPU_SUPPORTS
+}
+
+/* ---------------------------------------------------------------------------------------------------- */
+
 #if defined(__GNUC__) && !(defined(__e2k__) || defined(__elbrus__))
 #define CLEAR_VALUE_PROPAGATION(VAR) __asm__ __volatile__("" : "+r"(cmp))
 #else
@@ -38486,7 +43206,30 @@ static int null_comparator(const MDBX_val *a, const MDBX_val *b) {
   return 0;
 }
 
-#define SEARCH_FOLIAGE(NAME, BRANCH_COMPARATOR, LEAF_COMPARATOR, BOOL_DIFFERENT_COMPARATORS, BOOL_DUPFIXED)            \
+/* Returns the length of prefix which is common for the given key and all keys of a page between the first and the
+ * last ones, since in the lexicographic order such keys could not differ within the prefix shared by the bounds.
+ * So comparisons within the page may skip this prefix, which is useful for long keys with long shared prefixes,
+ * such as URLs or paths. */
+MDBX_NOTHROW_PURE_FUNCTION static inline size_t lexical_prefix(const MDBX_val *first, const MDBX_val *last,
+                                                               const MDBX_val *key) {
+  size_t limit = (first->iov_len < last->iov_len) ? first->iov_len : last->iov_len;
+  if (limit > key->iov_len)
+    limit = key->iov_len;
+  const uint8_t *const a = first->iov_base, *const b = last->iov_base, *const k = key->iov_base;
+  size_t i = 0;
+  while (i + 8 <= limit) {
+    const uint64_t word = unaligned_peek_u64(1, a + i);
+    if ((word ^ unaligned_peek_u64(1, b + i)) | (word ^ unaligned_peek_u64(1, k + i)))
+      break;
+    i += 8;
+  }
+  while (i < limit && a[i] == b[i] && a[i] == k[i])
+    ++i;
+  return i;
+}
+
+#define SEARCH_FOLIAGE(NAME, BRANCH_COMPARATOR, LEAF_COMPARATOR, BOOL_DIFFERENT_COMPARATORS, BOOL_DUPFIXED,            \
+                       BOOL_SKIP_PREFIX)                                                                               \
   MDBX_NOTHROW_PURE_FUNCTION __hot static sfr_t search_foliage_##NAME(MDBX_cursor *mc, const MDBX_val *key) {          \
     page_t *mp = mc->pg[mc->top];                                                                                      \
     const intptr_t nkeys = page_numkeys(mp);                                                                           \
@@ -38506,20 +43249,29 @@ static int null_comparator(const MDBX_val *a, const MDBX_val *b) {
                                                                                                                        \
     intptr_t scope = nkeys - lo, cmp, it;                                                                              \
     node_t *node = (node_t *)(intptr_t)-1;                                                                             \
-    MDBX_val node_key;                                                                                                 \
+    MDBX_val node_key, key_tail = *key;                                                                                \
+    size_t prefix = 0;                                                                                                 \
     if ((BOOL_DIFFERENT_COMPARATORS | BOOL_DUPFIXED) && lo == 0) {                                                     \
       ASSERT(is_leaf(mp));                                                                                             \
       if (BOOL_DUPFIXED) {                                                                                             \
         cASSERT0(mc, is_dupfix_leaf(mp));                                                                              \
         cASSERT0(mc, mp->dupfix_ksize == mc->tree->dupfix_size);                                                       \
         node_key.iov_len = mp->dupfix_ksize;                                                                           \
-        TRACE(">> %s lo %zu, size %zu, nkeys %zu", "leaf-dupfix", lo, scope, nkeys);                                   \
+        if (BOOL_SKIP_PREFIX) {                                                                                        \
+          const MDBX_val first = page_dupfix_key(mp, 0, node_key.iov_len);                                             \
+          const MDBX_val last = page_dupfix_key(mp, nkeys - 1, node_key.iov_len);                                      \
+          prefix = lexical_prefix(&first, &last, key);                                                                 \
+          key_tail.iov_base = ptr_disp(key->iov_base, prefix);                                                         \
+          key_tail.iov_len -= prefix;                                                                                  \
+          node_key.iov_len -= prefix;                                                                                  \
+        }                                                                                                              \
+        TRACE(">> %s lo %zu, size %zu, nkeys %zu, prefix %zu", "leaf-dupfix", lo, scope, nkeys, prefix);               \
         do {                                                                                                           \
           MDBX_CURSOR_STC_INC(mc);                                                                                     \
           BINARY_BRANCHLESS_SEARCH_CYCLE_BEGIN(it, cmp, lo, scope);                                                    \
-          node_key.iov_base = page_dupfix_ptr(mp, it, node_key.iov_len);                                               \
+          node_key.iov_base = ptr_disp(page_dupfix_ptr(mp, it, mp->dupfix_ksize), prefix);                             \
           cASSERT0(mc, ptr_disp(mp, mc->txn->env->ps) >= ptr_disp(node_key.iov_base, node_key.iov_len));               \
-          cmp = LEAF_COMPARATOR(&node_key, key);                                                                       \
+          cmp = LEAF_COMPARATOR(&node_key, &key_tail);                                                                 \
           TRACE("== i %zu, cmp %zi", it, cmp);                                                                         \
           if (unlikely(cmp == 0))                                                                                      \
             goto found;                                                                                                \
@@ -38560,16 +43312,24 @@ static int null_comparator(const MDBX_val *a, const MDBX_val *b) {
       }                                                                                                                \
     }                                                                                                                  \
                                                                                                                        \
-    TRACE(">> %s lo %zu, size %zu, nkeys %zu", "branch", lo, scope, nkeys);                                            \
     ASSERT(!is_dupfix_leaf(mp));                                                                                       \
+    if (BOOL_SKIP_PREFIX) {                                                                                            \
+      const MDBX_val first = get_key(page_node(mp, lo)), last = get_key(page_node(mp, hi));                            \
+      prefix = lexical_prefix(&first, &last, key);                                                                     \
+      key_tail.iov_base = ptr_disp(key->iov_base, prefix);                                                             \
+      key_tail.iov_len -= prefix;                                                                                      \
+    }                                                                                                                  \
+    TRACE(">> %s lo %zu, size %zu, nkeys %zu, prefix %zu", "branch", lo, scope, nkeys, prefix);                        \
     ASSERT(is_branch(mp) || !(BOOL_DIFFERENT_COMPARATORS | BOOL_DUPFIXED));                                            \
     do {                                                                                                               \
       MDBX_CURSOR_STC_INC(mc);                                                                                         \
       BINARY_BRANCHLESS_SEARCH_CYCLE_BEGIN(it, cmp, lo, scope);                                                        \
       node = page_node(mp, it);                                                                                        \
       node_key = get_key(node);                                                                                        \
+      node_key.iov_base = ptr_disp(node_key.iov_base, prefix);                                                         \
+      node_key.iov_len -= prefix;                                                                                      \
       cASSERT0(mc, ptr_disp(mp, mc->txn->env->ps) >= ptr_disp(node_key.iov_base, node_key.iov_len));                   \
-      cmp = BRANCH_COMPARATOR(&node_key, key);                                                                         \
+      cmp = BRANCH_COMPARATOR(&node_key, &key_tail);                                                                   \
       TRACE("== i %zu, cmp %zi", it, cmp);                                                                             \
       if (unlikely(cmp == 0))                                                                                          \
         goto found;                                                                                                    \
@@ -38592,37 +43352,80 @@ static int null_comparator(const MDBX_val *a, const MDBX_val *b) {
     return ret;                                                                                                        \
   }
 
-SEARCH_FOLIAGE(lexical_usual, cmp_lexical, null_comparator, false, false)
-SEARCH_FOLIAGE(reverse_usual, cmp_reverse, null_comparator, false, false)
-SEARCH_FOLIAGE(lenfast_usual, cmp_lenfast, null_comparator, false, false)
-SEARCH_FOLIAGE(custom_usual, mc->clc->k.cmp, null_comparator, false, false)
+SEARCH_FOLIAGE(lexical_usual, cmp_lexical, null_comparator, false, false, true)
+SEARCH_FOLIAGE(reverse_usual, cmp_reverse, null_comparator, false, false, false)
+SEARCH_FOLIAGE(lenfast_usual, cmp_lenfast, null_comparator, false, false, false)
+SEARCH_FOLIAGE(custom_usual, mc->clc->k.cmp, null_comparator, false, false, false)
 
 #if defined(cmp_uint_align4)
-SEARCH_FOLIAGE(ordinal_usual, cmp_uint_align4, null_comparator, false, false)
+SEARCH_FOLIAGE(ordinal_usual, cmp_uint_align4, null_comparator, false, false, false)
 #else
-SEARCH_FOLIAGE(ordinal_usual, cmp_uint_align4, cmp_uint_unaligned, true, false)
+SEARCH_FOLIAGE(ordinal_usual, cmp_uint_align4, cmp_uint_unaligned, true, false, false)
 #endif
 
 #if defined(cmp_uint32_align4_unchecked)
-SEARCH_FOLIAGE(uint32_usual, cmp_uint32_align4_unchecked, null_comparator, false, false)
+SEARCH_FOLIAGE(uint32_usual, cmp_uint32_align4_unchecked, null_comparator, false, false, false)
 #else
-SEARCH_FOLIAGE(uint32_usual, cmp_uint32_align4_unchecked, cmp_uint32_unaligned_unchecked, true, false)
+SEARCH_FOLIAGE(uint32_usual, cmp_uint32_align4_unchecked, cmp_uint32_unaligned_unchecked, true, false, false)
 #endif
 
 #if defined(cmp_uint64_align4_unchecked)
-SEARCH_FOLIAGE(uint64_usual, cmp_uint64_align4_unchecked, null_comparator, false, false)
+SEARCH_FOLIAGE(uint64_usual, cmp_uint64_align4_unchecked, null_comparator, false, false, false)
 #else
-SEARCH_FOLIAGE(uint64_usual, cmp_uint64_align4_unchecked, cmp_uint64_unaligned_unchecked, true, false)
+SEARCH_FOLIAGE(uint64_usual, cmp_uint64_align4_unchecked, cmp_uint64_unaligned_unchecked, true, false, false)
 #endif
 
-SEARCH_FOLIAGE(lexical_dupfix, cmp_lexical, cmp_lexical, false, true)
-SEARCH_FOLIAGE(reverse_dupfix, cmp_reverse, cmp_reverse, false, true)
-SEARCH_FOLIAGE(lenfast_dupfix, cmp_lenfast, cmp_lenfast, false, true)
-SEARCH_FOLIAGE(custom_dupfix, mc->clc->k.cmp, mc->clc->k.cmp, false, true)
+SEARCH_FOLIAGE(lexical_dupfix, cmp_lexical, cmp_lexical, false, true, true)
+SEARCH_FOLIAGE(reverse_dupfix, cmp_reverse, cmp_reverse, false, true, false)
+SEARCH_FOLIAGE(lenfast_dupfix, cmp_lenfast, cmp_lenfast, false, true, false)
+SEARCH_FOLIAGE(custom_dupfix, mc->clc->k.cmp, mc->clc->k.cmp, false, true, false)
+
+SEARCH_FOLIAGE(ordinal_dupfix, cmp_uint_align4, cmp_uint_unaligned, true, true, false)
+SEARCH_FOLIAGE(uint32_dupfix, cmp_uint32_align4_unchecked, cmp_uint32_unaligned_unchecked, true, true, false)
+SEARCH_FOLIAGE(uint64_dupfix, cmp_uint64_align4_unchecked, cmp_uint64_unaligned_unchecked, true, true, false)
+
+/* The binary search narrows down to the window of SEARCH_SIMD_WINDOW bytes, then the vectorized kernel
+ * completes the search, instead of a few more steps with mispredictable and dependent loads. */
+#define SEARCH_FOLIAGE_SIMD(BITS)                                                                                      \
+  MDBX_NOTHROW_PURE_FUNCTION __hot static sfr_t search_foliage_uint##BITS##_dupfix_simd(MDBX_cursor *mc,               \
+                                                                                       const MDBX_val *key) {          \
+    page_t *mp = mc->pg[mc->top];                                                                                      \
+    const intptr_t nkeys = page_numkeys(mp);                                                                           \
+    DEBUG("searching %zu keys in %s %spage %" PRIaPGNO, nkeys, "leaf", is_subpage(mp) ? "sub-" : "", mp->pgno);        \
+    cASSERT0(mc, is_dupfix_leaf(mp) && mp->dupfix_ksize == BITS / 8 && key->iov_len == BITS / 8);                      \
+    const uint8_t *const keys = ptr_disp(mp, PAGEHDRSZ);                                                               \
+    const uint##BITS##_t needle = unaligned_peek_u##BITS(1, key->iov_base);                                            \
+                                                                                                                       \
+    sfr_t ret;                                                                                                         \
+    intptr_t lo = 0, scope = nkeys, cmp, it;                                                                           \
+    TRACE(">> %s lo %zu, size %zu, nkeys %zu", "leaf-dupfix-simd", lo, scope, nkeys);                                  \
+    while (scope > SEARCH_SIMD_WINDOW / (BITS / 8)) {                                                                  \
+      MDBX_CURSOR_STC_INC(mc);                                                                                         \
+      BINARY_BRANCHLESS_SEARCH_CYCLE_BEGIN(it, cmp, lo, scope);                                                        \
+      cmp = CMP2INT(unaligned_peek_u##BITS(4, keys + it * (BITS / 8)), needle);                                        \
+      TRACE("== i %zu, cmp %zi", it, cmp);                                                                             \
+      if (unlikely(cmp == 0)) {                                                                                        \
+        ret.exact = true;                                                                                              \
+        goto bailout;                                                                                                  \
+      }                                                                                                                \
+      BINARY_BRANCHLESS_SEARCH_CYCLE_END(it, cmp, lo, scope);                                                          \
+      TRACE("== lo %zi, size %zi", lo, scope);                                                                         \
+    }                                                                                                                  \
+                                                                                                                       \
+    MDBX_CURSOR_STC_INC(mc);                                                                                           \
+    it = lo + search_simd.dupfix##BITS(keys + lo * (BITS / 8), scope, needle);                                         \
+    ret.exact = it < nkeys && unaligned_peek_u##BITS(4, keys + it * (BITS / 8)) == needle;                             \
+  bailout:                                                                                                             \
+    TRACE("<< lo %zu, size %zu, nkeys %zu, i %zu, %c", lo, scope, nkeys, it, ret.exact ? 'Y' : 'N');                   \
+    /* store the key index */                                                                                          \
+    mc->ki[mc->top] = (indx_t)it;                                                                                      \
+    ret.node = (it < nkeys) ? /* fake for DUPFIX */ (node_t *)(intptr_t)-1                                             \
+                            : /* There is no entry larger or equal to the key. */ nullptr;                             \
+    return ret;                                                                                                        \
+  }
 
-SEARCH_FOLIAGE(ordinal_dupfix, cmp_uint_align4, cmp_uint_unaligned, true, true)
-SEARCH_FOLIAGE(uint32_dupfix, cmp_uint32_align4_unchecked, cmp_uint32_unaligned_unchecked, true, true)
-SEARCH_FOLIAGE(uint64_dupfix, cmp_uint64_align4_unchecked, cmp_uint64_unaligned_unchecked, true, true)
+SEARCH_FOLIAGE_SIMD(32)
+SEARCH_FOLIAGE_SIMD(64)
 
 #if MDBX_DEBUG_SEARCH_DISPATCHING
 
@@ -38757,9 +43560,9 @@ cursor_to_search_foliage(const MDBX_cursor *mc) {
       if (ordinal) {
         if ((mc->txn->env->flags & MDBX_VALIDATION) == 0 && ordinal == mc->clc->k.lmin && ordinal == mc->clc->k.lmax) {
           if (ordinal == 4)
-            return search_foliage_uint32_dupfix;
+            return search_simd.dupfix32 ? search_foliage_uint32_dupfix_simd : search_foliage_uint32_dupfix;
           if (ordinal == 8)
-            return search_foliage_uint64_dupfix;
+            return search_simd.dupfix64 ? search_foliage_uint64_dupfix_simd : search_foliage_uint64_dupfix;
         }
         return search_foliage_ordinal_dupfix;
       }
@@ -38843,7 +43646,7 @@ __hot sfr_t tree_search_foliage_configure(MDBX_cursor *mc, const MDBX_val *key)
 
 /* ---------------------------------------------------------------------------------------------------- */
 
-#define SEARCH_BRANCH(NAME, COMPARATOR)                                                                                \
+#define SEARCH_BRANCH(NAME, COMPARATOR, BOOL_SKIP_PREFIX)                                                              \
   MDBX_NOTHROW_PURE_FUNCTION __hot static size_t search_branch_##NAME(const MDBX_cursor *mc, const MDBX_val *key) {    \
     page_t *mp = mc->pg[mc->top];                                                                                      \
     ASSERT(is_branch(mp));                                                                                             \
@@ -38851,14 +43654,24 @@ __hot sfr_t tree_search_foliage_configure(MDBX_cursor *mc, const MDBX_val *key)
     cASSERT0(mc, nkeys >= 2);                                                                                          \
     TRACE("searching %zu keys in branch-page %" PRIaPGNO, nkeys, mp->pgno);                                            \
     intptr_t lo = 1, scope = nkeys - lo, it, cmp;                                                                      \
-    TRACE(">> lo %zu, size %zu, nkeys %zu", lo, scope, nkeys);                                                         \
+    MDBX_val key_tail = *key;                                                                                          \
+    size_t prefix = 0;                                                                                                 \
+    if (BOOL_SKIP_PREFIX) {                                                                                            \
+      const MDBX_val first = get_key(page_node(mp, lo)), last = get_key(page_node(mp, nkeys - 1));                     \
+      prefix = lexical_prefix(&first, &last, key);                                                                     \
+      key_tail.iov_base = ptr_disp(key->iov_base, prefix);                                                             \
+      key_tail.iov_len -= prefix;                                                                                      \
+    }                                                                                                                  \
+    TRACE(">> lo %zu, size %zu, nkeys %zu, prefix %zu", lo, scope, nkeys, prefix);                                     \
     if (likely(nkeys > 1))                                                                                             \
       do {                                                                                                             \
         MDBX_CURSOR_STC_INC(mc);                                                                                       \
         BINARY_BRANCHLESS_SEARCH_CYCLE_BEGIN(it, cmp, lo, scope);                                                      \
         MDBX_val node_key = get_key(page_node(mp, it));                                                                \
+        node_key.iov_base = ptr_disp(node_key.iov_base, prefix);                                                       \
+        node_key.iov_len -= prefix;                                                                                    \
         cASSERT0(mc, ptr_disp(mp, mc->txn->env->ps) >= ptr_disp(node_key.iov_base, node_key.iov_len));                 \
-        cmp = COMPARATOR(&node_key, key);                                                                              \
+        cmp = COMPARATOR(&node_key, &key_tail);                                                                        \
         TRACE("== i %zu, cmp %zi", it, cmp);                                                                           \
         if (unlikely(cmp == 0)) {                                                                                      \
           TRACE("<< lo %zu, size %zu, nkeys %zu, i %zu, %c", lo, scope, nkeys, it, 'Y');                               \
@@ -38873,13 +43686,47 @@ __hot sfr_t tree_search_foliage_configure(MDBX_cursor *mc, const MDBX_val *key)
   }
 
 /* Branch pages have no data, so if using integer keys, alignment is guaranteed. Use faster cmp_uint_align4(). */
-SEARCH_BRANCH(ordinal, cmp_uint_align4)
-SEARCH_BRANCH(uint32, cmp_uint32_align4_unchecked)
-SEARCH_BRANCH(uint64, cmp_uint64_align4_unchecked)
-SEARCH_BRANCH(lexical, cmp_lexical)
-SEARCH_BRANCH(reverse, cmp_reverse)
-SEARCH_BRANCH(lenfast, cmp_lenfast)
-SEARCH_BRANCH(custom, mc->clc->k.cmp)
+SEARCH_BRANCH(ordinal, cmp_uint_align4, false)
+SEARCH_BRANCH(uint32, cmp_uint32_align4_unchecked, false)
+SEARCH_BRANCH(uint64, cmp_uint64_align4_unchecked, false)
+SEARCH_BRANCH(lexical, cmp_lexical, true)
+SEARCH_BRANCH(reverse, cmp_reverse, false)
+SEARCH_BRANCH(lenfast, cmp_lenfast, false)
+SEARCH_BRANCH(custom, mc->clc->k.cmp, false)
+
+#define SEARCH_BRANCH_SIMD(BITS)                                                                                       \
+  MDBX_NOTHROW_PURE_FUNCTION __hot static size_t search_branch_uint##BITS##_simd(const MDBX_cursor *mc,                \
+                                                                                 const MDBX_val *key) {                \
+    page_t *mp = mc->pg[mc->top];                                                                                      \
+    ASSERT(is_branch(mp));                                                                                             \
+    const size_t nkeys = page_numkeys(mp);                                                                             \
+    cASSERT0(mc, nkeys >= 2 && key->iov_len == BITS / 8);                                                              \
+    TRACE("searching %zu keys in branch-page %" PRIaPGNO, nkeys, mp->pgno);                                            \
+    const uint##BITS##_t needle = unaligned_peek_u##BITS(1, key->iov_base);                                            \
+    intptr_t lo = 1, scope = nkeys - lo, it, cmp;                                                                      \
+    TRACE(">> %s lo %zu, size %zu, nkeys %zu", "simd", lo, scope, nkeys);                                              \
+    while (scope > SEARCH_SIMD_WINDOW / (BITS / 8)) {                                                                  \
+      MDBX_CURSOR_STC_INC(mc);                                                                                         \
+      BINARY_BRANCHLESS_SEARCH_CYCLE_BEGIN(it, cmp, lo, scope);                                                        \
+      cmp = CMP2INT(unaligned_peek_u##BITS(2, node_key(page_node(mp, it))), needle);                                   \
+      TRACE("== i %zu, cmp %zi", it, cmp);                                                                             \
+      if (unlikely(cmp == 0)) {                                                                                        \
+        TRACE("<< lo %zu, size %zu, nkeys %zu, i %zu, %c", lo, scope, nkeys, it, 'Y');                                 \
+        return it;                                                                                                     \
+      }                                                                                                                \
+      BINARY_BRANCHLESS_SEARCH_CYCLE_END(it, cmp, lo, scope);                                                          \
+      TRACE("== lo %zi, size %zi", lo, scope);                                                                         \
+    }                                                                                                                  \
+                                                                                                                       \
+    MDBX_CURSOR_STC_INC(mc);                                                                                           \
+    it = lo + search_simd.branch##BITS(mp, lo, lo + scope, needle);                                                    \
+    const bool exact = it < (intptr_t)nkeys && unaligned_peek_u##BITS(2, node_key(page_node(mp, it))) == needle;       \
+    TRACE("<< lo %zu, size %zu, nkeys %zu, i %zu, %c", lo, scope, nkeys, it, exact ? 'Y' : 'N');                       \
+    return exact ? it : it - 1;                                                                                        \
+  }
+
+SEARCH_BRANCH_SIMD(32)
+SEARCH_BRANCH_SIMD(64)
 
 MDBX_MAYBE_UNUSED MDBX_NOTHROW_PURE_FUNCTION __hot static MDBX_search_branch
 cursor_to_search_branch(const MDBX_cursor *mc) {
@@ -38918,9 +43765,9 @@ cursor_to_search_branch(const MDBX_cursor *mc) {
     if (ordinal) {
       if ((mc->txn->env->flags & MDBX_VALIDATION) == 0 && ordinal == mc->clc->k.lmin && ordinal == mc->clc->k.lmax) {
         if (ordinal == 4)
-          return search_branch_uint32;
+          return search_simd.branch32 ? search_branch_uint32_simd : search_branch_uint32;
         if (ordinal == 8)
-          return search_branch_uint64;
+          return search_simd.branch64 ? search_branch_uint64_simd : search_branch_uint64;
       }
       return search_branch_ordinal;
     }
@@ -38961,6 +43808,9 @@ size_t tree_search_branch_configure(const MDBX_cursor *mc, const MDBX_val *key)
 #undef BINARY_BRANCHLESS_SEARCH_CYCLE_END
 #undef SEARCH_BRANCH
 #undef SEARCH_FOLIAGE
+#undef SEARCH_BRANCH_SIMD
+#undef SEARCH_FOLIAGE_SIMD
+#undef SEARCH_SIMD_WINDOW
 
 static inline size_t txl_size2bytes(const size_t size) {
   ASSERT(size > 0 && size <= txl_max * 2);
@@ -39182,6 +44032,7 @@ static int basal_start_locked(MDBX_txn *txn, unsigned flags) {
   txn->wr.spilled.list = nullptr;
   txn->wr.spilled.least_removed = 0;
   txn->wr.gc.spent = 0;
+  txn->wr.spill_stat.spilled = txn->wr.spill_stat.unspilled = 0;
   cASSERT0(txn, rkl_empty(&txn->wr.gc.reclaimed));
   cASSERT0(txn, rkl_empty(&txn->wr.gc.ready4reuse));
   cASSERT0(txn, rkl_empty(&txn->wr.gc.comeback));
@@ -39208,9 +44059,16 @@ static int basal_start_locked(MDBX_txn *txn, unsigned flags) {
     return MDBX_TXN_FULL;
   }
 
+  if (env->pgsum.writer) {
+    int err = pgsum_txn_begin(env, head, txn->txnid);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+  }
+
   int err = txn_setup_primal(txn);
   if (unlikely(err != MDBX_SUCCESS))
     return err;
+  gc_policy_setup(txn);
 
   eASSERT0(env, pgno2bytes(env, txn->geo.first_unallocated) <= env->dxb_mmap.current);
   eASSERT0(env, env->dxb_mmap.limit >= env->dxb_mmap.current);
@@ -39262,7 +44120,13 @@ int txn_basal_start(MDBX_txn *txn, unsigned flags) {
 
     /* Not yet touching txn == env->basal_txn, it may be active */
     jitter4testing(false);
+    /* let the background defragmentation yield, see MDBX_opt_defrag_auto_threshold */
+    const bool announce = (flags & MDBX_TXN_TRY) == 0 && env->defragger.running;
+    if (announce)
+      atomic_add32(&env->defragger.writers_waiting, 1);
     int err = lck_txn_lock(env, (flags & MDBX_TXN_TRY) != 0);
+    if (announce)
+      atomic_sub32(&env->defragger.writers_waiting, 1);
     if (unlikely(err != MDBX_SUCCESS))
       return err;
   }
@@ -39461,7 +44325,7 @@ int txn_basal_commit(MDBX_txn *txn, struct commit_timestamp *ts) {
         env->ioring.overlapped_fd ? env->ioring.overlapped_fd : env->lazy_fd;
     (void)need_flush_for_nometasync;
 #else
-        (need_flush_for_nometasync || env->dsync_fd == INVALID_HANDLE_VALUE ||
+        (need_flush_for_nometasync || env->dsync_fd == INVALID_HANDLE_VALUE || (txn->flags & MDBX_TXN_NOSYNC) ||
          txn->wr.dirtylist->length > env->options.writethrough_threshold ||
          atomic_load64(&env->lck->unsynced_pages, mo_Relaxed))
             ? env->lazy_fd
@@ -39494,7 +44358,7 @@ int txn_basal_commit(MDBX_txn *txn, struct commit_timestamp *ts) {
   meta_t meta;
   memcpy(meta.magic_and_version, head.ptr_c->magic_and_version, 8);
   meta.reserve16 = head.ptr_c->reserve16;
-  meta.validator_id = head.ptr_c->validator_id;
+  meta.validator_id = env->pgsum.writer ? MDBX_VALIDATOR_CRC32C : head.ptr_c->validator_id;
   meta.extra_pagehdr = head.ptr_c->extra_pagehdr;
   unaligned_poke_u64(4, meta.pages_retired,
                      unaligned_peek_u64(4, head.ptr_c->pages_retired) + pnl_size(txn->wr.retired_pages));
@@ -39507,6 +44371,12 @@ int txn_basal_commit(MDBX_txn *txn, struct commit_timestamp *ts) {
   meta.unsafe_sign = DATASIGN_NONE;
   meta_set_txnid(env, &meta, commit_txnid);
 
+  /* the base of the commit stream, since the meta-pages could be remapped while syncing */
+  const bool streaming = copy_commit_streaming(env);
+  meta_t stream_base;
+  if (streaming)
+    stream_base = *head.ptr_c;
+
   rc = dxb_sync_locked(env, env->flags | txn->flags | txn_shrink_allowed, &meta, &txn->wr.troika);
 
   if (ts)
@@ -39517,6 +44387,10 @@ int txn_basal_commit(MDBX_txn *txn, struct commit_timestamp *ts) {
     return rc;
   }
 
+  if (env->pgsum.writer)
+    pgsum_txn_committed(env, head.txnid, commit_txnid);
+  if (streaming)
+    copy_commit_stream(env, txn, &stream_base, meta_recent(env, &txn->wr.troika).ptr_c);
   return MDBX_SUCCESS;
 }
 
@@ -39935,6 +44809,7 @@ static int nested_start(MDBX_txn *const nested, MDBX_txn *parent) {
 #endif /* MDBX_ENABLE_REFUND */
   nested->wr.dirtyroom = parent->wr.dirtyroom;
   nested->wr.dirtylru = parent->wr.dirtylru;
+  nested->wr.spill_stat.spilled = nested->wr.spill_stat.unspilled = 0;
 #if MDBX_ENABLE_PGET_STAT
   nested->ops_pget = 0;
 #endif /* MDBX_ENABLE_PGET_STAT */
@@ -39952,6 +44827,10 @@ static int nested_start(MDBX_txn *const nested, MDBX_txn *parent) {
                                                              MDBX_ENABLE_REFUND));
 
   nested->wr.gc.spent = parent->wr.gc.spent;
+  nested->wr.gc.rp_augment_limit = parent->wr.gc.rp_augment_limit;
+  nested->wr.gc.policy = parent->wr.gc.policy;
+  nested->wr.gc.lifo = parent->wr.gc.lifo;
+  nested->wr.gc.prefetch_countdown = 0;
   err = rkl_copy(&parent->wr.gc.reclaimed, &nested->wr.gc.reclaimed);
   if (unlikely(err != MDBX_SUCCESS))
     return err;
@@ -40134,6 +45013,8 @@ static int nested_join(MDBX_txn *nested, struct commit_timestamp *ts) {
   parent->wr.repnl = nested->wr.repnl;
   nested->wr.repnl = nullptr;
   parent->wr.gc.spent = nested->wr.gc.spent;
+  parent->wr.spill_stat.spilled += nested->wr.spill_stat.spilled;
+  parent->wr.spill_stat.unspilled += nested->wr.spill_stat.unspilled;
   rkl_destructive_move(&nested->wr.gc.reclaimed, &parent->wr.gc.reclaimed);
   rkl_destructive_move(&nested->wr.gc.ready4reuse, &parent->wr.gc.ready4reuse);
   tASSERT0(nested, rkl_empty(&nested->wr.gc.comeback));
@@ -40350,8 +45231,10 @@ static void ro_slot_release(MDBX_txn *txn) {
   eASSERT0(env, slot->txnid.weak >= SAFE64_INVALID_THRESHOLD);
   if (ro_slot_pid(slot) == osal_getpid()) {
     safe64_reset(&slot->txnid, false);
-    if ((env->flags & ENV_TXKEY) == 0)
+    if ((env->flags & ENV_TXKEY) == 0) {
       atomic_store32(&slot->pid, 0, mo_Relaxed);
+      rdt_vacated(env->lck, slot);
+    }
   }
   txn->ro.slot = nullptr;
 }
@@ -40396,7 +45279,7 @@ static int ro_slot_clean(MDBX_txn *txn) {
     dxb_sanitize_tail(env, nullptr);
     atomic_store32(&slot->snapshot_pages_used, 0, mo_Relaxed);
     safe64_reset(&slot->txnid, true);
-    atomic_store32(&env->lck->rdt_refresh_flag, true, mo_Relaxed);
+    rdt_refresh(env->lck, slot);
   } else {
     ENSURE_OBJ(env, safe64_read(&slot->txnid) >= /* paranoia is appropriate here */ SAFE64_INVALID_THRESHOLD);
   }
@@ -40424,7 +45307,7 @@ static int ro_seize(MDBX_txn *txn) {
       eASSERT1(env, ro_slot_tid(slot) == ((env->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self()));
       eASSERT0(env, ro_slot_txnid(slot) == head.txnid || (ro_slot_txnid(slot) >= SAFE64_INVALID_THRESHOLD &&
                                                           head.txnid < env->lck->cached_oldest_txnid.weak));
-      atomic_store32(&env->lck->rdt_refresh_flag, true, mo_AcquireRelease);
+      rdt_refresh(env->lck, slot);
     } else {
       /* exclusive mode without lck */
       eASSERT0(env, !env->lck_mmap.lck && env->lck == lckless_stub(env));
@@ -40600,7 +45483,7 @@ int txn_ro_park(MDBX_txn *txn, bool autounpark) {
     return ro_slot_clean(txn);
 
   atomic_store64(&slot->tid, MDBX_TID_TXN_PARKED, mo_AcquireRelease);
-  atomic_store32(&txn->env->lck->rdt_refresh_flag, true, mo_Relaxed);
+  rdt_refresh(txn->env->lck, slot);
   txn->flags += autounpark ? MDBX_TXN_PARKED | MDBX_TXN_AUTOUNPARK : MDBX_TXN_PARKED;
   return MDBX_SUCCESS;
 }
@@ -40681,6 +45564,7 @@ int txn_ro_clone(const MDBX_txn *const origin, MDBX_txn *const clone) {
       atomic_store32(&clone->ro.slot->snapshot_pages_used, pages_used, mo_Relaxed);
       atomic_store64(&clone->ro.slot->snapshot_pages_retired, pages_retired, mo_Relaxed);
       safe64_write(&clone->ro.slot->txnid, (clone->flags & MDBX_TXN_PARKED) ? MDBX_TID_TXN_PARKED : clone->txnid);
+      rdt_refresh(env->lck, clone->ro.slot);
     } else {
       /* exclusive mode without lck */
       eASSERT0(env, !env->lck_mmap.lck && env->lck == lckless_stub(env));
@@ -40756,6 +45640,13 @@ pgop_stat_t *txn_latency_gcprof(const MDBX_env *env, MDBX_commit_latency *latenc
   return pgops;
 }
 
+void txn_latency_gcpolicy(const MDBX_txn *txn, MDBX_commit_latency *latency) {
+  latency->gc_policy.lifo = txn->wr.gc.lifo;
+  latency->gc_policy.reasons = txn->wr.gc.policy;
+  latency->gc_policy.rp_augment_limit = txn->wr.gc.rp_augment_limit;
+  latency->gc_policy.rsteps = (uint32_t)txn->env->basal_txn->wr.gc.rsteps;
+}
+
 __hot bool txn_gc_detent(const MDBX_txn *const txn) {
   const txnid_t detent = mvcc_shapshot_oldest_rw(txn).oldest_txnid;
   if (likely(detent == txn->env->gc.detent))
@@ -40811,7 +45702,7 @@ int txn_shadow_cursors(const MDBX_txn *parent, const size_t dbi) {
   return MDBX_SUCCESS;
 }
 
-int txn_commit(MDBX_txn *txn, MDBX_commit_latency *latency, struct commit_timestamp *ts) {
+int txn_commit(MDBX_txn *txn, MDBX_commit_latency *latency, struct commit_timestamp *ts, txnid_t *async) {
   cASSERT0(txn, !txn->nested && !(txn->flags & MDBX_TXN_FINISHED));
   if (unlikely(txn->flags & MDBX_TXN_ERROR)) {
     int err = txn_abort(txn, latency);
@@ -40836,7 +45727,19 @@ int txn_commit(MDBX_txn *txn, MDBX_commit_latency *latency, struct commit_timest
   }
 
   if (txn == env->basal_txn) {
+    /* In the group commit mode the meta-page is written weakly, and it is made
+     * durable after releasing the write lock, see MDBX_opt_group_commit.
+     * The same is done for asynchronous commits, but in background. */
+    const bool dirty = (txn->flags & (MDBX_TXN_DIRTY | MDBX_TXN_SPILLS)) ||
+                       (txn->wr.dirtylist && txn->wr.dirtylist->length);
+    const bool group_sync = !async && env->options.group_commit && !env->incore && dirty &&
+                            ((env->flags | txn->flags) & (MDBX_SAFE_NOSYNC | MDBX_NOMETASYNC)) == 0;
+    if (group_sync || (async && dirty))
+      txn->flags |= MDBX_TXN_NOSYNC;
     int rc = txn_basal_commit(txn, ts);
+    const txnid_t group_sync_txnid = (group_sync && rc == MDBX_SUCCESS) ? meta_recent(env, &txn->wr.troika).txnid : 0;
+    if (async && (rc == MDBX_SUCCESS || rc == MDBX_RESULT_TRUE))
+      *async = meta_recent(env, &txn->wr.troika).txnid;
     if (unlikely(rc != MDBX_SUCCESS)) {
       txn->flags |= MDBX_TXN_ERROR;
       if (rc == MDBX_RESULT_TRUE)
@@ -40845,8 +45748,14 @@ int txn_commit(MDBX_txn *txn, MDBX_commit_latency *latency, struct commit_timest
     if (latency) {
       pgop_stat_t *const pgops = txn_latency_gcprof(env, latency);
       memset(&pgops->gc_prof, 0, sizeof(pgops->gc_prof));
+      txn_latency_gcpolicy(txn, latency);
     }
     int err = txn_basal_end(txn, true);
+    if (group_sync_txnid && err == MDBX_SUCCESS) {
+      err = env_group_sync(env, group_sync_txnid);
+      if (ts)
+        ts->sync = osal_monotime();
+    }
     return (err == MDBX_SUCCESS) ? rc : err;
   }
 
@@ -40854,6 +45763,8 @@ int txn_commit(MDBX_txn *txn, MDBX_commit_latency *latency, struct commit_timest
     ERROR("attempt to commit %s txn %p", "strange nested", __Wpedantic_format_voidptr(txn));
     return MDBX_PROBLEM;
   }
+  if (latency)
+    txn_latency_gcpolicy(txn, latency);
   int rc = txn_nested_commit(txn, ts);
   if (latency)
     txn_latency_gcprof(env, latency);
@@ -41264,6 +46175,9 @@ static page_type_t walk_subpage_type(const page_t *sp) {
   }
 }
 
+__cold static bool walk_delegate(walk_ctx_t *ctx, const walk_tbl_t *tbl, const pgno_t pgno,
+                                 const txnid_t parent_txnid, const pgno_t parent_pgno);
+
 /* Depth-first tree traversal. */
 __cold static int walk_pgno(walk_ctx_t *ctx, walk_tbl_t *tbl, const pgno_t pgno, txnid_t parent_txnid,
                             const pgno_t parent_pgno) {
@@ -41398,6 +46312,8 @@ __cold static int walk_pgno(walk_ctx_t *ctx, walk_tbl_t *tbl, const pgno_t pgno,
     node_t *node = page_node(mp, i);
     if (type == page_branch) {
       ASSERT(err == MDBX_SUCCESS);
+      if (ctx->par && !tbl->nested && walk_delegate(ctx, tbl, node_pgno(node), mp->txnid, pgno))
+        continue;
       ctx->deep += 1;
       rc = walk_pgno(ctx, tbl, node_pgno(node), mp->txnid, pgno);
       ctx->deep -= 1;
@@ -41439,6 +46355,8 @@ __cold static int walk_pgno(walk_ctx_t *ctx, walk_tbl_t *tbl, const pgno_t pgno,
         walk_tbl_t table = {{node_key(node), node_ks(node)}, nullptr, nullptr};
         table.internal = &aligned_db;
         ASSERT(err == MDBX_SUCCESS);
+        if (ctx->par && walk_delegate(ctx, &table, P_INVALID, mp->txnid, pgno))
+          break;
         ctx->deep += 1;
         rc = walk_tbl(ctx, &table, pgno);
         ctx->deep -= 1;
@@ -41527,14 +46445,12 @@ __cold static int walk_pgno(walk_ctx_t *ctx, walk_tbl_t *tbl, const pgno_t pgno,
   return err;
 }
 
-__cold int walk_tbl(walk_ctx_t *ctx, walk_tbl_t *tbl, pgno_t parent_page) {
-  tree_t *const db = tbl->internal;
-  if (unlikely(db->root == P_INVALID))
-    return MDBX_SUCCESS; /* empty db */
-
+/* Walks a subtree of the table with an own cursor, i.e. the whole table or a subtree delegated to a worker. */
+__cold static int walk_subtree(walk_ctx_t *ctx, walk_tbl_t *tbl, const pgno_t pgno, const txnid_t parent_txnid,
+                               const pgno_t parent_page) {
   kvx_t kvx = {.clc = {.k = {.lmin = INT_MAX}, .v = {.lmin = INT_MAX}}};
   cursor_couple_t couple;
-  int rc = cursor_init4walk(&couple, ctx->txn, db, &kvx);
+  int rc = cursor_init4walk(&couple, ctx->txn, tbl->internal, &kvx);
   if (unlikely(rc != MDBX_SUCCESS))
     return rc;
 
@@ -41542,15 +46458,23 @@ __cold int walk_tbl(walk_ctx_t *ctx, walk_tbl_t *tbl, pgno_t parent_page) {
   couple.outer.checking |= cursor_checking;
   couple.inner.cursor.checking |= cursor_checking;
   couple.outer.next = ctx->cursor;
-  couple.outer.top_and_flags = z_disable_tree_search_fastpath;
+  couple.outer.top_and_flags = 0;
   ctx->cursor = &couple.outer;
+  rc = walk_pgno(ctx, tbl, pgno, parent_txnid, parent_page);
+  ctx->cursor = couple.outer.next;
+  return rc;
+}
+
+__cold int walk_tbl(walk_ctx_t *ctx, walk_tbl_t *tbl, pgno_t parent_page) {
+  tree_t *const db = tbl->internal;
+  if (unlikely(db->root == P_INVALID))
+    return MDBX_SUCCESS; /* empty db */
+
   txnid_t mod_txnid = db->mod_txnid;
   if (!mod_txnid || (db == &ctx->txn->dbs[FREE_DBI] && (ctx->txn->dbi_state[FREE_DBI] & DBI_DIRTY)) ||
       (db == &ctx->txn->dbs[MAIN_DBI] && (ctx->txn->dbi_state[MAIN_DBI] & DBI_DIRTY)))
     mod_txnid = ctx->txn->front_txnid;
-  rc = walk_pgno(ctx, tbl, db->root, mod_txnid, parent_page);
-  ctx->cursor = couple.outer.next;
-  return rc;
+  return walk_subtree(ctx, tbl, db->root, mod_txnid, parent_page);
 }
 
 __cold int walk_pages(MDBX_txn *txn, walk_func *visitor, void *user, walk_options_t options) {
@@ -41570,6 +46494,236 @@ __cold int walk_pages(MDBX_txn *txn, walk_func *visitor, void *user, walk_option
   return rc;
 }
 
+/* Parallel walking.
+ *
+ * The tables and subtrees of b-trees are delegated to a pool of workers while walking, as long as the queue is not
+ * long enough to occupy all of them, otherwise a subtree is walked in place. The nested dupsort trees are always
+ * walked in place, since those depend on the state of the cursor. The visitor is called by workers under the lock,
+ * thus it doesn't need a synchronization, but should use a per-worker context for a state depending on the order
+ * of walking. */
+
+typedef struct walk_job walk_job_t;
+struct walk_job {
+  walk_job_t *next;
+  walk_tbl_t tbl;
+  /* A copy of the tree_t record, unless of the GC or MainDB. */
+  tree_t tree;
+  /* The page to walk from, or P_INVALID for the whole table. */
+  pgno_t pgno, parent_pgno;
+  txnid_t parent_txnid;
+  unsigned deep;
+};
+
+struct walk_parallel {
+  osal_condpair_t condpair;
+  /* Serializes the visitor calls and guards the error. */
+  osal_fastmutex_t visitor_lock;
+  walk_func *visitor;
+  walk_job_t *queue;
+  mdbx_atomic_uint32_t queued;
+  uint32_t limit;
+  size_t pending;
+  int error;
+  bool stop;
+};
+
+typedef struct walk_worker {
+  walk_parallel_t *par;
+  void *userctx;
+} walk_worker_t;
+
+/* Requires the condpair to be locked. */
+__cold static void walk_par_error(walk_parallel_t *par, int err) {
+  ENSURE(osal_fastmutex_acquire(&par->visitor_lock) == MDBX_SUCCESS);
+  if (!par->error)
+    par->error = err;
+  ENSURE(osal_fastmutex_release(&par->visitor_lock) == MDBX_SUCCESS);
+  par->stop = true;
+  osal_condpair_signal(&par->condpair, true);
+  osal_condpair_signal(&par->condpair, false);
+}
+
+__cold static int walk_visitor_locked(const size_t pgno, const unsigned number, void *const ctx, const unsigned deep,
+                                      const walk_tbl_t *table, const size_t page_size, const page_type_t page_type,
+                                      const txnid_t page_txnid, const MDBX_error_t err, const size_t nentries,
+                                      const size_t payload_bytes, const size_t header_bytes,
+                                      const size_t unused_bytes, const size_t parent_pgno) {
+  walk_worker_t *const worker = ctx;
+  walk_parallel_t *const par = worker->par;
+  int rc = osal_fastmutex_acquire(&par->visitor_lock);
+  if (likely(rc == MDBX_SUCCESS)) {
+    /* a failure of any worker stops the walking */
+    rc = par->error;
+    if (likely(rc == MDBX_SUCCESS))
+      rc = par->visitor(pgno, number, worker->userctx, deep, table, page_size, page_type, page_txnid, err, nentries,
+                        payload_bytes, header_bytes, unused_bytes, parent_pgno);
+    ENSURE(osal_fastmutex_release(&par->visitor_lock) == MDBX_SUCCESS);
+  }
+  return rc;
+}
+
+__cold static bool walk_enqueue(walk_parallel_t *par, MDBX_txn *txn, const walk_tbl_t *tbl, const pgno_t pgno,
+                                const txnid_t parent_txnid, const pgno_t parent_pgno, const unsigned deep) {
+  walk_job_t *const job = osal_malloc(sizeof(walk_job_t));
+  if (unlikely(!job))
+    return false;
+
+  job->tbl = *tbl;
+  job->tbl.nested = nullptr;
+  if (tbl->internal != &txn->dbs[FREE_DBI] && tbl->internal != &txn->dbs[MAIN_DBI]) {
+    job->tree = *tbl->internal;
+    job->tbl.internal = &job->tree;
+  }
+  job->pgno = pgno;
+  job->parent_pgno = parent_pgno;
+  job->parent_txnid = parent_txnid;
+  job->deep = deep;
+
+  osal_condpair_lock(&par->condpair);
+  job->next = par->queue;
+  par->queue = job;
+  atomic_store32(&par->queued, atomic_load32(&par->queued, mo_Relaxed) + 1, mo_Relaxed);
+  par->pending += 1;
+  osal_condpair_signal(&par->condpair, false);
+  osal_condpair_unlock(&par->condpair);
+  return true;
+}
+
+/* Delegates walking a subtree (or a table if pgno is P_INVALID) to other workers. Returns false if the queue is
+ * long enough, so the subtree should be walked in place. */
+__cold static bool walk_delegate(walk_ctx_t *ctx, const walk_tbl_t *tbl, const pgno_t pgno,
+                                 const txnid_t parent_txnid, const pgno_t parent_pgno) {
+  walk_parallel_t *const par = ctx->par;
+  return atomic_load32(&par->queued, mo_Relaxed) < par->limit &&
+         walk_enqueue(par, ctx->txn, tbl, pgno, parent_txnid, parent_pgno, ctx->deep + 1);
+}
+
+__cold static THREAD_RESULT THREAD_CALL walk_worker(void *arg) {
+  walk_ctx_t *const ctx = arg;
+  walk_parallel_t *const par = ctx->par;
+  osal_condpair_lock(&par->condpair);
+  while (true) {
+    while (!par->queue && !par->stop) {
+      int err = osal_condpair_wait(&par->condpair, false);
+      if (unlikely(err != MDBX_SUCCESS)) {
+        walk_par_error(par, err);
+        goto bailout;
+      }
+    }
+    if (par->stop)
+      break;
+
+    walk_job_t *const job = par->queue;
+    par->queue = job->next;
+    atomic_store32(&par->queued, atomic_load32(&par->queued, mo_Relaxed) - 1, mo_Relaxed);
+    if (par->queue)
+      /* wake up one more worker */
+      osal_condpair_signal(&par->condpair, false);
+    osal_condpair_unlock(&par->condpair);
+
+    ctx->deep = job->deep;
+    int rc = (job->pgno == P_INVALID)
+                 ? walk_tbl(ctx, &job->tbl, job->parent_pgno)
+                 : walk_subtree(ctx, &job->tbl, job->pgno, job->parent_txnid, job->parent_pgno);
+    osal_free(job);
+
+    osal_condpair_lock(&par->condpair);
+    if (unlikely(rc != MDBX_SUCCESS))
+      walk_par_error(par, rc);
+    if (--par->pending == 0)
+      osal_condpair_signal(&par->condpair, true);
+  }
+
+bailout:
+  /* pass the wake up to other workers */
+  osal_condpair_signal(&par->condpair, false);
+  osal_condpair_unlock(&par->condpair);
+  return (THREAD_RESULT)0;
+}
+
+__cold int walk_pages_parallel(MDBX_txn *txn, walk_func *visitor, void *const *users, const size_t threads,
+                               walk_options_t options) {
+  int rc = check_txn(txn, MDBX_TXN_BLOCKED);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  walk_parallel_t par;
+  memset(&par, 0, sizeof(par));
+  par.visitor = visitor;
+  par.limit = (uint32_t)threads * 4;
+  rc = osal_condpair_init(&par.condpair);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+  rc = osal_fastmutex_init(&par.visitor_lock);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    osal_condpair_destroy(&par.condpair);
+    return rc;
+  }
+
+  walk_ctx_t *const ctxs = osal_calloc(threads, sizeof(walk_ctx_t));
+  walk_worker_t *const workers = osal_calloc(threads, sizeof(walk_worker_t));
+  osal_thread_t *const handles = osal_calloc(threads, sizeof(osal_thread_t));
+  rc = (ctxs && workers && handles) ? MDBX_SUCCESS : MDBX_ENOMEM;
+
+  walk_tbl_t gc = {.name = {.iov_base = MDBX_CHK_GC}, .internal = &txn->dbs[FREE_DBI]};
+  walk_tbl_t main = {.name = {.iov_base = MDBX_CHK_MAIN}, .internal = &txn->dbs[MAIN_DBI]};
+  if (likely(rc == MDBX_SUCCESS) && (options & dont_walk_GC) == 0 &&
+      unlikely(!walk_enqueue(&par, txn, &gc, P_INVALID, 0, 0, 0)))
+    rc = MDBX_ENOMEM;
+  if (likely(rc == MDBX_SUCCESS) && (options & dont_walk_MAIN) == 0 &&
+      unlikely(!walk_enqueue(&par, txn, &main, P_INVALID, 0, 0, 0)))
+    rc = MDBX_ENOMEM;
+
+  size_t started = 0;
+  while (rc == MDBX_SUCCESS && started < threads) {
+    walk_ctx_t *const ctx = ctxs + started;
+    workers[started].par = &par;
+    workers[started].userctx = users[started];
+    ctx->txn = txn;
+    ctx->userctx = workers + started;
+    ctx->visitor = walk_visitor_locked;
+    ctx->options = options;
+    ctx->par = &par;
+    rc = osal_thread_create(handles + started, walk_worker, ctx);
+    if (likely(rc == MDBX_SUCCESS))
+      started += 1;
+    else if (started) {
+      WARNING("unable to start walking worker #%zu, err %d", started, rc);
+      rc = MDBX_SUCCESS;
+      break;
+    }
+  }
+
+  osal_condpair_lock(&par.condpair);
+  if (unlikely(rc != MDBX_SUCCESS))
+    walk_par_error(&par, rc);
+  while (par.pending && !par.stop) {
+    int err = osal_condpair_wait(&par.condpair, true);
+    if (unlikely(err != MDBX_SUCCESS))
+      walk_par_error(&par, err);
+  }
+  par.stop = true;
+  osal_condpair_signal(&par.condpair, false);
+  osal_condpair_unlock(&par.condpair);
+
+  for (size_t i = 0; i < started; ++i) {
+    int err = osal_thread_join(handles[i]);
+    if (unlikely(err != MDBX_SUCCESS) && !par.error)
+      par.error = err;
+  }
+  while (par.queue) {
+    walk_job_t *const job = par.queue;
+    par.queue = job->next;
+    osal_free(job);
+  }
+  osal_fastmutex_destroy(&par.visitor_lock);
+  osal_condpair_destroy(&par.condpair);
+  osal_free(handles);
+  osal_free(workers);
+  osal_free(ctxs);
+  return par.error;
+}
+
 #if defined(_WIN32) || defined(_WIN64)
 
 //------------------------------------------------------------------------------
@@ -436,7 +436,8 @@ enum signatures {
   txn_signature = INT32_C(0x13D53A31),
   cur_signature_live = INT32_C(0x7E05D5B1),
   cur_signature_ready4dispose = INT32_C(0x2817A047),
-  cur_signature_wait4eot = INT32_C(0x10E297A7)
+  cur_signature_wait4eot = INT32_C(0x10E297A7),
+  hcache_signature = INT32_C(0x4CAC4E17)
 };
 
 /*----------------------------------------------------------------------------*/
@@ -620,6 +621,11 @@ struct MDBX_txn {
         rkl_t ready4reuse; /* The list of reclaimed txn-ids from GC, and cleared/deleted */
         uint64_t spent;    /* Time spent reading and searching GC */
         rkl_t comeback;    /* The list of ids of records returned into GC during commit, etc */
+        size_t rsteps;     /* Search iterations inside GC, kept for the next txn */
+        unsigned rp_augment_limit; /* Effective for this txn, see MDBX_opt_gc_adaptive */
+        uint8_t policy;            /* MDBX_gc_policy_reasons_t */
+        bool lifo;                 /* LIFO reclaiming, see MDBX_LIFORECLAIM */
+        unsigned prefetch_countdown; /* Allocations left until the next repnl prefetch */
       } gc;
       bool prefault_write_activated;
 #if MDBX_ENABLE_REFUND
@@ -652,6 +658,9 @@ struct MDBX_txn {
         size_t writemap_dirty_npages;
         size_t writemap_spilled_npages;
       };
+      struct {
+        size_t spilled, unspilled;
+      } spill_stat; /* see MDBX_txn_info and MDBX_opt_spill_policy */
       void *preserve_parent_userctx;
       /* In write txns, next is located the array of cursors for each DB */
     } wr;
@@ -817,12 +826,20 @@ struct MDBX_env {
     uint8_t spill_parent4child_denominator;
     uint16_t merge_threshold_dot16;
     uint16_t split_reserve_dot16;
+    uint16_t defrag_auto_threshold_dot16; /* see MDBX_opt_defrag_auto_threshold */
+    uint32_t defrag_auto_time_limit_dot16;
+    unsigned defrag_auto_batch;
+    uint8_t page_checksum;
+    uint8_t spill_policy;           /* see MDBX_opt_spill_policy */
+    uint32_t hotmap_interval_dot16; /* see MDBX_opt_hotmap_interval */
 #if !(defined(_WIN32) || defined(_WIN64))
     unsigned writethrough_threshold;
 #endif /* Windows */
     bool prefault_write;
     bool prefer_waf_insteadof_balance; /* Strive to minimize WAF instead of
                                           balancing pages fullment */
+    bool group_commit;                 /* see MDBX_opt_group_commit */
+    bool gc_adaptive;                  /* see MDBX_opt_gc_adaptive */
     bool need_dp_limit_adjust;
     struct {
       uint16_t limit;
@@ -853,6 +870,16 @@ struct MDBX_env {
     size_t shrink; /* threshold to shrink datafile */
   } geo_in_bytes;
 
+  struct {                      /* page checksums, see MDBX_opt_page_checksum */
+    osal_mmap_t map;            /* mapped checksums file */
+    size_t capacity;            /* number of entries */
+    mdbx_atomic_uint64_t *seen; /* cache of already verified pages */
+    bool writer;                /* checksums are maintained by this process */
+    bool verify;                /* pages are verified when accessed */
+    bool dirty;                 /* checksums are updated but not flushed yet */
+    bool incomplete;            /* some pages were written without checksums */
+  } pgsum;
+
 #if MDBX_LOCKING == MDBX_LOCKING_SYSV
   union {
     key_t key;
@@ -886,9 +913,46 @@ struct MDBX_env {
   MDBX_txn *txn; /* current write transaction */
   struct {
     txnid_t detent;
+    /* see MDBX_opt_gc_adaptive */
+    txnid_t drain_edge;    /* the backlog of GC records to drain by FIFO */
+    txnid_t fifo_progress; /* the most recent GC record reclaimed by FIFO */
+    size_t backlog_base;   /* the backlog left after draining */
+    unsigned fifo_penalty; /* txns to use FIFO due to expensive LIFO rescans */
+    bool draining;
   } gc;
   osal_fastmutex_t dbi_lock;
-  unsigned n_dbi; /* number of DBs opened */
+  osal_fastmutex_t group_sync_lock; /* see MDBX_opt_group_commit */
+  unsigned n_dbi;                   /* number of DBs opened */
+
+  struct { /* background sync thread, see mdbx_txn_commit_async() */
+    osal_condpair_t condpair;
+    osal_thread_t thread;
+    txnid_t pending; /* the most recent txnid awaiting for durability */
+    bool running, stop;
+    MDBX_durable_notify_func *notify;
+    void *notify_ctx;
+  } flusher;
+
+  struct { /* background defragmentation, see MDBX_opt_defrag_auto_threshold */
+    osal_condpair_t condpair;
+    osal_thread_t thread;
+    mdbx_atomic_uint32_t writers_waiting; /* in-process writers waiting for the lock */
+    bool running, stop, pending;
+  } defragger;
+
+  struct { /* periodic saving of the hot-page map, see MDBX_opt_hotmap_interval */
+    osal_condpair_t condpair;
+    osal_thread_t thread;
+    mdbx_mode_t mode; /* file permissions passed to mdbx_env_open() */
+    bool running, stop;
+  } hotmap;
+
+  struct { /* see mdbx_env_set_commit_stream() */
+    MDBX_commit_stream_func *func;
+    void *ctx;
+    mdbx_filehandle_t fd;
+    uint8_t *buffer;
+  } stream;
 
   unsigned shadow_reserve_len;
   page_t *__restrict shadow_reserve; /* list of malloc'ed blocks for re-use */
@@ -2466,6 +2530,16 @@ void txn_managed::commit(finalization_latency *latency) {
     MDBX_CXX20_UNLIKELY err.throw_exception();
 }
 
+uint64_t txn_managed::commit_async(finalization_latency *latency) {
+  uint64_t txnid = 0;
+  const error err = static_cast<MDBX_error_t>(::mdbx_txn_commit_async(handle_, latency, &txnid));
+  if (MDBX_LIKELY(err.code() != MDBX_THREAD_MISMATCH && err.code() != MDBX_EINVAL))
+    MDBX_CXX20_LIKELY handle_ = nullptr;
+  if (MDBX_UNLIKELY(err.code() != MDBX_SUCCESS))
+    MDBX_CXX20_UNLIKELY err.throw_exception();
+  return txnid;
+}
+
 bool txn_managed::checkpoint(finalization_latency *latency) {
   const error err = static_cast<MDBX_error_t>(::mdbx_txn_checkpoint(handle_, MDBX_TXN_NOWEAKING, latency));
   if (MDBX_UNLIKELY(err.is_failure())) {
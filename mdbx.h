@@ -870,6 +870,38 @@ enum MDBX_constants {
 #endif /* Windows */
 #endif /* MDBX_LOCK_SUFFIX */
 
+#ifndef MDBX_CHECKSUM_SUFFIX
+/** \brief The suffix of the page checksums file, which is placed next to the data file.
+ * \see MDBX_opt_page_checksum */
+#if !(defined(_WIN32) || defined(_WIN64))
+#define MDBX_CHECKSUM_SUFFIX "-sum"
+#else
+#define MDBX_CHECKSUM_SUFFIX_W L"-sum"
+#define MDBX_CHECKSUM_SUFFIX_A "-sum"
+#ifdef UNICODE
+#define MDBX_CHECKSUM_SUFFIX MDBX_CHECKSUM_SUFFIX_W
+#else
+#define MDBX_CHECKSUM_SUFFIX MDBX_CHECKSUM_SUFFIX_A
+#endif /* UNICODE */
+#endif /* Windows */
+#endif /* MDBX_CHECKSUM_SUFFIX */
+
+#ifndef MDBX_HOTMAP_SUFFIX
+/** \brief The suffix of the hot-page map file, which is placed next to the lock file.
+ * \see mdbx_env_hotmap_save() */
+#if !(defined(_WIN32) || defined(_WIN64))
+#define MDBX_HOTMAP_SUFFIX "-hot"
+#else
+#define MDBX_HOTMAP_SUFFIX_W L"-hot"
+#define MDBX_HOTMAP_SUFFIX_A "-hot"
+#ifdef UNICODE
+#define MDBX_HOTMAP_SUFFIX MDBX_HOTMAP_SUFFIX_W
+#else
+#define MDBX_HOTMAP_SUFFIX MDBX_HOTMAP_SUFFIX_A
+#endif /* UNICODE */
+#endif /* Windows */
+#endif /* MDBX_HOTMAP_SUFFIX */
+
 /* DEBUG & LOGGING ************************************************************/
 
 /** \addtogroup c_debug
@@ -1718,7 +1750,23 @@ typedef enum MDBX_copy_flags {
 
   /** Silently overwrite the target file, if it exists, instead of returning an error
    * \see mdbx_txn_copy2pathname() \see mdbx_env_copy() */
-  MDBX_CP_OVERWRITE = 64u
+  MDBX_CP_OVERWRITE = 64u,
+
+  /** Use multiple threads for compactification, i.e. in conjunction with \ref MDBX_CP_COMPACT only.
+   *
+   * The large tables and top-level branch ranges of large b-trees are distributed among worker threads,
+   * each of which pre-computes the output page numbers from the page counts of the b-tree structures
+   * and writes the compacted pages directly into the corresponding positions of the destination file.
+   * The result is byte-identical to the single-threaded compactification.
+   *
+   * \note The page counts are checked during copying, so in case of any discrepancy between ones and
+   * the actual b-tree structure (i.e. a damage of the source DB) the copying is aborted with
+   * \ref MDBX_CORRUPTED error.
+   * Since positioned writing is required, this flag has no effect if the destination is a pipe.
+   * Likewise, this flag has no effect when copying within a write transaction,
+   * since the workers share the source transaction and that must be a read-only one.
+   * The \ref MDBX_CP_THROTTLE_MVCC is not applicable while workers are running. */
+  MDBX_CP_PARALLEL = 128u
 
 } MDBX_copy_flags_t;
 DEFINE_ENUM_FLAG_OPERATORS(MDBX_copy_flags)
@@ -2444,9 +2492,156 @@ typedef enum MDBX_option {
    *
    * The option value is specified in units of 1/65536 of the page size: minimal 0, maximal 50% (32768),
    * default is 0. */
-  MDBX_opt_split_reserve
+  MDBX_opt_split_reserve,
+
+  /** \brief Controls the page checksums to catch a silent corruption of data on a media.
+   *
+   * \details The page header has no room for a checksum, therefore checksums (CRC32C, hardware-accelerated where
+   * available) are kept in a separate file next to the data file, with the \ref MDBX_CHECKSUM_SUFFIX suffix. Each entry
+   * of this file is bound to a page version by txnid, so the pages written by processes which do not maintain the
+   * checksums (including older versions of libmdbx or processes opened the database in \ref MDBX_WRITEMAP mode) are not
+   * verified, but never lead to false alarms. The method used is recorded into the meta-pages of the database.
+   *
+   *  - 0 = disabled, nothing is done (default);
+   *  - 1 = checksums are calculated and stored for pages written by write transactions,
+   *        with a cost proportional to the volume of written data;
+   *  - 2 = in addition to the above, the pages are verified lazily when accessed,
+   *        i.e. each page version is verified once per process (with some exceptions due to limited memoization),
+   *        and a mismatch is reported as \ref MDBX_CORRUPTED.
+   *
+   * The costs could be measured by the `mi_checksum` counters of \ref MDBX_envinfo.
+   *
+   * The checksums file is opened together with the environment, therefore changing the option between zero and
+   * non-zero values is only possible before \ref mdbx_env_open(). While the environment is open the option could be
+   * switched between 1 and 2, i.e. the verification could be enabled and disabled at runtime.
+   *
+   * \note The checksums are not maintained in the \ref MDBX_WRITEMAP mode, since the dirty pages are not written
+   * explicitly, but could be verified in the case ones were maintained by other processes. */
+  MDBX_opt_page_checksum,
+
+  /** \brief Controls the "group commit" mode for durable write transactions.
+   *
+   * \details By default, each write transaction committed in the \ref MDBX_SYNC_DURABLE mode pays for its own
+   * `fdatasync()` (or `msync()`) while holding the write lock. Since the write lock is exclusive, there is no way to
+   * combine such syncs of concurrent writers, so the throughput of small durable transactions is bounded by the
+   * latency of the storage.
+   *
+   * When this option is enabled (non-zero value), a durable commit writes the meta-page weakly (as in the
+   * \ref MDBX_SAFE_NOSYNC mode), releases the write lock and then waits until the transaction is covered by a steady
+   * meta-page. Only one of the waiting writers of a process performs the sync, which makes durable all transactions
+   * committed to that moment, and the other waiters just return once their commits were covered. Thus the
+   * \ref mdbx_txn_commit_ex() returns only after the transaction became durable, but a single sync is shared by a
+   * group of concurrent writers.
+   *
+   *  - 0 = disabled, each durable commit performs its own sync (default);
+   *  - 1 = enabled.
+   *
+   * The option affects only the transactions committed in the \ref MDBX_SYNC_DURABLE mode, i.e. neither
+   * \ref MDBX_NOMETASYNC nor \ref MDBX_SAFE_NOSYNC is used, and only by \ref mdbx_txn_commit_ex() but not by
+   * \ref mdbx_txn_checkpoint(). The time of waiting for the group sync is accounted as the `sync` phase of
+   * \ref MDBX_commit_latency.
+   *
+   * \note If the group sync fails, the error is returned but the transaction remains committed,
+   * although it could be lost in case of a system crash. */
+  MDBX_opt_group_commit,
+
+  /** \brief Controls the background (automatic) defragmentation of a database.
+   *
+   * \details When this option is enabled (non-zero value), each commit of a write transaction kicks a background
+   * thread, which checks the ratio of reclaimable GC pages to allocated pages via \ref mdbx_gc_info() and, if the ratio
+   * is not less than the specified threshold, performs \ref mdbx_env_defrag() with the limits specified by
+   * \ref MDBX_opt_defrag_auto_batch and \ref MDBX_opt_defrag_auto_time_limit options. The background defragmentation
+   * is performed only when the write lock is not held by anyone, and it is discontinued as soon as a write transaction
+   * of the same process starts waiting for the lock. Therefore the latency of writers is increased at most by
+   * completion of an already started small batch of page movements.
+   *
+   * To avoid unreasonable overhead, the checks are performed not more often than once per 16 of
+   * \ref MDBX_opt_defrag_auto_time_limit, i.e. the write lock is held by the background defragmentation no more than
+   * about 1/16 of the time. The kicks of a faster succession of commits are coalesced, so the defragmentation is
+   * resumed by a next commit after the pause. In case there are no commits at all, the database does not become more
+   * fragmented and the \ref mdbx_env_defrag() could be used explicitly.
+   *
+   * The option value is specified in units of 1/65536 of the ratio: minimal 0, maximal 100% (65535),
+   * default is 0, which means the background defragmentation is disabled.
+   *
+   * \note The write transactions of other processes are not tracked, so these ones could wait for completion of a
+   * current batch up to the \ref MDBX_opt_defrag_auto_time_limit. */
+  MDBX_opt_defrag_auto_threshold,
+
+  /** \brief Sets the preferred maximum number of pages to be moved per a cycle of the background defragmentation.
+   * \see MDBX_opt_defrag_auto_threshold
+   * \see mdbx_env_defrag()
+   *
+   * \details Smaller batches yield the write lock faster, but require more commits to achieve a similar result.
+   * Zero means no limit, default is 1024. */
+  MDBX_opt_defrag_auto_batch,
+
+  /** \brief Sets the time limit of a single run of the background defragmentation
+   * in 1/65536 units of second.
+   * \see MDBX_opt_defrag_auto_threshold
+   * \see mdbx_env_defrag()
+   *
+   * \details Zero means no limit, default is 100 milliseconds (6554). */
+  MDBX_opt_defrag_auto_time_limit,
+
+  /** \brief Controls the adaptive choice between LIFO and FIFO policies for recycling the GC items.
+   * \see MDBX_LIFORECLAIM
+   * \see MDBX_gc_policy_reasons_t
+   *
+   * \details By default, the recycling policy is defined by the \ref MDBX_LIFORECLAIM flag statically. When this
+   * option is enabled, the policy is chosen for each write transaction individually: the LIFO is used, unless
+   * one of the conditions is met where it gives no benefit or becomes expensive:
+   *  - the transaction is not durable, i.e. \ref MDBX_SAFE_NOSYNC or \ref MDBX_UTTERLY_NOSYNC is used;
+   *  - the number of pages retained by readers (see `max_retained_pages` of \ref MDBX_commit_latency)
+   *    exceeds the \ref MDBX_opt_txn_dp_limit, so pages available for recycling are definitely not "hot";
+   *  - a backlog of old GC items, which are not recycled with LIFO, has accumulated;
+   *    while draining such backlog, the \ref MDBX_opt_rp_augment_limit is doubled, unless it was set explicitly;
+   *  - the previous LIFO transaction made too many search steps inside GC (see `work_rsteps` of
+   *    \ref MDBX_commit_latency), since each LIFO search starts from the oldest reader.
+   *
+   * The decisions made are returned via the `gc_policy` field of \ref MDBX_commit_latency.
+   *
+   *  - 0 = disabled, the policy is defined by \ref MDBX_LIFORECLAIM (default);
+   *  - 1 = enabled. */
+  MDBX_opt_gc_adaptive,
+
+  /** \brief Controls the policy of choosing dirty pages to be spilled to disk.
+   * \see MDBX_spill_policy_t
+   * \see MDBX_opt_txn_dp_limit
+   * \see MDBX_opt_spill_max_denominator
+   *
+   * \details The value should be one of \ref MDBX_spill_policy_t, by default \ref MDBX_spill_lru is used.
+   * The numbers of pages spilled and unspilled by a transaction are returned by \ref mdbx_txn_info(),
+   * see `txn_spilled` and `txn_unspilled` fields of \ref MDBX_txn_info. */
+  MDBX_opt_spill_policy,
+
+  /** \brief Sets the interval of periodic saving the hot-page map in 1/65536 units of second.
+   * \see mdbx_env_hotmap_save()
+   * \see MDBX_warmup_hotmap
+   *
+   * \details When a non-zero value is set, an internal background thread of the environment samples the residency
+   * of database pages in RAM and saves the hot-page map with the given interval, as well as once more when the
+   * environment is closed. Zero disables the periodic saving (default).
+   *
+   * \note The residency of pages is sampled by `mincore()`, therefore where it is unavailable (e.g. on Windows)
+   * a non-zero value is rejected with \ref MDBX_ENOSYS and the background thread is never started. */
+  MDBX_opt_hotmap_interval
 } MDBX_option_t;
 
+/** \brief The policies of choosing dirty pages to be spilled to disk.
+ * \ingroup c_settings
+ * \see MDBX_opt_spill_policy */
+typedef enum MDBX_spill_policy {
+  /** Spill the least recently touched pages, while preferring large pages and adjacent pages
+   * to coalesce writes (default). */
+  MDBX_spill_lru = 0,
+
+  /** Same as \ref MDBX_spill_lru, but a page which was touched again after being dirtied, or which had to be read
+   * back after spilling, gets a second chance (a CLOCK-like reference bit) since spilling it most likely will be
+   * followed by the unspilling, i.e. by the re-reading from disk. The reference bits are reset by each spilling. */
+  MDBX_spill_clock = 1
+} MDBX_spill_policy_t;
+
 /** \brief Sets the value of a extra runtime options for an environment.
  * \ingroup c_settings
  *
@@ -2788,6 +2983,145 @@ LIBMDBX_API int mdbx_env_copy2fd(MDBX_env *env, mdbx_filehandle_t fd, MDBX_copy_
  * \returns A non-zero error value on failure and 0 on success. */
 LIBMDBX_API int mdbx_txn_copy2fd(MDBX_txn *txn, mdbx_filehandle_t fd, MDBX_copy_flags_t flags);
 
+/** \brief Makes an incremental copy of an environment to the specified file
+ * descriptor, i.e. writes only the pages changed after the given snapshot.
+ * \ingroup c_extra
+ *
+ * Every page carries the ID of the transaction which wrote it, and any change
+ * within a b-tree produces a new copy of the pages on the path to its root.
+ * So the b-trees are walked from the roots skipping the subtrees which are not
+ * newer than `since_txnid`, and only the pages of the current snapshot, which
+ * were changed (including ones of the GC) are written along with the meta-pages.
+ *
+ * The result is applicable by \ref mdbx_env_apply_incremental() to an as-is
+ * copy (i.e. made without \ref MDBX_CP_COMPACT) of the snapshot `since_txnid`,
+ * or an image previously updated up to it. Thus a chain of incremental copies
+ * could be applied to a full copy one by one. An as-is copy keeps the GUID of
+ * the database (see \ref MDBX_envinfo::mi_dxbid), which is recorded in the
+ * incremental copy along with the b-trees and geometry of the base snapshot,
+ * the latter only if it is still one of the meta-pages while copying.
+ *
+ * \see mdbx_env_copy2fd()
+ *
+ * \param [in] env          An environment handle returned by mdbx_env_create().
+ *                          It must have already been opened successfully.
+ * \param [in] since_txnid  The transaction ID of the base snapshot, i.e. of the
+ *                          previous full or incremental copy. Zero value
+ *                          means all pages of the current snapshot.
+ * \param [in] fd           The file descriptor to write the copy to, including
+ *                          a pipe, socket or FIFO.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_EINVAL   The `since_txnid` is greater than ID of the current
+ *                       snapshot. */
+LIBMDBX_API int mdbx_env_copy_incremental(MDBX_env *env, uint64_t since_txnid, mdbx_filehandle_t fd);
+
+/** \brief Applies an incremental copy made by \ref mdbx_env_copy_incremental()
+ * to a database image.
+ * \ingroup c_extra
+ *
+ * The image must be a copy of the snapshot the incremental one was made
+ * against, i.e. its recent steady meta-page must have the transaction ID equal
+ * to `since_txnid` of the incremental copy, the same database GUID, and the
+ * same b-trees and geometry if these were recorded. All of this is checked
+ * before writing any page.
+ *
+ * The input may contain a sequence of incremental copies, each of which is
+ * made against the snapshot of the previous one, e.g. the data written by the
+ * commit stream (see \ref mdbx_env_set_commit_stream_fd()). All of them are
+ * applied up to the end of input.
+ *
+ * \note The image must not be opened by any environment. The meta-pages are
+ *       invalidated before updating and restored only after all pages are
+ *       written and flushed, so the image becomes unusable if applying fails.
+ *       However, the pages of a single commit are never reachable from the
+ *       snapshot of the previous one, therefore, for the data of the commit
+ *       stream, the image is restored up to the last completely applied
+ *       transaction even if the input is truncated or damaged.
+ *
+ * \param [in] dest_fd   The file descriptor of the database image opened for
+ *                       Read and Write access.
+ * \param [in] delta_fd  The file descriptor to read the incremental copy
+ *                       from, including a pipe, socket or FIFO.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_INVALID       The input is not an incremental copy.
+ * \retval MDBX_INCOMPATIBLE  The image isn't the base snapshot of the
+ *                            incremental copy.
+ * \retval MDBX_CORRUPTED     The incremental copy is damaged.
+ * \retval MDBX_ENODATA       The incremental copy is truncated. */
+LIBMDBX_API int mdbx_env_apply_incremental(mdbx_filehandle_t dest_fd, mdbx_filehandle_t delta_fd);
+
+/** \brief A callback function to receive the commit stream.
+ * \ingroup c_extra
+ * \see mdbx_env_set_commit_stream()
+ *
+ * \details The function is called by the thread committing a write
+ * transaction while the write lock is held, so it should not block for a long
+ * time and must not use any transactions of the environment.
+ *
+ * \param [in] env    An environment handle.
+ * \param [in] ctx    A pointer passed to \ref mdbx_env_set_commit_stream().
+ * \param [in] txnid  The ID of the committed transaction.
+ * \param [in] data   A portion of the stream, or NULL at the end of data of
+ *                    the committed transaction.
+ * \param [in] bytes  The size of the portion of the stream in bytes, or zero
+ *                    at the end of data of the committed transaction.
+ *
+ * \returns A non-zero error value to stop the stream, or 0 to continue. */
+typedef int(MDBX_commit_stream_func)(MDBX_env *env, void *ctx, uint64_t txnid, const void *data, size_t bytes);
+
+/** \brief Sets a callback function to receive the page-level changes of
+ * every committed write transaction, i.e. the commit stream.
+ * \ingroup c_extra
+ * \see mdbx_env_set_commit_stream_fd()
+ * \see mdbx_env_apply_incremental()
+ *
+ * Right after the meta-page of a write transaction is written, the changed
+ * pages of the committed snapshot and its meta-pages are passed to the
+ * callback in the format of \ref mdbx_env_copy_incremental() against the
+ * previous snapshot. Thus the stream could be applied to an as-is copy of the
+ * database by \ref mdbx_env_apply_incremental() to get a replica.
+ *
+ * The stream has no gaps, i.e. the data of every transaction is made against
+ * the snapshot of the previous one. A change of the database geometry outside
+ * of a write transaction (see \ref mdbx_env_set_geometry()) also produces a
+ * transaction ID, so it is passed as a transaction consisting only of the
+ * meta-pages. So in case of an error of the callback
+ * (or of writing to the file descriptor) the commit is considered successful,
+ * but the stream is stopped, which is reported to the log, and should be
+ * restarted with a new copy of the database.
+ *
+ * \param [in] env   An environment handle returned by \ref mdbx_env_create().
+ * \param [in] func  A \ref MDBX_commit_stream_func callback, or NULL to stop
+ *                   the stream.
+ * \param [in] ctx   A pointer to be passed to the callback.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_EACCESS  The environment is opened in read-only mode. */
+LIBMDBX_API int mdbx_env_set_commit_stream(MDBX_env *env, MDBX_commit_stream_func *func, void *ctx);
+
+/** \brief Sets a file descriptor to write the commit stream to.
+ * \ingroup c_extra
+ * \see mdbx_env_set_commit_stream()
+ *
+ * The function acts like \ref mdbx_env_set_commit_stream(), but the stream is
+ * written to the given file descriptor, including a pipe, socket or FIFO.
+ *
+ * \note The written data is not flushed to a storage, so a file should be
+ *       opened with `O_DSYNC` if required.
+ *
+ * \param [in] env  An environment handle returned by \ref mdbx_env_create().
+ * \param [in] fd   The file descriptor to write the stream to, or an invalid
+ *                  one (i.e. `-1` for POSIX and `INVALID_HANDLE_VALUE` for
+ *                  Windows) to stop the stream.
+ *
+ * \returns A non-zero error value on failure and 0 on success. */
+LIBMDBX_API int mdbx_env_set_commit_stream_fd(MDBX_env *env, mdbx_filehandle_t fd);
+
 /** \brief Statistics for a table in the environment
  * \ingroup c_statinfo
  * \see mdbx_env_stat_ex() \see mdbx_dbi_stat() */
@@ -2918,6 +3252,28 @@ struct MDBX_envinfo {
   struct {
     uint64_t x, y;
   } mi_dxbid;
+
+  /** Page checksums, see \ref MDBX_opt_page_checksum.
+   * \details The counters are overall for all processes in the current multi-process session, the same as for
+   * the `mi_pgop_stat`. */
+  struct {
+    uint32_t method;     /**< ID of checksum method recorded in the database, zero for none */
+    uint32_t mode;       /**< Current value of \ref MDBX_opt_page_checksum for the environment */
+    uint64_t computed;   /**< Quantity of pages checksummed while writing */
+    uint64_t verified;   /**< Quantity of pages verified when accessed */
+    uint64_t mismatched; /**< Quantity of checksum mismatches caught */
+  } mi_checksum;
+
+  /** Allocation of slots in the readers table.
+   * \details Free slots are claimed without acquiring the readers table lock, which is taken only when a free slot
+   * was not found, e.g. the table should be extended. The counters are overall for all processes in the current
+   * multi-process session, the same as for the `mi_pgop_stat`, but wrap around on overflow. */
+  struct {
+    uint32_t lockfree;   /**< Quantity of slots claimed without acquiring the lock */
+    uint32_t locked;     /**< Quantity of slots claimed under the lock */
+    uint32_t collisions; /**< Quantity of races lost to other readers for a free slot */
+    uint32_t exhausted;  /**< Quantity of cases the table was full and cleanup of dead readers was required */
+  } mi_rslot;
 };
 #ifndef __cplusplus
 /** \ingroup c_statinfo */
@@ -3268,6 +3624,32 @@ typedef enum MDBX_warmup_flags {
 
   /** Release the lock that was performed before by \ref MDBX_warmup_lock. */
   MDBX_warmup_release = 16,
+
+  /** Peeking pages by several threads in conjunction with \ref MDBX_warmup_force option.
+   * The used portion of the database is split into chunks which are distributed between the calling thread and up to
+   * `MDBX_WARMUP_MAXTHREADS` auxiliary threads, but no more than the number of online CPUs. */
+  MDBX_warmup_parallel = 32,
+
+  /** Pin auxiliary threads of \ref MDBX_warmup_parallel to CPUs spread evenly across all online CPUs.
+   * Under the default "first touch" memory policy, this distributes the loaded pages of the database across NUMA
+   * nodes instead of the node of the calling thread.
+   * \note Has effect only on Linux in conjunction with \ref MDBX_warmup_parallel option. */
+  MDBX_warmup_numa = 64,
+
+  /** Before peeking all pages, walk through the b-trees and load their branch pages, i.e. all pages except leaves
+   * and large/overflow ones. The GC and the main table are walked first, followed by the tables opened by
+   * DBI-handles, in order from the most recently modified. Such a walk is relatively cheap, but it allows the
+   * database to start serving lookups with a one page-fault per a leaf while the rest of data is loading.
+   * \note If the transaction is not specified, then a read-only transaction is started temporary for the walk. */
+  MDBX_warmup_btree = 128,
+
+  /** Load only the pages marked in the hot-page map previously saved by \ref mdbx_env_hotmap_save() or
+   * periodically in accordance with \ref MDBX_opt_hotmap_interval. The pages are loaded in the file order by
+   * large batches, each of which is announced to the OS kernel in advance to be read ahead.
+   * If the map is absent or does not match the database, then \ref MDBX_ENODATA is returned, unless
+   * \ref MDBX_warmup_force option is also specified. Otherwise, with \ref MDBX_warmup_force, the rest of
+   * the database is loaded after the hot pages. */
+  MDBX_warmup_hotmap = 256
 } MDBX_warmup_flags_t;
 DEFINE_ENUM_FLAG_OPERATORS(MDBX_warmup_flags)
 
@@ -3276,7 +3658,8 @@ DEFINE_ENUM_FLAG_OPERATORS(MDBX_warmup_flags)
  *
  * Depending on the specified flags, notifies OS kernel about following access,
  * force loads the database pages, including locks ones in memory or releases
- * such a lock. However, the function does not analyze the b-tree nor the GC.
+ * such a lock. However, the function does not analyze the GC, except walking
+ * through branch pages in case of \ref MDBX_warmup_btree option.
  * Therefore an unused pages that are in GC handled (i.e. will be loaded) in
  * the same way as those that contain payload.
  *
@@ -3291,7 +3674,7 @@ DEFINE_ENUM_FLAG_OPERATORS(MDBX_warmup_flags)
  * \param [in] timeout_seconds_16dot16  Optional timeout which checking only
  *                              during explicitly peeking database pages
  *                              for loading ones if the \ref MDBX_warmup_force
- *                              option was specified.
+ *                              or \ref MDBX_warmup_btree option was specified.
  *
  * \returns A non-zero error value on failure and 0 on success.
  * Some possible errors are:
@@ -3304,6 +3687,71 @@ DEFINE_ENUM_FLAG_OPERATORS(MDBX_warmup_flags)
 LIBMDBX_API int mdbx_env_warmup(const MDBX_env *env, const MDBX_txn *txn, MDBX_warmup_flags_t flags,
                                 unsigned timeout_seconds_16dot16);
 
+/** \brief A callback function to notify about progress of warming up the database.
+ * \ingroup c_settings
+ * \see mdbx_env_warmup_ex()
+ *
+ * \details The callback is called only from the thread calling \ref mdbx_env_warmup_ex(), at the beginning and
+ * end of the warming up, as well as often enough to track progress in a percentages.
+ *
+ * \param [in] ctx          A pointer to the context passed by a similar parameter in \ref mdbx_env_warmup_ex().
+ * \param [in] done_pages   The number of pages processed so far.
+ * \param [in] total_pages  The total number of pages to be processed, including branch pages of the b-trees
+ *                          in case of \ref MDBX_warmup_btree option.
+ *
+ * \returns Zero to continue warming up, otherwise warming up will be cancelled and \ref mdbx_env_warmup_ex()
+ * will return \ref MDBX_RESULT_TRUE. */
+typedef int (*MDBX_warmup_notify_func)(void *ctx, size_t done_pages, size_t total_pages) MDBX_CXX17_NOEXCEPT;
+
+/** \brief Warms up the database by loading pages into memory, with progress notification and cancellation.
+ * \ingroup c_settings
+ *
+ * Same as \ref mdbx_env_warmup(), but allows tracking progress and cancelling warming up.
+ *
+ * \param [in] env              An environment handle returned
+ *                              by \ref mdbx_env_create().
+ * \param [in] txn              A transaction handle returned
+ *                              by \ref mdbx_txn_begin().
+ * \param [in] flags            The \ref warmup_flags, bitwise OR'ed together.
+ * \param [in] timeout_seconds_16dot16  Optional timeout, see \ref mdbx_env_warmup().
+ * \param [in] progress_callback  An optional progress notification callback function with the signature
+ *                              \ref MDBX_warmup_notify_func, which is called only during explicitly peeking
+ *                              database pages, i.e. with \ref MDBX_warmup_force or \ref MDBX_warmup_btree options.
+ * \param [in] ctx              An optional pointer to some context that will be passed to the
+ *                              `progress_callback()` function as it is.
+ *
+ * \returns A non-zero error value on failure and 0 on success.
+ * Some possible errors are:
+ *
+ * \retval MDBX_ENOSYS        The system does not support requested
+ * operation(s).
+ *
+ * \retval MDBX_RESULT_TRUE   The specified timeout is reached or warming up was cancelled by the callback
+ *                            during load data into memory. */
+LIBMDBX_API int mdbx_env_warmup_ex(const MDBX_env *env, const MDBX_txn *txn, MDBX_warmup_flags_t flags,
+                                   unsigned timeout_seconds_16dot16, MDBX_warmup_notify_func progress_callback,
+                                   void *ctx);
+
+/** \brief Saves the hot-page map, i.e. the map of database pages currently resident in RAM.
+ * \ingroup c_settings
+ * \see MDBX_warmup_hotmap
+ * \see MDBX_opt_hotmap_interval
+ *
+ * The residency of the used part of the database is sampled by `mincore()` and saved as a compact bitmap into the
+ * file next to the lock file, see \ref MDBX_HOTMAP_SUFFIX. Such a map allows to load only the recently hot pages
+ * after restart by \ref mdbx_env_warmup() with \ref MDBX_warmup_hotmap option.
+ *
+ * The file is created with the permissions passed to \ref mdbx_env_open(), or only an existing file is updated
+ * if those were zero. The map is a hint only, so it is not synced to disk and it is ignored if it does not match
+ * the database.
+ *
+ * \param [in] env  An environment handle returned by \ref mdbx_env_create().
+ *
+ * \returns A non-zero error value on failure and 0 on success.
+ * Some possible errors are:
+ * \retval MDBX_ENOSYS  The system does not support `mincore()`. */
+LIBMDBX_API int mdbx_env_hotmap_save(const MDBX_env *env);
+
 /** \brief Set environment flags.
  * \ingroup c_settings
  *
@@ -4088,6 +4536,17 @@ struct MDBX_txn_info {
   /** Number of page get operations within this transaction
      if corresponding statistics enabled via \ref MDBX_ENABLE_PGET_STAT build option. */
   uint64_t txn_pget;
+
+  /** For WRITE transaction: The number of dirty pages spilled to disk during this transaction,
+     including ones spilled by committed nested transactions.
+     \see MDBX_opt_spill_policy */
+  uint64_t txn_spilled;
+
+  /** For WRITE transaction: The number of pages read back after spilling during this transaction,
+     including ones unspilled by committed nested transactions. The ratio of `txn_unspilled` to `txn_spilled`
+     shows how well the pages to be spilled were chosen.
+     \see MDBX_opt_spill_policy */
+  uint64_t txn_unspilled;
 };
 #ifndef __cplusplus
 /** \ingroup c_statinfo */
@@ -4139,6 +4598,22 @@ MDBX_NOTHROW_PURE_FUNCTION LIBMDBX_API MDBX_txn_flags_t mdbx_txn_flags(const MDB
  *          otherwise 0. */
 MDBX_NOTHROW_PURE_FUNCTION LIBMDBX_API uint64_t mdbx_txn_id(const MDBX_txn *txn);
 
+/** \brief The reasons for choosing the GC recycling policy.
+ * \details Any number of individual values could be OR'ed together.
+ * \ingroup c_statinfo
+ * \see MDBX_opt_gc_adaptive
+ * \see MDBX_commit_latency */
+typedef enum MDBX_gc_policy_reasons {
+  MDBX_gc_policy_static = 0,     /**< The policy is defined by \ref MDBX_LIFORECLAIM */
+  MDBX_gc_policy_adaptive = 1,   /**< The policy is chosen adaptively, LIFO unless any other reasons given */
+  MDBX_gc_policy_nosync = 2,     /**< FIFO since the transaction is not durable */
+  MDBX_gc_policy_reader_lag = 4, /**< FIFO since too many pages are retained by readers */
+  MDBX_gc_policy_backlog = 8,    /**< FIFO to drain a backlog of old GC items */
+  MDBX_gc_policy_rescans = 16,   /**< FIFO since LIFO search inside GC became expensive */
+  MDBX_gc_policy_augmented = 32  /**< The \ref MDBX_opt_rp_augment_limit was doubled to drain a backlog */
+} MDBX_gc_policy_reasons_t;
+DEFINE_ENUM_FLAG_OPERATORS(MDBX_gc_policy_reasons)
+
 /** \brief Latency of commit stages in 1/65536 of seconds units.
  * \warning This structure may be changed in future releases.
  * \ingroup c_statinfo
@@ -4227,6 +4702,19 @@ struct MDBX_commit_latency {
     /** \brief The maximum noticed number of pages withheld from reclaimed due to reading old MVCC-snapshots. */
     uint32_t max_retained_pages;
   } gc_prof;
+
+  /** \brief The GC recycling policy used by the transaction.
+   * \see MDBX_opt_gc_adaptive */
+  struct {
+    /** \brief Non-zero if the LIFO policy was used, otherwise FIFO. */
+    uint32_t lifo;
+    /** \brief The reasons of the choice as a mask of OR'ed \ref MDBX_gc_policy_reasons_t bits. */
+    uint32_t reasons;
+    /** \brief The effective limit of the reclaimed pages list, see \ref MDBX_opt_rp_augment_limit. */
+    uint32_t rp_augment_limit;
+    /** \brief The number of search iterations inside GC made by the transaction. */
+    uint32_t rsteps;
+  } gc_policy;
 };
 #ifndef __cplusplus
 /** \ingroup c_statinfo */
@@ -4287,6 +4775,79 @@ typedef struct MDBX_commit_latency MDBX_commit_latency;
  * \warning This function may be changed in future releases. */
 LIBMDBX_API int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency);
 
+/** \brief A callback function to notify that asynchronously committed transactions became durable.
+ * \ingroup c_transactions
+ * \see mdbx_txn_commit_async()
+ * \see mdbx_env_set_durable_notify()
+ *
+ * \details The function is called from an internal background thread of the environment (the flusher), so it must
+ * not use any transactions nor block for a long time.
+ *
+ * \param [in] env           An environment handle.
+ * \param [in] ctx           A pointer passed to \ref mdbx_env_set_durable_notify().
+ * \param [in] steady_txnid  The ID of the most recent steady (durable) transaction, all transactions with a less
+ *                           or equal ID are durable.
+ * \param [in] err           The result of the sync operation, in case of an error the steady_txnid may be less
+ *                           than the ID of transactions awaiting for durability. */
+typedef void(MDBX_durable_notify_func)(MDBX_env *env, void *ctx, uint64_t steady_txnid, int err);
+
+/** \brief Sets a callback function to notify that asynchronously committed transactions became durable.
+ * \ingroup c_transactions
+ * \see mdbx_txn_commit_async()
+ *
+ * \param [in] env   An environment handle returned by \ref mdbx_env_create().
+ * \param [in] func  A \ref MDBX_durable_notify_func callback, or NULL to disable notifications.
+ * \param [in] ctx   A pointer to be passed to the callback.
+ *
+ * \returns A non-zero error value on failure and 0 on success. */
+LIBMDBX_API int mdbx_env_set_durable_notify(MDBX_env *env, MDBX_durable_notify_func *func, void *ctx);
+
+/** \brief Commits all changes of a top-level write transaction without waiting for the durability.
+ * \ingroup c_transactions
+ * \see mdbx_txn_commit_ex()
+ * \see mdbx_env_wait_durable()
+ * \see mdbx_env_set_durable_notify()
+ *
+ * \details The function acts like \ref mdbx_txn_commit_ex(), but the meta-page is written weakly (as with
+ * \ref MDBX_TXN_NOSYNC) and the write lock is released right after the pages were written. Then the transaction is
+ * made durable by an internal background thread of the environment (the flusher), which is started by the first call
+ * of this function. The flusher upgrades to steady the most recent meta-page by a single sync, i.e. a sequence of
+ * asynchronous commits is coalesced, and reports the steady transaction ID by the callback set by
+ * \ref mdbx_env_set_durable_notify().
+ *
+ * The durability of a particular transaction also could be checked or awaited by \ref mdbx_env_wait_durable() with
+ * the transaction ID obtained via the committed_txnid argument.
+ *
+ * \note The flusher is stopped by \ref mdbx_env_close_ex() after all pending transactions were made durable,
+ * but it is not inherited by a child process after `fork()`.
+ *
+ * \param [in] txn                 A top-level write transaction handle returned by \ref mdbx_txn_begin().
+ * \param [out] latency            An optional pointer for getting information of latencies during the commit stages.
+ * \param [out] committed_txnid    An optional pointer to get the ID of committed transaction.
+ *
+ * \returns A non-zero error value on failure and 0 on success, including the errors described for
+ *          \ref mdbx_txn_commit_ex(), and:
+ * \retval MDBX_EINVAL  The transaction is not a top-level write transaction. */
+LIBMDBX_API int mdbx_txn_commit_async(MDBX_txn *txn, MDBX_commit_latency *latency, uint64_t *committed_txnid);
+
+/** \brief Checks or waits for a transaction to become durable.
+ * \ingroup c_transactions
+ * \see mdbx_txn_commit_async()
+ *
+ * \details In the blocking mode the sync is performed if required, so the function could be used as a "future" for
+ * transactions committed by \ref mdbx_txn_commit_async() or in the \ref MDBX_SAFE_NOSYNC mode. Concurrent calls are
+ * coalesced the same way as in the \ref MDBX_opt_group_commit mode.
+ *
+ * \param [in] env       An environment handle returned by \ref mdbx_env_create().
+ * \param [in] txnid     The ID of transaction to check or wait for.
+ * \param [in] nonblock  Don't wait and just check the durability.
+ *
+ * \returns A non-zero error value on failure and 0 on success, some possible errors are:
+ * \retval MDBX_RESULT_TRUE  The transaction is not durable yet, and the nonblock was true.
+ * \retval MDBX_BUSY         The current thread holds the write lock, therefore the waiting will lead to a deadlock.
+ * \retval MDBX_EACCESS      The environment is read-only. */
+LIBMDBX_API int mdbx_env_wait_durable(MDBX_env *env, uint64_t txnid, bool nonblock);
+
 /** \brief Commits all the operations of the transaction and immediately starts next without releasing any locks.
  * \ingroup c_transactions
  *
@@ -5231,6 +5792,43 @@ LIBMDBX_API int mdbx_get_ex(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, MD
  * \retval MDBX_EINVAL        An invalid parameter was specified. */
 LIBMDBX_API int mdbx_get_equal_or_great(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, MDBX_val *data);
 
+/** \brief Get items from a table for a batch of keys.
+ * \ingroup c_crud
+ *
+ * Briefly this function does the same as \ref mdbx_get() for each of given
+ * keys, but reuses an internal cursor between the keys. So for a next key the
+ * search doesn't restart from the root of b-tree, but only climbs up as far
+ * as the lowest common ancestor page of the previous and the next keys.
+ * Thus the keys should be sorted or nearly sorted in the order of the table
+ * to get the best performance, otherwise the cost is close to a sequence
+ * of \ref mdbx_get() calls.
+ *
+ * \note Same as for \ref mdbx_get(), the returned values are owned by the
+ * table and are valid only until a subsequent update operation, or the end
+ * of the transaction.
+ *
+ * \param [in] txn        A transaction handle returned by \ref mdbx_txn_begin().
+ * \param [in] dbi        A table handle returned by \ref mdbx_dbi_open().
+ * \param [in] keys       The array of keys to search for in the table.
+ * \param [in] count      The number of items in the keys array.
+ * \param [out] values    The array of `count` items to return the data
+ *                        corresponding to the keys. For absent keys the items
+ *                        will be set to `{nullptr, 0}`.
+ * \param [out] statuses  The optional array of `count` items to return
+ *                        \ref MDBX_SUCCESS or \ref MDBX_NOTFOUND for each key.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_THREAD_MISMATCH  Given transaction is not owned
+ *                               by current thread.
+ * \retval MDBX_NOTFOUND  At least one of the keys was not in the table,
+ *                        but all the keys were processed.
+ * \retval MDBX_BAD_VALSIZE  The length of a key is inappropriate for the
+ *                           table, the processing stops on such key.
+ * \retval MDBX_EINVAL    An invalid parameter was specified. */
+LIBMDBX_API int mdbx_get_many(const MDBX_txn *txn, MDBX_dbi dbi, const MDBX_val *keys, size_t count,
+                              MDBX_val *values, int *statuses);
+
 /** \brief Lightweight transparent cache entry structure used by \ref mdbx_cache_get().
  * \ingroup c_crud
  *
@@ -5241,7 +5839,8 @@ LIBMDBX_API int mdbx_get_equal_or_great(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_
  * which is no slower than a usual key search in the worst case, and at best, only a few lightweight checks will be do.
  *
  * \note The cache structure allows it to be placed in shared memory and used by multiple processes.
- * However, such interaction and management are not provided by libmdbx in any way yet now.
+ * The library-managed cache of such entries for a whole table is provided by \ref mdbx_hcache_open()
+ * and \ref mdbx_hcache_get().
  *
  * \note An each cache entry must be initialized by \ref mdbx_cache_init() before first use. */
 typedef struct MDBX_cache_entry {
@@ -5405,6 +6004,99 @@ LIBMDBX_API MDBX_cache_result_t mdbx_cache_get(const MDBX_txn *txn, MDBX_dbi dbi
 LIBMDBX_API MDBX_cache_result_t mdbx_cache_get_SingleThreaded(const MDBX_txn *txn, MDBX_dbi dbi, const MDBX_val *key,
                                                               MDBX_val *data, MDBX_cache_entry_t *entry);
 
+/** \brief Opaque structure for a hot-key cache of a table.
+ * \ingroup c_crud
+ * \see mdbx_hcache_open()
+ * \see mdbx_hcache_get()
+ * \see mdbx_hcache_close() */
+typedef struct MDBX_hcache MDBX_hcache;
+
+/** \brief Creates a library-managed hot-key cache for a table.
+ * \ingroup c_crud
+ * \details The cache holds the \ref MDBX_cache_entry_t records keyed by a hash of the keys,
+ * so \ref mdbx_hcache_get() provides the same early-exit validation as \ref mdbx_cache_get()
+ * without the need for the application to manage cache entries itself.
+ *
+ * The cache is a set-associative table of fixed-size slots within the given memory budget, the victim for
+ * a new key is chosen within a set by the CLOCK (second chance) policy. Lookups are lock-free and the
+ * cache could be used by any number of threads concurrently. Keys longer than about 80 bytes
+ * (depends on platform) are never cached.
+ *
+ * If a pathname is given, then the cache is placed in the corresponding file, which is created when
+ * it does not exist. This way the cache could be shared by multiple processes that work with the same
+ * database and table. The geometry of an existing cache file is preserved regardless of the given budget.
+ * The cache file is locked while the cache is open. A cache file which belongs to other database,
+ * or its stale copy, is reinitialized automatically, but only by the sole user of the cache file,
+ * i.e. while no other process has it open.
+ *
+ * \note The cache is bound to the table, not to the DBI-handle, so the same cache file could be used
+ * by processes having different DBI-handles for the same table. However, the cache must be closed
+ * before closing the corresponding DBI-handle and environment.
+ *
+ * \see mdbx_hcache_get()
+ * \see mdbx_hcache_close()
+ * \see mdbx_cache_get()
+ *
+ * \param [in] env       An environment handle returned by \ref mdbx_env_create().
+ * \param [in] dbi       A table handle returned by \ref mdbx_dbi_open().
+ * \param [in] budget    The memory budget of the cache in bytes.
+ * \param [in] pathname  The pathname of a file to place the cache for sharing between processes,
+ *                       or `NULL` for the cache in private memory of the process.
+ * \param [in] mode      The UNIX permissions to set on a created cache file.
+ * \param [out] pcache   The address where a handle of the created cache will be stored.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_INCOMPATIBLE  The existing cache file has an incompatible layout,
+ *                            or belongs to other table, or belongs to other database
+ *                            while it is used by other processes.
+ * \retval MDBX_BUSY          The cache file is used by other processes, but was not
+ *                            initialized by the first of them.
+ * \retval MDBX_EINVAL        An invalid parameter was specified. */
+LIBMDBX_API int mdbx_hcache_open(MDBX_env *env, MDBX_dbi dbi, size_t budget, const char *pathname, mdbx_mode_t mode,
+                                 MDBX_hcache **pcache);
+
+#if defined(_WIN32) || defined(_WIN64) || defined(DOXYGEN)
+/** \copydoc mdbx_hcache_open()
+ * \ingroup c_crud
+ * \note Available only on Windows.
+ * \see mdbx_hcache_open() */
+LIBMDBX_API int mdbx_hcache_openW(MDBX_env *env, MDBX_dbi dbi, size_t budget, const wchar_t *pathname,
+                                  mdbx_mode_t mode, MDBX_hcache **pcache);
+#define mdbx_hcache_openT(env, dbi, budget, pathname, mode, pcache)                                                    \
+  mdbx_hcache_openW(env, dbi, budget, pathname, mode, pcache)
+#else
+#define mdbx_hcache_openT(env, dbi, budget, pathname, mode, pcache)                                                    \
+  mdbx_hcache_open(env, dbi, budget, pathname, mode, pcache)
+#endif /* Windows */
+
+/** \brief Closes the hot-key cache and releases the resources.
+ * \ingroup c_crud
+ * \details The cache file, if any, is kept for further use by this or other processes.
+ * \see mdbx_hcache_open()
+ * \returns A non-zero error value on failure and 0 on success. */
+LIBMDBX_API int mdbx_hcache_close(MDBX_hcache *cache);
+
+/** \brief Gets items from a table using the hot-key cache.
+ * \ingroup c_crud
+ * \details Looks up the cache entry for the given key and then performs the same actions as
+ * \ref mdbx_cache_get(). On a cache miss the value is retrieved by a full search and is put
+ * into the cache, evicting a least recently used entry of the corresponding set if necessary.
+ * Keys which could not be cached are looked up bypassing the cache with \ref MDBX_CACHE_UNABLE status.
+ *
+ * \see mdbx_hcache_open()
+ * \see mdbx_cache_get()
+ *
+ * \param [in] txn        A transaction handle returned by \ref mdbx_txn_begin().
+ * \param [in] cache      A cache handle returned by \ref mdbx_hcache_open().
+ * \param [in] key        The key to search for in the table.
+ * \param [out] data      The data corresponding to the key.
+ *
+ * \returns The \ref MDBX_cache_result_t with a pair of the error codes for getting a data
+ * and the cache entry processing both. */
+LIBMDBX_API MDBX_cache_result_t mdbx_hcache_get(const MDBX_txn *txn, MDBX_hcache *cache, const MDBX_val *key,
+                                                MDBX_val *data);
+
 /** \brief Store items into a table.
  * \ingroup c_crud
  *
@@ -5596,6 +6288,61 @@ LIBMDBX_API int mdbx_replace_ex(MDBX_txn *txn, MDBX_dbi dbi, const MDBX_val *key
                                 MDBX_val *old_data, MDBX_put_flags_t flags, MDBX_preserve_func preserver,
                                 void *preserver_context);
 
+/** \brief The type of source callback functions used by \ref mdbx_table_bulk_load()
+ * to obtain the key-value pairs to be loaded.
+ * \ingroup c_crud
+ *
+ * \param [in,out] context  A pointer to the context as passed to \ref mdbx_table_bulk_load().
+ * \param [out] key         The address of an \ref MDBX_val to be filled with the next key.
+ * \param [out] value       The address of an \ref MDBX_val to be filled with the next value.
+ *
+ * The key and value must stay valid only until the next call of the function.
+ *
+ * \returns \ref MDBX_SUCCESS if the next key-value pair is provided, \ref MDBX_NOTFOUND at the end of data,
+ * otherwise the loading is stopped and the returned value becomes the result of \ref mdbx_table_bulk_load().
+ *
+ * \see mdbx_table_bulk_load() */
+typedef int (*MDBX_bulk_load_func)(void *context, MDBX_val *key, MDBX_val *value) MDBX_CXX17_NOEXCEPT;
+
+/** \brief Loads a sorted sequence of key-value pairs into a table by building the B-tree bottom-up.
+ * \ingroup c_crud
+ *
+ * \details For an empty table without \ref MDBX_DUPSORT the function fills leaf pages sequentially up to
+ * the given fill factor and builds the branch levels bottom-up, while adding each next page into the rightmost
+ * branch page of the upper level. So there is neither a search, nor a page split nor moving nodes for each item,
+ * but only the comparison with the previous key and the copying. The built pages are ordinary dirty pages of
+ * the transaction, therefore they are spilled as needed and written out by the commit as usual.
+ *
+ * For a non-empty table or a table with \ref MDBX_DUPSORT the pairs are put one by one in the same way
+ * as \ref mdbx_put() with \ref MDBX_APPEND and \ref MDBX_APPENDDUP does, and the fill factor is ignored.
+ *
+ * \note The keys must be unique and be provided in the ascending order according to the table's comparator,
+ * otherwise the loading is stopped with \ref MDBX_EKEYMISMATCH. In case the loading is stopped by an error
+ * or by the source callback, the pairs loaded before remain in the table, unless the transaction becomes
+ * unusable due to an internal error. The existing pairs of a non-empty table are never skipped, i.e. the last
+ * existing key is overwritten and an attempt to put a pair before it stops the loading with \ref MDBX_EKEYMISMATCH,
+ * so to merge with the existing data the pairs should be put one by one by \ref mdbx_put() instead.
+ *
+ * \param [in] txn           A transaction handle returned by \ref mdbx_txn_begin().
+ * \param [in] dbi           A table handle returned by \ref mdbx_dbi_open().
+ * \param [in] source        A function providing the key-value pairs, see \ref MDBX_bulk_load_func.
+ * \param [in,out] context   A pointer to the context passed to the source function.
+ * \param [in] fill_percent  The desired filling of leaf pages in percent between 50 and 100,
+ *                           or 0 for fully filled pages.
+ *
+ * \see \ref c_crud_hints "Quick reference for Insert/Update/Delete operations"
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_EKEYMISMATCH  The keys are not in the ascending order.
+ * \retval MDBX_BAD_VALSIZE   The size of a key or a value is invalid for the table.
+ * \retval MDBX_MAP_FULL      The database is full, see \ref mdbx_env_set_mapsize().
+ * \retval MDBX_EACCES        An attempt was made to write in a read-only transaction.
+ * \retval MDBX_EINVAL        An invalid parameter was specified.
+ * \retval OTHERWISE any other value is an error code or a user-defined code returned by the source function. */
+LIBMDBX_API int mdbx_table_bulk_load(MDBX_txn *txn, MDBX_dbi dbi, MDBX_bulk_load_func source, void *context,
+                                     unsigned fill_percent);
+
 /** \brief Delete items from a table.
  * \ingroup c_crud
  *
@@ -6136,17 +6883,102 @@ LIBMDBX_API int mdbx_cursor_scan_from(MDBX_cursor *cursor, MDBX_predicate_func p
                                       MDBX_cursor_op from_op, MDBX_val *from_key, MDBX_val *from_value,
                                       MDBX_cursor_op turn_op, void *arg);
 
-/** \brief Retrieve multiple non-dupsort key/value pairs by cursor.
+/** \brief The type of reducing callback functions used by \ref mdbx_cursor_scan_parallel()
+ * to combine the results of worker threads.
+ * \ingroup c_crud
+ *
+ * \param [in,out] context  The same pointer to the context as passed to the predicative function.
+ * \param [in,out] arg      The auxiliary argument of the worker, i.e. the corresponding element of the `args` array
+ *                          passed to \ref mdbx_cursor_scan_parallel(), or NULL.
+ * \param [in] scan_result  The result of scanning the worker's sub-range, i.e. \ref MDBX_RESULT_FALSE,
+ *                          \ref MDBX_RESULT_TRUE or an error code.
+ *
+ * \returns \ref MDBX_RESULT_FALSE to continue reducing with the next worker, otherwise the reducing is stopped
+ * and the returned value becomes the result of \ref mdbx_cursor_scan_parallel().
+ *
+ * \see mdbx_cursor_scan_parallel() */
+typedef int (*MDBX_reduce_func)(void *context, void *arg, int scan_result) MDBX_CXX17_NOEXCEPT;
+
+/** \brief Scans a range of a table in parallel by multiple threads using the given predicate.
  * \ingroup c_crud
  *
- * This function retrieves multiple key/data pairs from the table without
- * \ref MDBX_DUPSORT option. For `MDBX_DUPSORT` tables please
- * use \ref MDBX_GET_MULTIPLE and \ref MDBX_NEXT_MULTIPLE.
+ * \details The function splits the range `[from_key, to_key)` into up to `workers` adjacent sub-ranges by using
+ * \ref mdbx_cursor_distribute() at the granularity of leaf pages, so no leaf pages are read for splitting.
+ * Each sub-range is scanned by a separate thread within a read-only clone of the cursor's transaction,
+ * see \ref mdbx_txn_clone(), while the first sub-range is scanned by the calling thread itself within
+ * the cursor's transaction. Each key-value pair is probed by the `predicate` in the same way as
+ * \ref mdbx_cursor_scan() does, with the elements of the `args` array passed as the auxiliary argument
+ * of the corresponding workers. Once any predicate returns a value other than \ref MDBX_RESULT_FALSE,
+ * all workers stop scanning as soon as possible.
+ *
+ * After all workers have finished, the results are combined in the order of the sub-ranges by calling
+ * the `reducer` for each worker, including ones which got an empty sub-range. The reducing stops
+ * at the first value other than \ref MDBX_RESULT_FALSE, which becomes the result of the function.
+ * Without the `reducer` the first scan result other than \ref MDBX_RESULT_FALSE is returned.
+ *
+ * \note The predicate is called concurrently from several threads, so the shared `context` must be
+ * accessed accordingly, while per-worker data should be placed into the `args`.
+ * Sub-ranges are bounded by keys, therefore all multi-values of a key in \ref MDBX_DUPSORT tables
+ * are always scanned by a single worker. For \ref MDBX_DUPFIXED tables the values are passed to
+ * the predicate one by one.
+ *
+ * \param [in] cursor        The cursor, which specifies the read-only transaction and the table to be scanned.
+ *                           The position of the cursor is neither used nor changed.
+ * \param [in] from_key      The key to start the scan from (inclusively) or NULL to start from the begin of a table.
+ * \param [in] to_key        The key to stop the scan at (exclusively) or NULL to scan to the end of a table.
+ * \param [in] predicate     A predicative function for probing key-value pairs,
+ *                           see \ref MDBX_predicate_func for more details.
+ * \param [in,out] context   A pointer to the context shared by all workers.
+ * \param [in] args          An array of `workers` auxiliary arguments for the workers, or NULL.
+ * \param [in] workers       The maximal number of workers, including the calling thread.
+ * \param [in] reducer       A function for combining the results of workers, or NULL,
+ *                           see \ref MDBX_reduce_func for more details.
+ *
+ * \see MDBX_predicate_func
+ * \see MDBX_reduce_func
+ * \see mdbx_cursor_scan
+ * \see mdbx_cursor_distribute
+ *
+ * \returns The result of the reducing, or an error code.
+ *
+ * \retval MDBX_RESULT_FALSE if all predicates and the reducer returned \ref MDBX_RESULT_FALSE,
+ *                           i.e. the whole range has been scanned.
+ * \retval MDBX_RESULT_TRUE  if a predicate or the reducer returned \ref MDBX_RESULT_TRUE.
+ * \retval MDBX_EINVAL       An invalid parameter was specified.
+ * \retval MDBX_BAD_TXN      The cursor's transaction is a write one, since the workers would scan
+ *                           the read-only clones of it, which don't see uncommitted changes.
+ * \retval OTHERWISE any other value is an error code or a user-defined code returned by a predicate
+ *         or the reducer. */
+LIBMDBX_API int mdbx_cursor_scan_parallel(const MDBX_cursor *cursor, const MDBX_val *from_key, const MDBX_val *to_key,
+                                          MDBX_predicate_func predicate, void *context, void *const *args,
+                                          size_t workers, MDBX_reduce_func reducer);
+
+/** \brief Retrieve multiple key/value pairs by cursor.
+ * \ingroup c_crud
+ *
+ * This function retrieves multiple key/data pairs from the table, starting
+ * from the current cursor position (or from the first/last one for
+ * \ref MDBX_FIRST and \ref MDBX_LAST if the cursor is not positioned yet)
+ * and moving forward for \ref MDBX_FIRST and \ref MDBX_NEXT or backward for
+ * \ref MDBX_LAST and \ref MDBX_PREV. On success the cursor is left at the
+ * first pair which was not returned, so the next call with \ref MDBX_NEXT or
+ * \ref MDBX_PREV continues the scan. Once the scan in the backward direction
+ * has passed the first pair the cursor becomes unset, so the subsequent
+ * \ref MDBX_PREV call returns \ref MDBX_NOTFOUND.
+ *
+ * For \ref MDBX_DUPSORT tables a separate pair is returned for each
+ * multi-value with the key repeated. For tables with
+ * \ref MDBX_DUPSORT and \ref MDBX_DUPFIXED options the multi-values of a key
+ * are returned in chunks by a whole page, i.e. the returned value then holds
+ * one or more contiguous fixed-size items as with \ref MDBX_GET_MULTIPLE.
+ * The items within such chunk are always in ascending order regardless of
+ * the scan direction.
  *
  * The number of key and value items is returned in the `count`
  * refers. The addresses and lengths of the keys and values are returned in the
  * array to which `pairs` refers.
  * \see mdbx_cursor_get()
+ * \see mdbx_cursor_get_batch_ex()
  *
  * \note The memory pointed to by the returned values is owned by the
  * database. The caller MUST not dispose of the memory, and MUST not modify it
@@ -6166,7 +6998,8 @@ LIBMDBX_API int mdbx_cursor_scan_from(MDBX_cursor *cursor, MDBX_predicate_func p
  * \param [in] limit      The size of pairs buffer as the number of items,
  *                        but not a pairs.
  * \param [in] op         A cursor operation \ref MDBX_cursor_op (only
- *                        \ref MDBX_FIRST and \ref MDBX_NEXT are supported).
+ *                        \ref MDBX_FIRST, \ref MDBX_NEXT, \ref MDBX_LAST
+ *                        and \ref MDBX_PREV are supported).
  *
  * \returns A non-zero error value on failure and 0 on success,
  *          some possible errors are:
@@ -6180,6 +7013,36 @@ LIBMDBX_API int mdbx_cursor_scan_from(MDBX_cursor *cursor, MDBX_predicate_func p
 LIBMDBX_API int mdbx_cursor_get_batch(MDBX_cursor *cursor, size_t *count, MDBX_val *pairs, size_t limit,
                                       MDBX_cursor_op op);
 
+/** \brief Retrieve multiple key/value pairs by cursor up to the stop key.
+ * \ingroup c_crud
+ *
+ * The same as \ref mdbx_cursor_get_batch(), but the scan stops before the
+ * first key which reaches the given `stop_key` in the scan direction, i.e.
+ * which is greater than or equal to `stop_key` for \ref MDBX_FIRST and
+ * \ref MDBX_NEXT, or less than or equal to `stop_key` for \ref MDBX_LAST
+ * and \ref MDBX_PREV. So the `stop_key` is an exclusive bound of the range.
+ * Keys are compared by the table's comparator, and the comparison is skipped
+ * for the leaf pages which entirely precede the bound.
+ *
+ * When the bound is reached \ref MDBX_RESULT_TRUE is returned and the cursor
+ * is left at the first pair beyond the bound.
+ *
+ * \param [in] cursor     A cursor handle returned by \ref mdbx_cursor_open().
+ * \param [out] count     The number of key and value item returned.
+ * \param [in,out] pairs  A pointer to the array of key value pairs.
+ * \param [in] limit      The size of pairs buffer as the number of items,
+ *                        but not a pairs.
+ * \param [in] op         A cursor operation \ref MDBX_cursor_op (only
+ *                        \ref MDBX_FIRST, \ref MDBX_NEXT, \ref MDBX_LAST
+ *                        and \ref MDBX_PREV are supported).
+ * \param [in] stop_key   The exclusive bound of the range, or `NULL`
+ *                        for the scan until the end of data.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          the same as for \ref mdbx_cursor_get_batch(). */
+LIBMDBX_API int mdbx_cursor_get_batch_ex(MDBX_cursor *cursor, size_t *count, MDBX_val *pairs, size_t limit,
+                                         MDBX_cursor_op op, const MDBX_val *stop_key);
+
 /** \brief Store by cursor.
  * \ingroup c_crud
  *
@@ -7265,6 +8128,10 @@ typedef struct MDBX_chk_context {
      * information about all key-value tables, including `MainDB` and `GC`. */
     const MDBX_chk_table_t *const *tables;
   } result;
+  /** The number of threads to walk the b-trees in parallel, which should be set before calling
+   * \ref mdbx_env_chk(). Zero or one means walking by the calling thread only.
+   * \note This field is placed last to keep the layout of the preceding ones. */
+  unsigned walk_threads;
 } MDBX_chk_context_t;
 
 /** \brief A set of callback functions used for checking the integrity of a database.
@@ -7320,6 +8187,10 @@ typedef struct MDBX_chk_callbacks {
  * details, see \ref MDBX_chk_stage_t. The application code is notified about the beginning and end of each stage
  * through the corresponding callback functions. For more details, see \ref MDBX_chk_callbacks_t.
  *
+ * The b-trees could be walked page-by-page in parallel by a pool of threads, as requested by the `walk_threads` field
+ * of the context. In this case the callback functions are called from these threads during the walking, but never
+ * concurrently, and the order of pages and tables processing is undefined.
+ *
  * \param [in] env        A pointer to an instance of environment.
  * \param [in] cb         A set of callback functions.
  * \param [in,out] ctx    The context of a database integrity check, where the results of the check will be generated.
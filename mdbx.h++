@@ -76,6 +76,7 @@
 #include <climits>     // for CHAR_BIT
 #include <cstring>     // for std::strlen, str:memcmp
 #include <exception>   // for std::exception_ptr
+#include <iterator>    // for std::input_iterator_tag
 #include <ostream>     // for std::ostream
 #include <sstream>     // for std::ostringstream
 #include <stdexcept>   // for std::invalid_argument
@@ -278,6 +279,21 @@
 #endif
 #endif /* MDBX_ASSERT_CXX20_CONCEPT_SATISFIED */
 
+#ifndef MDBX_HAVE_CXX20_COROUTINES
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__cpp_lib_coroutine) &&               \
+    __cpp_lib_coroutine >= 201902L && defined(__cpp_lib_jthread) && __cpp_lib_jthread >= 201911L
+#include <coroutine>
+#include <functional>
+#include <stop_token>
+#include <thread>
+#define MDBX_HAVE_CXX20_COROUTINES 1
+#elif defined(DOXYGEN)
+#define MDBX_HAVE_CXX20_COROUTINES 1
+#else
+#define MDBX_HAVE_CXX20_COROUTINES 0
+#endif /* <coroutine> && <stop_token> */
+#endif /* MDBX_HAVE_CXX20_COROUTINES */
+
 #ifdef _MSC_VER
 #pragma warning(push, 4)
 #pragma warning(disable : 4127) /* conditional expression is constant */
@@ -393,6 +409,7 @@ class txn;
 class txn_managed;
 class cursor;
 class cursor_managed;
+class pair_range;
 
 /// \brief Transaction ID and MVCC-snapshot number.
 using txnid = uint64_t;
@@ -2957,6 +2974,64 @@ enum put_mode {
   update = MDBX_CURRENT,            ///< Update existing, don't insert new.
 };
 
+#if MDBX_HAVE_CXX20_COROUTINES || defined(DOXYGEN)
+
+/// \brief Executor for asynchronous operations, which should run the given job somewhere, e.g. by a thread pool
+/// or an event loop's worker.
+/// \details An empty executor means running each job by a new detached thread.
+using async_executor = ::std::function<void(::std::function<void()> job)>;
+
+/// \brief Awaitable of an asynchronous long-running operation for C++20 coroutines.
+///
+/// The operation is started by the `co_await` on the given executor, and the awaiting coroutine is resumed by the
+/// executor's thread once the operation is completed. Exceptions are captured and rethrown from the `co_await`.
+/// Without awaiting the operation could be performed synchronously by \ref get().
+///
+/// The cancellation by a `std::stop_token` is not an error, i.e. it never throws, but is reported by the result of
+/// the operation. The token is always checked before the start of an operation, so a cancelled operation is not
+/// started at all, and then some operations also check it while in progress.
+template <typename RESULT> class async_operation {
+  ::std::function<RESULT()> job_;
+  async_executor executor_;
+  RESULT result_{};
+  ::std::exception_ptr captured_;
+
+public:
+  async_operation(::std::function<RESULT()> job, async_executor executor)
+      : job_(::std::move(job)), executor_(::std::move(executor)) {}
+  async_operation(async_operation &&) = default;
+  async_operation(const async_operation &) = delete;
+  async_operation &operator=(const async_operation &) = delete;
+
+  /// \brief Performs the operation synchronously by the calling thread.
+  RESULT get() { return job_(); }
+
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(::std::coroutine_handle<> awaiting) {
+    auto job = [this, awaiting]() noexcept {
+      try {
+        result_ = job_();
+      } catch (... /* capture any exception to rethrow it within the awaiting coroutine */) {
+        captured_ = ::std::current_exception();
+      }
+      awaiting.resume();
+    };
+    /* the awaitable may be destroyed by the resumed coroutine before the executor returns */
+    async_executor executor = ::std::move(executor_);
+    if (executor)
+      executor(::std::move(job));
+    else
+      ::std::thread(::std::move(job)).detach();
+  }
+  RESULT await_resume() {
+    if (MDBX_UNLIKELY(captured_))
+      MDBX_CXX20_UNLIKELY ::std::rethrow_exception(captured_);
+    return ::std::move(result_);
+  }
+};
+
+#endif /* MDBX_HAVE_CXX20_COROUTINES */
+
 /// \brief Unmanaged database environment.
 ///
 /// Like other unmanaged classes, `env` allows copying and assignment for handles as a values,
@@ -3277,6 +3352,49 @@ public:
   /// \brief Copy an environment to the specified file descriptor.
   env &copy(filehandle fd, bool compactify, bool force_dynamic_size = false);
 
+#if MDBX_HAVE_CXX20_COROUTINES || defined(DOXYGEN)
+  /// \brief Asynchronously makes a copy (backup) of an existing environment to the specified path.
+  /// \details The copying itself is not interruptible, so the `stop` token is checked only before the start.
+  /// \returns `True` when the copy is made or `false` if cancelled before the start.
+  inline async_operation<bool> copy_async(::std::string destination, bool compactify, bool force_dynamic_size = false,
+                                          ::std::stop_token stop = {}, async_executor executor = {});
+
+  /// \brief Asynchronously copies an environment to the specified file descriptor.
+  /// \copydetails copy_async(::std::string, bool, bool, ::std::stop_token, async_executor)
+  inline async_operation<bool> copy_async(filehandle fd, bool compactify, bool force_dynamic_size = false,
+                                          ::std::stop_token stop = {}, async_executor executor = {});
+
+  /// \brief Asynchronously warms up the database, see \ref mdbx_env_warmup_ex().
+  /// \details Besides the start, the `progress` callback and the `stop` token are checked only during explicitly
+  /// peeking the database pages, i.e. with \ref MDBX_warmup_force, \ref MDBX_warmup_btree or
+  /// \ref MDBX_warmup_hotmap options.
+  /// \returns `True` when the warming up is completed or `false` if it was stopped by the timeout or cancelled.
+  inline async_operation<bool> warmup_async(MDBX_warmup_flags_t flags, const duration &timeout = duration(0),
+                                            MDBX_warmup_notify_func progress = nullptr, void *ctx = nullptr,
+                                            ::std::stop_token stop = {}, async_executor executor = {});
+
+  /// \brief Asynchronously defragments the database, see \ref mdbx_env_defrag().
+  /// \details The cancellation by the `stop` token discontinues the defragmentation with completion of the already
+  /// scheduled operations, i.e. the same as returning `1` from the `progress` callback.
+  /// \returns The result of defragmentation, including the reasons of its stopping. If cancelled before the start,
+  /// then the result is zeroed except for the \ref MDBX_defrag_discontinued in the `stopping_reasons`.
+  inline async_operation<MDBX_defrag_result_t>
+  defrag_async(size_t defrag_atleast, const duration &time_atleast, size_t defrag_enough, const duration &time_limit,
+               intptr_t acceptable_backlash = -1, intptr_t preferred_batch = 0,
+               MDBX_defrag_notify_func progress = nullptr, void *ctx = nullptr, ::std::stop_token stop = {},
+               async_executor executor = {});
+
+  /// \brief Asynchronously checks the integrity of the database, see \ref mdbx_env_chk().
+  /// \details The `stop` token is checked only before the start, since the callbacks do not provide a way to reach it,
+  /// so the check in progress should be interrupted by the `check_break` callback of \ref MDBX_chk_callbacks_t.
+  /// \returns `True` if no problems were found, or `false` if some problems were found or if cancelled before the
+  /// start. The latter could be distinguished by the `stop.stop_requested()`, and then the `ctx` is left untouched.
+  inline async_operation<bool> chk_async(const MDBX_chk_callbacks_t *cb, MDBX_chk_context_t *ctx,
+                                         MDBX_chk_flags_t flags, MDBX_chk_severity_t verbosity,
+                                         const duration &timeout = duration(0), ::std::stop_token stop = {},
+                                         async_executor executor = {});
+#endif /* MDBX_HAVE_CXX20_COROUTINES */
+
   /// \brief Deletion modes for \ref remove().
   enum remove_mode {
     /// \brief Just delete the environment's files and directory if any.
@@ -3480,7 +3598,23 @@ public:
     /// \copydoc MDBX_opt_subpage_reserve_limit
     subpage_reserve_limit = MDBX_opt_subpage_reserve_limit,
     /// \copydoc MDBX_opt_split_reserve
-    split_reserve = MDBX_opt_split_reserve
+    split_reserve = MDBX_opt_split_reserve,
+    /// \copydoc MDBX_opt_page_checksum
+    page_checksum = MDBX_opt_page_checksum,
+    /// \copydoc MDBX_opt_group_commit
+    group_commit = MDBX_opt_group_commit,
+    /// \copydoc MDBX_opt_defrag_auto_threshold
+    defrag_auto_threshold = MDBX_opt_defrag_auto_threshold,
+    /// \copydoc MDBX_opt_defrag_auto_batch
+    defrag_auto_batch = MDBX_opt_defrag_auto_batch,
+    /// \copydoc MDBX_opt_defrag_auto_time_limit
+    defrag_auto_time_limit = MDBX_opt_defrag_auto_time_limit,
+    /// \copydoc MDBX_opt_gc_adaptive
+    gc_adaptive = MDBX_opt_gc_adaptive,
+    /// \copydoc MDBX_opt_spill_policy
+    spill_policy = MDBX_opt_spill_policy,
+    /// \copydoc MDBX_opt_hotmap_interval
+    hotmap_interval = MDBX_opt_hotmap_interval
   };
 
   /// \copybrief mdbx_env_set_option()
@@ -3505,6 +3639,11 @@ public:
   /// environment is busy by other thread or none of the thresholds are reached.
   bool poll_sync_to_disk() { return sync_to_disk(false, true); }
 
+  /// \brief Checks or waits for a transaction to become durable.
+  /// \return `True` if the transaction is durable, or `false` if it is not durable yet and the nonblock was true.
+  /// \see ::mdbx_env_wait_durable()
+  inline bool wait_durable(uint64_t txnid, bool nonblock = false);
+
   /// \brief Close a key-value map (aka table) handle. Normally
   /// unnecessary.
   ///
@@ -3788,6 +3927,11 @@ public:
   /// \brief Opens cursor for specified key-value map handle.
   inline cursor_managed open_cursor(map_handle map) const;
 
+  /// \brief Returns the single-pass range of key-value pairs within `[from, to)` keys interval of the map.
+  /// \see pair_range
+  inline pair_range range(map_handle map, const slice &from = slice::invalid(), const slice &to = slice::invalid(),
+                          bool backward = false) const;
+
   /// \brief Unbind or close all cursors.
   inline size_t release_all_cursors(bool unbind) const;
 
@@ -3952,6 +4096,17 @@ public:
   /// \return Bundle of key-value pair and boolean flag,
   /// which will be `true` if the exact key was found and `false` otherwise.
   inline pair_result get_equal_or_great(map_handle map, const slice &key, const slice &value_at_absence) const;
+  /// \brief Get values for a batch of keys from a key-value map (aka table).
+  /// \details The keys should be sorted or nearly sorted in the order of the table for the best performance,
+  /// see \ref mdbx_get_many() for details. Values for absent keys are set to the `value_at_absence`.
+  /// \return The number of found keys.
+  inline size_t get_many(map_handle map, const slice *keys, size_t count, slice *values,
+                         const slice &value_at_absence = slice()) const;
+  /// \brief Get values for a batch of keys from a key-value map (aka table).
+  /// \details The keys should be sorted or nearly sorted in the order of the table for the best performance,
+  /// see \ref mdbx_get_many() for details. Values for absent keys are set to the `value_at_absence`.
+  inline ::std::vector<slice> get_many(map_handle map, const ::std::vector<slice> &keys,
+                                       const slice &value_at_absence = slice()) const;
 
   inline MDBX_error_t put(map_handle map, const slice &key, slice *value, MDBX_put_flags_t flags) noexcept;
   inline void put(map_handle map, const slice &key, slice value, put_mode mode);
@@ -4107,6 +4262,11 @@ public:
     return result;
   }
 
+  /// \brief Commits all changes of the transaction without waiting for the durability.
+  /// \returns ID of the committed transaction, which could be awaited by \ref env::wait_durable().
+  /// \see ::mdbx_txn_commit_async()
+  uint64_t commit_async(finalization_latency *latency = nullptr);
+
   /// \brief Commits all the operations of the transaction and immediately starts next without releasing any locks.
   bool checkpoint();
   /// \brief Commits all the operations of the transaction and immediately starts next without releasing any locks.
@@ -4505,6 +4665,12 @@ public:
   static inline bool distribute(const cursor from, const cursor to, const std::vector<cursor_managed> &cursors,
                                 unsigned deepness = /* enough to cover whole tree height */ 42);
 
+  /// \brief Returns the single-pass range of key-value pairs within `[from, to)` keys interval,
+  /// which repositions the cursor during the iteration.
+  /// \see pair_range
+  inline pair_range range(const slice &from = slice::invalid(), const slice &to = slice::invalid(),
+                          bool backward = false);
+
   //----------------------------------------------------------------------------
 
   /// \brief Renew/bind a cursor with a new transaction and previously used key-value map handle.
@@ -4623,6 +4789,85 @@ public:
   ~cursor_managed() noexcept { ::mdbx_cursor_close(handle_); }
 };
 
+/// \brief Single-pass range of key-value pairs within the given keys interval.
+///
+/// The pairs are fetched in chunks at leaf-page granularity through \ref mdbx_cursor_get_batch_ex(),
+/// so the iteration costs one call into the library per chunk rather than per pair and makes no allocations,
+/// except a copy of the boundary key if it is too long to fit inline into a `std::string`.
+/// The range models the `std::ranges::input_range` concept, so it can be used both in range-based `for` loops
+/// and with the `std::ranges` algorithms. The iterators are single-pass and share the state of the range,
+/// therefore the range must outlive its iterators and must not be moved during iteration.
+///
+/// For maps with multi-values a separate pair is produced for each value. The slices refer to the database
+/// pages and remain valid until the end of a read-only transaction or the next change within
+/// a read-write transaction. The `from` and `to` keys are only required to be valid during construction.
+class LIBMDBX_API_TYPE pair_range {
+public:
+  /// \brief Capacity of the internal chunk buffer in `MDBX_val` items, i.e. twice the pairs per chunk.
+  static constexpr size_t batch_capacity = 128;
+
+  class iterator {
+    friend class pair_range;
+    pair_range *range_{nullptr};
+    MDBX_CXX11_CONSTEXPR iterator(pair_range *range) noexcept : range_(range) {}
+    bool at_end() const noexcept { return !range_ || range_->done_; }
+
+  public:
+    using iterator_category = ::std::input_iterator_tag;
+    using value_type = pair;
+    using difference_type = ptrdiff_t;
+    using pointer = const pair *;
+    using reference = const pair &;
+
+    MDBX_CXX11_CONSTEXPR iterator() noexcept = default;
+    reference operator*() const noexcept { return range_->current_; }
+    pointer operator->() const noexcept { return &range_->current_; }
+    iterator &operator++() {
+      range_->advance();
+      return *this;
+    }
+    void operator++(int) { range_->advance(); }
+    friend bool operator==(const iterator &a, const iterator &b) noexcept {
+      return a.at_end() ? b.at_end() : !b.at_end() && a.range_ == b.range_;
+    }
+    friend bool operator!=(const iterator &a, const iterator &b) noexcept { return !(a == b); }
+  };
+
+  /// \brief Creates the range over `[from, to)` keys interval of the map using an own cursor.
+  /// \details An invalid slice for `from` or `to` means the begin or the end of the map correspondingly.
+  /// With `backward = true` the same interval is iterated in the descending order.
+  inline pair_range(const ::mdbx::txn &txn, map_handle map, const slice &from = slice::invalid(),
+                    const slice &to = slice::invalid(), bool backward = false);
+  /// \brief Creates the range over `[from, to)` keys interval using the given cursor,
+  /// which is repositioned during the iteration.
+  inline pair_range(cursor &cursor, const slice &from = slice::invalid(), const slice &to = slice::invalid(),
+                    bool backward = false);
+  inline pair_range(pair_range &&other) noexcept;
+  pair_range(const pair_range &) = delete;
+  pair_range &operator=(const pair_range &) = delete;
+  ~pair_range() noexcept { ::mdbx_cursor_close(owned_); }
+
+  iterator begin() noexcept { return iterator(this); }
+  iterator end() noexcept { return iterator(); }
+  bool empty() const noexcept { return done_; }
+
+private:
+  MDBX_cursor *owned_{nullptr};
+  MDBX_cursor *cursor_;
+  slice stop_;
+  ::std::string stop_holder_;
+  size_t fixed_{0}, count_{0}, index_{0}, offset_{0};
+  bool backward_, last_chunk_{false}, done_{false};
+  pair current_{pair::invalid()};
+  MDBX_val chunk_[batch_capacity];
+
+  inline void setup(const slice &from, const slice &to);
+  inline void hold_stop(const slice &key);
+  inline void fetch();
+  inline void settle();
+  inline void advance();
+};
+
 //==============================================================================
 //
 // Inline body of the libmdbx C++ API
@@ -5560,6 +5805,18 @@ inline env &env::set_geometry(const geometry &geo) {
   return *this;
 }
 
+inline bool env::wait_durable(uint64_t txnid, bool nonblock) {
+  const int err = ::mdbx_env_wait_durable(handle_, txnid, nonblock);
+  switch (err) {
+  case MDBX_SUCCESS /* the transaction is durable */:
+    return true;
+  case MDBX_RESULT_TRUE /* not durable yet */:
+    return false;
+  default:
+    MDBX_CXX20_UNLIKELY error::throw_exception(err);
+  }
+}
+
 inline bool env::sync_to_disk(bool force, bool nonblock) {
   const int err = ::mdbx_env_sync_ex(handle_, force, nonblock);
   switch (err) {
@@ -5649,6 +5906,103 @@ inline txn_managed env::start_write(txn &parent) {
 
 inline txn_managed env::try_start_write() { return start_write(true); }
 
+#if MDBX_HAVE_CXX20_COROUTINES
+inline async_operation<bool> env::copy_async(::std::string destination, bool compactify, bool force_dynamic_size,
+                                             ::std::stop_token stop, async_executor executor) {
+  return async_operation<bool>(
+      [self = *this, destination = ::std::move(destination), compactify, force_dynamic_size, stop]() mutable {
+        if (stop.stop_requested())
+          return false;
+        self.copy(destination, compactify, force_dynamic_size);
+        return true;
+      },
+      ::std::move(executor));
+}
+
+inline async_operation<bool> env::copy_async(filehandle fd, bool compactify, bool force_dynamic_size,
+                                             ::std::stop_token stop, async_executor executor) {
+  return async_operation<bool>(
+      [self = *this, fd, compactify, force_dynamic_size, stop]() mutable {
+        if (stop.stop_requested())
+          return false;
+        self.copy(fd, compactify, force_dynamic_size);
+        return true;
+      },
+      ::std::move(executor));
+}
+
+inline async_operation<bool> env::warmup_async(MDBX_warmup_flags_t flags, const duration &timeout,
+                                               MDBX_warmup_notify_func progress, void *ctx, ::std::stop_token stop,
+                                               async_executor executor) {
+  return async_operation<bool>(
+      [handle = handle_, flags, timeout, progress, ctx, stop]() {
+        if (stop.stop_requested())
+          return false;
+        struct notify {
+          MDBX_warmup_notify_func progress;
+          void *ctx;
+          ::std::stop_token stop;
+          static int probe(void *self, size_t done_pages, size_t total_pages) noexcept {
+            const notify *const it = static_cast<const notify *>(self);
+            const int rc = it->progress ? it->progress(it->ctx, done_pages, total_pages) : 0;
+            return rc ? rc : int(it->stop.stop_requested());
+          }
+        } thunk{progress, ctx, stop};
+        const bool need_notify = progress || stop.stop_possible();
+        return !error::boolean_or_throw(::mdbx_env_warmup_ex(handle, nullptr, flags, timeout.count(),
+                                                             need_notify ? notify::probe : nullptr,
+                                                             need_notify ? &thunk : nullptr));
+      },
+      ::std::move(executor));
+}
+
+inline async_operation<MDBX_defrag_result_t>
+env::defrag_async(size_t defrag_atleast, const duration &time_atleast, size_t defrag_enough,
+                  const duration &time_limit, intptr_t acceptable_backlash, intptr_t preferred_batch,
+                  MDBX_defrag_notify_func progress, void *ctx, ::std::stop_token stop, async_executor executor) {
+  return async_operation<MDBX_defrag_result_t>(
+      [handle = handle_, defrag_atleast, time_atleast, defrag_enough, time_limit, acceptable_backlash,
+       preferred_batch, progress, ctx, stop]() {
+        MDBX_defrag_result_t result;
+        if (stop.stop_requested()) {
+          ::std::memset(&result, 0, sizeof(result));
+          result.stopping_reasons = MDBX_defrag_discontinued;
+          return result;
+        }
+        struct notify {
+          MDBX_defrag_notify_func progress;
+          void *ctx;
+          ::std::stop_token stop;
+          static int probe(void *self, const MDBX_defrag_result_t *state) noexcept {
+            const notify *const it = static_cast<const notify *>(self);
+            const int rc = it->progress ? it->progress(it->ctx, state) : 0;
+            return rc ? rc : int(it->stop.stop_requested()) /* discontinue */;
+          }
+        } thunk{progress, ctx, stop};
+        const bool need_notify = progress || stop.stop_possible();
+        error::boolean_or_throw(::mdbx_env_defrag(handle, defrag_atleast, time_atleast.count(), defrag_enough,
+                                                  time_limit.count(), acceptable_backlash, preferred_batch,
+                                                  need_notify ? notify::probe : nullptr, need_notify ? &thunk : nullptr,
+                                                  &result));
+        return result;
+      },
+      ::std::move(executor));
+}
+
+inline async_operation<bool> env::chk_async(const MDBX_chk_callbacks_t *cb, MDBX_chk_context_t *ctx,
+                                            MDBX_chk_flags_t flags, MDBX_chk_severity_t verbosity,
+                                            const duration &timeout, ::std::stop_token stop, async_executor executor) {
+  return async_operation<bool>(
+      [handle = handle_, cb, ctx, flags, verbosity, timeout, stop]() {
+        if (stop.stop_requested())
+          return false;
+        error::boolean_or_throw(::mdbx_env_chk(handle, cb, ctx, flags, verbosity, timeout.count()));
+        return ctx->result.total_problems == 0;
+      },
+      ::std::move(executor));
+}
+#endif /* MDBX_HAVE_CXX20_COROUTINES */
+
 MDBX_CXX11_CONSTEXPR txn::txn(MDBX_txn *ptr) noexcept : handle_(ptr) {}
 
 inline txn &txn::operator=(txn &&other) noexcept {
@@ -5941,6 +6295,35 @@ inline pair_result txn::get_equal_or_great(map_handle map, const slice &key, con
   }
 }
 
+inline size_t txn::get_many(map_handle map, const slice *keys, size_t count, slice *values,
+                            const slice &value_at_absence) const {
+  static_assert(sizeof(slice) == sizeof(MDBX_val), "slice must be layout-compatible with MDBX_val");
+  const int err = ::mdbx_get_many(handle_, map.dbi, keys, count, values, nullptr);
+  switch (err) {
+  case MDBX_SUCCESS:
+    return count;
+  case MDBX_NOTFOUND: {
+    size_t found = 0;
+    for (size_t i = 0; i < count; ++i) {
+      if (values[i].iov_base)
+        ++found;
+      else
+        values[i] = value_at_absence;
+    }
+    return found;
+  }
+  default:
+    MDBX_CXX20_UNLIKELY error::throw_exception(err);
+  }
+}
+
+inline ::std::vector<slice> txn::get_many(map_handle map, const ::std::vector<slice> &keys,
+                                          const slice &value_at_absence) const {
+  ::std::vector<slice> values(keys.size());
+  get_many(map, keys.data(), keys.size(), values.data(), value_at_absence);
+  return values;
+}
+
 inline MDBX_error_t txn::put(map_handle map, const slice &key, slice *value, MDBX_put_flags_t flags) noexcept {
   return MDBX_error_t(::mdbx_put(handle_, map.dbi, &key, value, flags));
 }
@@ -6484,6 +6867,131 @@ inline bool cursor::distribute(const cursor from, const cursor to, const std::ve
 
 //------------------------------------------------------------------------------
 
+inline pair_range::pair_range(const ::mdbx::txn &txn, map_handle map, const slice &from, const slice &to,
+                              bool backward)
+    : owned_(txn.open_cursor(map).withdraw_handle()), cursor_(owned_), backward_(backward) {
+  setup(from, to);
+}
+
+inline pair_range::pair_range(cursor &cursor, const slice &from, const slice &to, bool backward)
+    : cursor_(cursor.handle()), backward_(backward) {
+  setup(from, to);
+}
+
+inline pair_range::pair_range(pair_range &&other) noexcept
+    : owned_(other.owned_), cursor_(other.cursor_), stop_(other.stop_), stop_holder_(::std::move(other.stop_holder_)),
+      fixed_(other.fixed_), count_(other.count_), index_(other.index_), offset_(other.offset_),
+      backward_(other.backward_), last_chunk_(other.last_chunk_), done_(other.done_), current_(other.current_) {
+  /* the moved string could be a short one stored inline, so the stop slice must be re-pointed */
+  if (other.stop_.is_valid())
+    stop_ = slice(stop_holder_.data(), stop_holder_.size());
+  ::std::memcpy(chunk_, other.chunk_, sizeof(chunk_));
+  other.owned_ = nullptr;
+  other.done_ = true;
+}
+
+inline void pair_range::hold_stop(const slice &key) {
+  /* the caller's key may not outlive the range, as well as a key from a page within a read-write transaction */
+  stop_holder_.assign(key.char_ptr(), key.length());
+  stop_ = slice(stop_holder_.data(), stop_holder_.size());
+}
+
+inline void pair_range::setup(const slice &from, const slice &to) {
+  unsigned flags, state;
+  error::success_or_throw(::mdbx_dbi_flags_ex(::mdbx_cursor_txn(cursor_), ::mdbx_cursor_dbi(cursor_), &flags, &state));
+  slice key, value;
+  int err;
+  stop_ = slice::invalid();
+  if (!backward_) {
+    if (to.is_valid())
+      hold_stop(to);
+    key = from;
+    err = ::mdbx_cursor_get(cursor_, &key, &value, from.is_valid() ? MDBX_SET_RANGE : MDBX_FIRST);
+  } else {
+    /* for the backward direction the exclusive stop key is the nearest one before the `from` */
+    if (from.is_valid()) {
+      key = from;
+      err = ::mdbx_cursor_get(cursor_, &key, &value, MDBX_TO_KEY_LESSER_THAN);
+      if (err == MDBX_SUCCESS)
+        hold_stop(key);
+      else if (MDBX_UNLIKELY(err != MDBX_NOTFOUND))
+        MDBX_CXX20_UNLIKELY error::throw_exception(err);
+    }
+    key = to;
+    err = ::mdbx_cursor_get(cursor_, &key, &value, to.is_valid() ? MDBX_TO_KEY_LESSER_THAN : MDBX_LAST);
+    if (err == MDBX_SUCCESS && (flags & MDBX_DUPSORT))
+      err = ::mdbx_cursor_get(cursor_, &key, &value, MDBX_LAST_DUP);
+  }
+  if (err == MDBX_NOTFOUND) {
+    done_ = true;
+    return;
+  }
+  error::success_or_throw(err);
+  if (flags & MDBX_DUPFIXED)
+    fixed_ = value.length();
+  settle();
+}
+
+inline void pair_range::fetch() {
+  index_ = 0;
+  const int err = ::mdbx_cursor_get_batch_ex(cursor_, &count_, chunk_, batch_capacity,
+                                             backward_ ? MDBX_PREV : MDBX_NEXT, stop_.is_valid() ? &stop_ : nullptr);
+  switch (err) {
+  case MDBX_SUCCESS:
+    break;
+  case MDBX_RESULT_TRUE:
+    last_chunk_ = true;
+    break;
+  case MDBX_NOTFOUND:
+  case MDBX_ENODATA:
+    count_ = 0;
+    last_chunk_ = true;
+    break;
+  default:
+    MDBX_CXX20_UNLIKELY error::throw_exception(err);
+  }
+}
+
+inline void pair_range::settle() {
+  while (MDBX_UNLIKELY(index_ >= count_)) {
+    if (last_chunk_) {
+      current_ = pair::invalid();
+      done_ = true;
+      return;
+    }
+    fetch();
+  }
+  current_ = pair(chunk_[index_], chunk_[index_ + 1]);
+  if (fixed_) {
+    /* items within a MDBX_DUPFIXED chunk are always in the ascending order */
+    offset_ = backward_ ? current_.value.length() - fixed_ : 0;
+    current_.value = slice(current_.value.byte_ptr() + offset_, fixed_);
+  }
+}
+
+inline void pair_range::advance() {
+  if (fixed_) {
+    const slice &chunk = chunk_[index_ + 1];
+    if (backward_ ? offset_ > 0 : offset_ + fixed_ < chunk.length()) {
+      offset_ = backward_ ? offset_ - fixed_ : offset_ + fixed_;
+      current_.value = slice(chunk.byte_ptr() + offset_, fixed_);
+      return;
+    }
+  }
+  index_ += 2;
+  settle();
+}
+
+inline pair_range txn::range(map_handle map, const slice &from, const slice &to, bool backward) const {
+  return pair_range(*this, map, from, to, backward);
+}
+
+inline pair_range cursor::range(const slice &from, const slice &to, bool backward) {
+  return pair_range(*this, from, to, backward);
+}
+
+//------------------------------------------------------------------------------
+
 LIBMDBX_API ::std::ostream &operator<<(::std::ostream &, const slice &);
 LIBMDBX_API ::std::ostream &operator<<(::std::ostream &, const pair &);
 LIBMDBX_API ::std::ostream &operator<<(::std::ostream &, const pair_result &);
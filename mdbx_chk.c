@@ -356,7 +356,7 @@ static const MDBX_chk_callbacks_t cb = {.check_break = check_break,
 static void usage(const char *progname) {
   fprintf(stderr,
           "usage: %s "
-          "[-V] [-v] [-q] [-c] [-0|1|2] [-w] [-d] [-i] [-s table] [-u|U] db_pathname\n"
+          "[-V] [-v] [-q] [-c] [-0|1|2] [-w] [-d] [-i] [-j threads] [-s table] [-u|U] db_pathname\n"
           "  -V\t\tprint version and exit\n"
           "  -v\t\tmore verbose, could be repeated upto 9 times for extra details\n"
           "  -q\t\tbe quiet\n"
@@ -364,6 +364,7 @@ static void usage(const char *progname) {
           "  -w\t\twrite-mode checking\n"
           "  -d\t\tdisable page-by-page traversal of B-tree\n"
           "  -i\t\tignore wrong order errors (for custom comparators case)\n"
+          "  -j threads\twalk B-tree pages in parallel by given number of threads\n"
           "  -s table\tprocess a specific subdatabase only\n"
           "  -u\t\twarmup database before checking\n"
           "  -U\t\twarmup and try lock database pages in memory before checking\n"
@@ -452,6 +453,7 @@ int main(int argc, char *argv[]) {
                           "t"
                           "d"
                           "i"
+                          "j:"
                           "s:")) != EOF;) {
     switch (i) {
     case 'V':
@@ -516,6 +518,13 @@ int main(int argc, char *argv[]) {
     case 'i':
       chk_flags |= MDBX_CHK_IGNORE_ORDER;
       break;
+    case 'j': {
+      char *end = nullptr;
+      const unsigned long threads = strtoul(optarg, &end, 0);
+      if (!end || *end || threads < 1 || threads > 1024)
+        usage(progname);
+      chk.walk_threads = (unsigned)threads;
+    } break;
     case 'u':
       warmup = true;
       break;
@@ -52,22 +52,59 @@ static void signal_handler(int sig) {
 
 static void usage(const char *prog) {
   fprintf(stderr,
-          "usage: %s [-V] [-q] [-c] [-d] [-p] [-u|U] src_path [dest_path]\n"
+          "usage: %s [-V] [-q] [-c] [-P] [-d] [-p] [-u|U] [-i txnid] src_path [dest_path]\n"
+          "       %s [-V] [-q] -a db_path [incremental_path]\n"
           "  -V\t\tprint version and exit\n"
           "  -q\t\tbe quiet\n"
           "  -c\t\tenable compactification (skip unused pages)\n"
+          "  -P\t\tcompactification using several threads (implies -c)\n"
           "  -f\t\tforce copying even the target file exists\n"
           "  -d\t\tenforce copy to be a dynamic size DB\n"
           "  -p\t\tusing transaction parking/ousting during copying MVCC-snapshot\n"
           "    \t\tto avoid stopping recycling and overflowing the DB\n"
           "  -u\t\twarmup database before copying\n"
           "  -U\t\twarmup and try lock database pages in memory before copying\n"
+          "  -i txnid\tincremental copy, i.e. only pages changed after given txnid\n"
+          "  -a\t\tapply incremental copy to the as-is copy of database\n"
           "  src_path\tsource database\n"
-          "  dest_path\tdestination (stdout if not specified)\n",
-          prog);
+          "  dest_path\tdestination (stdout if not specified)\n"
+          "  db_path\tdatabase copy to be updated\n"
+          "  incremental_path\tincremental copy (stdin if not specified)\n",
+          prog, prog);
   exit(EXIT_FAILURE);
 }
 
+static int open_file(const char *path, bool writable, bool create, bool overwrite, mdbx_filehandle_t *fd) {
+#if defined(_WIN32) || defined(_WIN64)
+  *fd = CreateFileA(path, writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, writable ? 0 : FILE_SHARE_READ,
+                    nullptr, create ? (overwrite ? CREATE_ALWAYS : CREATE_NEW) : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                    nullptr);
+  return (*fd == INVALID_HANDLE_VALUE) ? (int)GetLastError() : MDBX_SUCCESS;
+#else
+  int flags = writable ? O_RDWR : O_RDONLY;
+  if (create)
+    flags |= O_CREAT | (overwrite ? O_TRUNC : O_EXCL);
+  *fd = open(path, flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+  return (*fd < 0) ? errno : MDBX_SUCCESS;
+#endif
+}
+
+static void close_file(mdbx_filehandle_t fd) {
+#if defined(_WIN32) || defined(_WIN64)
+  CloseHandle(fd);
+#else
+  close(fd);
+#endif
+}
+
+static mdbx_filehandle_t std_handle(bool output) {
+#if defined(_WIN32) || defined(_WIN64)
+  return GetStdHandle(output ? STD_OUTPUT_HANDLE : STD_INPUT_HANDLE);
+#else
+  return fileno(output ? stdout : stdin);
+#endif
+}
+
 static void logger(MDBX_log_level_t level, const char *function, int line, const char *fmt, va_list args) {
   static const char *const prefixes[] = {
       "!!!fatal: ", // 0 fatal
@@ -91,6 +128,8 @@ int main(int argc, char *argv[]) {
   unsigned cpflags = 0;
   bool quiet = false;
   bool warmup = false;
+  bool incremental = false, apply = false;
+  uint64_t since_txnid = 0;
   MDBX_warmup_flags_t warmup_flags = MDBX_warmup_default;
 
   for (; argc > 1 && argv[1][0] == '-'; argc--, argv++) {
@@ -98,6 +137,8 @@ int main(int argc, char *argv[]) {
       flags |= MDBX_NOSUBDIR;
     else if (argv[1][1] == 'c' && argv[1][2] == '\0')
       cpflags |= MDBX_CP_COMPACT;
+    else if (argv[1][1] == 'P' && argv[1][2] == '\0')
+      cpflags |= MDBX_CP_COMPACT | MDBX_CP_PARALLEL;
     else if (argv[1][1] == 'd' && argv[1][2] == '\0')
       cpflags |= MDBX_CP_FORCE_DYNAMIC_SIZE;
     else if (argv[1][1] == 'p' && argv[1][2] == '\0')
@@ -106,7 +147,17 @@ int main(int argc, char *argv[]) {
       cpflags |= MDBX_CP_OVERWRITE;
     else if (argv[1][1] == 'q' && argv[1][2] == '\0')
       quiet = true;
-    else if (argv[1][1] == 'u' && argv[1][2] == '\0')
+    else if (argv[1][1] == 'a' && argv[1][2] == '\0')
+      apply = true;
+    else if (argv[1][1] == 'i' && argv[1][2] == '\0' && argc > 2) {
+      char *end = nullptr;
+      since_txnid = strtoull(argv[2], &end, 0);
+      if (!end || *end || argv[2][0] == '-')
+        usage(progname);
+      incremental = true;
+      argc--;
+      argv++;
+    } else if (argv[1][1] == 'u' && argv[1][2] == '\0')
       warmup = true;
     else if (argv[1][1] == 'U' && argv[1][2] == '\0') {
       warmup = true;
@@ -128,7 +179,8 @@ int main(int argc, char *argv[]) {
       argc = 0;
   }
 
-  if (argc < 2 || argc > 3)
+  if (argc < 2 || argc > 3 || (apply && (incremental || cpflags || warmup)) ||
+      (incremental && (cpflags & ~MDBX_CP_OVERWRITE)))
     usage(progname);
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -145,13 +197,39 @@ int main(int argc, char *argv[]) {
 #endif /* !WINDOWS */
 
   if (!quiet) {
-    fprintf((argc == 2) ? stderr : stdout, "mdbx_copy %s (%s, T-%s)\nRunning for copy %s to %s...\n",
-            mdbx_version.git.describe, mdbx_version.git.datetime, mdbx_version.git.tree, argv[1],
-            (argc == 2) ? "stdout" : argv[2]);
+    if (apply)
+      fprintf(stdout, "mdbx_copy %s (%s, T-%s)\nRunning for apply %s to %s...\n", mdbx_version.git.describe,
+              mdbx_version.git.datetime, mdbx_version.git.tree, (argc == 2) ? "stdin" : argv[2], argv[1]);
+    else
+      fprintf((argc == 2) ? stderr : stdout, "mdbx_copy %s (%s, T-%s)\nRunning for %scopy %s to %s...\n",
+              mdbx_version.git.describe, mdbx_version.git.datetime, mdbx_version.git.tree,
+              incremental ? "incremental " : "", argv[1], (argc == 2) ? "stdout" : argv[2]);
     fflush(nullptr);
     mdbx_setup_debug(MDBX_LOG_NOTICE, MDBX_DBG_DONTCHANGE, logger);
   }
 
+  if (apply) {
+    mdbx_filehandle_t dest_fd, delta_fd = std_handle(false);
+    act = "opening database copy";
+    rc = open_file(argv[1], true, false, false, &dest_fd);
+    if (rc == MDBX_SUCCESS) {
+      if (argc == 3) {
+        act = "opening incremental copy";
+        rc = open_file(argv[2], false, false, false, &delta_fd);
+      }
+      if (rc == MDBX_SUCCESS) {
+        act = "applying";
+        rc = mdbx_env_apply_incremental(dest_fd, delta_fd);
+        if (argc == 3)
+          close_file(delta_fd);
+      }
+      close_file(dest_fd);
+    }
+    if (rc)
+      fprintf(stderr, "%s: %s failed, error %d (%s)\n", progname, act, rc, mdbx_strerror(rc));
+    return rc ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+
   act = "opening environment";
   rc = mdbx_env_create(&env);
   if (rc == MDBX_SUCCESS)
@@ -164,15 +242,24 @@ int main(int argc, char *argv[]) {
 
   if (!MDBX_IS_ERROR(rc)) {
     act = "copying";
-    if (argc == 2) {
-      mdbx_filehandle_t fd;
-#if defined(_WIN32) || defined(_WIN64)
-      fd = GetStdHandle(STD_OUTPUT_HANDLE);
-#else
-      fd = fileno(stdout);
-#endif
-      rc = mdbx_env_copy2fd(env, fd, cpflags);
-    } else
+    if (incremental) {
+      mdbx_filehandle_t fd = std_handle(true);
+      if (argc == 3) {
+        act = "creating incremental copy";
+        rc = open_file(argv[2], true, true, (cpflags & MDBX_CP_OVERWRITE) != 0, &fd);
+      }
+      if (rc == MDBX_SUCCESS) {
+        act = "copying";
+        rc = mdbx_env_copy_incremental(env, since_txnid, fd);
+        if (argc == 3) {
+          close_file(fd);
+          if (rc != MDBX_SUCCESS)
+            remove(argv[2]);
+        }
+      }
+    } else if (argc == 2)
+      rc = mdbx_env_copy2fd(env, std_handle(true), cpflags);
+    else
       rc = mdbx_env_copy(env, argv[2], cpflags);
   }
   if (rc)
@@ -473,10 +473,11 @@ __hot static int readline(MDBX_val *out, MDBX_val *buf) {
 static void usage(void) {
   fprintf(stderr,
           "usage: %s "
-          "[-V] [-q] [-a] [-f file] [-s name] [-N] [-p] [-T] [-r] [-n] dbpath\n"
+          "[-V] [-q] [-a] [-B] [-f file] [-s name] [-N] [-p] [-T] [-r] [-n] dbpath\n"
           "  -V\t\tprint version and exit.\n"
           "  -q\t\tbe quiet.\n"
           "  -a\t\tappend records in input order (required for custom comparators).\n"
+          "  -B\t\tbulk-load empty tables by building b-tree bottom-up (implies -a, ignored with -r).\n"
           "  -b number\tinsertion batch size as number of items (100K by default).\n"
           "  -L megabytes\tlimits the amount of transactions in megabytes.\n"
           "  -d percent\tdesired pages filling density in percent between 50 and 100 (100 by default).\n"
@@ -503,6 +504,19 @@ static int equal_or_greater(const MDBX_val *a, const MDBX_val *b) {
   return (a->iov_len == b->iov_len && memcmp(a->iov_base, b->iov_base, a->iov_len) == 0) ? 0 : 1;
 }
 
+static int bulk_source(void *context, MDBX_val *key, MDBX_val *data) {
+  (void)context;
+  int err = readline(key, &kbuf);
+  if (err == EOF)
+    return MDBX_NOTFOUND;
+
+  if (err == MDBX_SUCCESS)
+    err = readline(data, &dbuf);
+  if (err && !quiet)
+    fprintf(stderr, "%s: line %" PRIiSIZE ": failed to read key value\n", prog, lineno);
+  return err;
+}
+
 int main(int argc, char *argv[]) {
   int i, err;
   MDBX_env *env = nullptr;
@@ -513,6 +527,7 @@ int main(int argc, char *argv[]) {
   int envflags = MDBX_SAFE_NOSYNC | MDBX_ACCEDE, putflags = MDBX_UPSERT;
   bool rescue = false;
   bool purge = false;
+  bool bulk = false;
   unsigned density_percent = 100;
   bool override_geometry = false;
   intptr_t geometry_pagesize = -1;
@@ -529,6 +544,7 @@ int main(int argc, char *argv[]) {
 
   while ((i = getopt(argc, argv,
                      "a"
+                     "B"
                      "b:"
                      "L:"
                      "d:"
@@ -557,6 +573,10 @@ int main(int argc, char *argv[]) {
     case 'a':
       putflags |= MDBX_APPEND;
       break;
+    case 'B':
+      bulk = true;
+      putflags |= MDBX_APPEND;
+      break;
     case 'f':
       if (freopen(optarg, "r", stdin) == nullptr) {
         if (!quiet)
@@ -624,6 +644,12 @@ int main(int argc, char *argv[]) {
 
   if (optind != argc - 1)
     usage();
+  if (bulk && rescue) {
+    if (!quiet)
+      fprintf(stderr, "%s: the bulk-loading can't skip invalid records, so -B is ignored in the rescue mode (-r)\n",
+              prog);
+    bulk = false;
+  }
 
 #if defined(_WIN32) || defined(_WIN64)
   SetConsoleCtrlHandler(ConsoleBreakHandlerRoutine, true);
@@ -805,6 +831,32 @@ int main(int argc, char *argv[]) {
     if (putflags & MDBX_APPEND)
       putflags = (dbi_flags & MDBX_DUPSORT) ? putflags | MDBX_APPENDDUP : putflags & ~MDBX_APPENDDUP;
 
+    if (bulk) {
+      MDBX_stat stat;
+      err = mdbx_dbi_stat(txn, dbi, &stat, sizeof(stat));
+      if (unlikely(err != MDBX_SUCCESS)) {
+        error("mdbx_dbi_stat", err);
+        goto bailout;
+      }
+      /* The bulk-loading neither skips nor overwrites existing records, but appending in the input order
+       * to a non-empty table would break the order of keys, so such loading is rejected. */
+      if (stat.ms_entries) {
+        if (!quiet)
+          fprintf(stderr,
+                  "%s: table '%s' is not empty, but the bulk-loading (-B) requires an empty one, "
+                  "use -p to purge it or load without -B\n",
+                  prog, dbi_name);
+        err = MDBX_RESULT_TRUE;
+        goto bailout;
+      }
+      err = mdbx_table_bulk_load(txn, dbi, bulk_source, nullptr, density_percent);
+      if (unlikely(err != MDBX_SUCCESS)) {
+        error("mdbx_table_bulk_load", err);
+        goto bailout;
+      }
+      goto commit;
+    }
+
     err = mdbx_cursor_open(txn, dbi, &mc);
     if (unlikely(err != MDBX_SUCCESS)) {
       error("mdbx_cursor_open", err);
@@ -870,6 +922,7 @@ int main(int argc, char *argv[]) {
 
     mdbx_cursor_close(mc);
     mc = nullptr;
+  commit:
     err = mdbx_txn_commit(txn);
     txn = nullptr;
     if (unlikely(err != MDBX_SUCCESS)) {
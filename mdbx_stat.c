@@ -315,11 +315,23 @@ int main(int argc, char *argv[]) {
            mei.mi_pgop_stat.msync);
     printf("    fSync: %8" PRIu64 "\t// number of explicit fsync-to-disk operations (not a pages)\n",
            mei.mi_pgop_stat.fsync);
+    if (mei.mi_checksum.computed | mei.mi_checksum.verified | mei.mi_checksum.mismatched) {
+      printf("    CkSum: %8" PRIu64 "\t// quantity of pages checksummed while writing\n", mei.mi_checksum.computed);
+      printf("   Verify: %8" PRIu64 "\t// quantity of pages verified by checksums\n", mei.mi_checksum.verified);
+      printf(" Mismatch: %8" PRIu64 "\t// quantity of checksum mismatches caught\n", mei.mi_checksum.mismatched);
+    }
+    printf(" RSlotFree: %7" PRIu32 "\t// reader slots claimed without locking\n", mei.mi_rslot.lockfree);
+    printf(" RSlotLock: %7" PRIu32 "\t// reader slots claimed under the lock\n", mei.mi_rslot.locked);
+    printf("  RSlotCAS: %7" PRIu32 "\t// races lost for a free reader slot\n", mei.mi_rslot.collisions);
+    printf(" RSlotFull: %7" PRIu32 "\t// readers table was full and dead readers cleanup required\n",
+           mei.mi_rslot.exhausted);
   }
 
   if (en) {
     printf("Environment Info\n");
     printf("  Pagesize: %u\n", mei.mi_dxb_pagesize);
+    if (mei.mi_checksum.method)
+      printf("  Page checksums: %s\n", (mei.mi_checksum.method == MDBX_VALIDATOR_CRC32C) ? "CRC32C" : "unknown");
     if (mei.mi_geo.lower != mei.mi_geo.upper) {
       printf("  Dynamic datafile: %" PRIu64 "..%" PRIu64 " bytes (+%" PRIu64 "/-%" PRIu64 "), %" PRIu64 "..%" PRIu64
              " pages (+%" PRIu64 "/-%" PRIu64 ")\n",
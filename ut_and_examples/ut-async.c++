@@ -0,0 +1,192 @@
+/// \copyright SPDX-License-Identifier: Apache-2.0
+/// \file The unit test of the C++20 awaitable operations of the mdbx::env.
+/// \details Each of `copy_async()`, `warmup_async()`, `defrag_async()` and `chk_async()` is awaited from a coroutine
+/// without a stop token, with a stop token which is never requested, and with an already requested one,
+/// both by an inline executor and by an executor running the jobs by separate threads.
+
+#include <mdbx.h++>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#if MDBX_HAVE_CXX20_COROUTINES
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#if !(defined(_WIN32) || defined(_WIN64))
+#include <fcntl.h>
+#include <unistd.h>
+#endif /* !Windows */
+
+static const char *const db_pathname = "./ut-async-db";
+static const char *const copy_pathname = "./ut-async-copy";
+
+struct outcome {
+  std::mutex mutex;
+  std::condition_variable signal;
+  bool done{false};
+  std::vector<std::string> failures;
+
+  void fail(const std::string &what) {
+    std::lock_guard<std::mutex> guard(mutex);
+    failures.push_back(what);
+  }
+  void finish() {
+    std::lock_guard<std::mutex> guard(mutex);
+    done = true;
+    signal.notify_all();
+  }
+  void wait() {
+    std::unique_lock<std::mutex> guard(mutex);
+    signal.wait(guard, [this] { return done; });
+  }
+};
+
+/* A fire-and-forget coroutine, which reports the completion via the outcome. */
+struct task {
+  struct promise_type {
+    task get_return_object() noexcept { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+};
+
+static bool file_exists(const char *pathname) {
+  std::FILE *const file = std::fopen(pathname, "rb");
+  if (file)
+    std::fclose(file);
+  return file != nullptr;
+}
+
+static bool chk_break(MDBX_chk_context_t *) { return false; }
+
+static task scenario(mdbx::env env, mdbx::async_executor executor, std::stop_token stop, bool cancelled,
+                     outcome &out) {
+  try {
+    std::remove(copy_pathname);
+    if (co_await env.copy_async(copy_pathname, true, false, stop, executor) == cancelled)
+      out.fail("copy_async(path) result");
+    if (file_exists(copy_pathname) == cancelled)
+      out.fail("copy_async(path) destination");
+    std::remove(copy_pathname);
+
+#if !(defined(_WIN32) || defined(_WIN64))
+    const int fd = ::open(copy_pathname, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+      out.fail("open()");
+    else {
+      if (co_await env.copy_async(fd, false, false, stop, executor) == cancelled)
+        out.fail("copy_async(fd) result");
+      if ((::lseek(fd, 0, SEEK_END) > 0) == cancelled)
+        out.fail("copy_async(fd) destination");
+      ::close(fd);
+    }
+    std::remove(copy_pathname);
+#endif /* !Windows */
+
+    if (co_await env.warmup_async(MDBX_warmup_force, mdbx::duration(0), nullptr, nullptr, stop, executor) ==
+        cancelled)
+      out.fail("warmup_async() result");
+
+    const MDBX_defrag_result_t defrag =
+        co_await env.defrag_async(0, mdbx::duration(0), 0, mdbx::duration(0), -1, 0, nullptr, nullptr, stop, executor);
+    if (cancelled ? defrag.stopping_reasons != MDBX_defrag_discontinued || defrag.pages_moved != 0
+                  : (defrag.stopping_reasons & MDBX_defrag_discontinued) != 0)
+      out.fail("defrag_async() result");
+
+    MDBX_chk_callbacks_t callbacks;
+    std::memset(&callbacks, 0, sizeof(callbacks));
+    callbacks.check_break = chk_break;
+    MDBX_chk_context_t ctx;
+    std::memset(&ctx, 0, sizeof(ctx));
+    if (co_await env.chk_async(&callbacks, &ctx, MDBX_CHK_DEFAULTS, MDBX_chk_result, mdbx::duration(0), stop,
+                               executor) == cancelled)
+      out.fail("chk_async() result");
+    if ((ctx.result.processed_pages != 0) == cancelled)
+      out.fail("chk_async() context");
+  } catch (const std::exception &ex) {
+    out.fail(std::string("exception: ") + ex.what());
+  }
+  out.finish();
+}
+
+static void fill(mdbx::env &env) {
+  auto txn = env.start_write();
+  auto map = txn.create_map("table", mdbx::key_mode::ordinal, mdbx::value_mode::single);
+  const std::string value(200, '*');
+  for (uint64_t i = 0; i < 20000; ++i)
+    txn.upsert(map, mdbx::slice::wrap(i), mdbx::slice(value));
+  txn.commit();
+  /* make a room for defragmentation */
+  txn = env.start_write();
+  for (uint64_t i = 0; i < 20000; i += 3)
+    txn.erase(map, mdbx::slice::wrap(i));
+  txn.commit();
+}
+
+static bool run(mdbx::env &env, const char *caption, mdbx::async_executor executor, std::stop_token stop,
+                bool cancelled) {
+  outcome out;
+  scenario(env, executor, stop, cancelled, out);
+  out.wait();
+  for (const auto &what : out.failures)
+    std::cerr << caption << ": " << what << std::endl;
+  return out.failures.empty();
+}
+
+static bool run_all(mdbx::env &env, const char *executor_caption, mdbx::async_executor executor) {
+  std::stop_source never, requested;
+  requested.request_stop();
+  bool ok = run(env, (std::string(executor_caption) + ", without stop-token").c_str(), executor, {}, false);
+  ok &= run(env, (std::string(executor_caption) + ", with stop-token").c_str(), executor, never.get_token(), false);
+  ok &= run(env, (std::string(executor_caption) + ", cancelled").c_str(), executor, requested.get_token(), true);
+  return ok;
+}
+
+int main(int argc, const char *argv[]) {
+  (void)argc;
+  (void)argv;
+
+  mdbx::env::remove(db_pathname);
+  mdbx::env_managed env(db_pathname, mdbx::env_managed::create_parameters(), mdbx::env::operate_parameters(3));
+  fill(env);
+
+  bool ok = run_all(env, "inline", [](std::function<void()> job) { job(); });
+
+  std::mutex threads_mutex;
+  std::vector<std::thread> threads;
+  ok &= run_all(env, "threads", [&](std::function<void()> job) {
+    std::lock_guard<std::mutex> guard(threads_mutex);
+    threads.emplace_back(std::move(job));
+  });
+  for (auto &thread : threads)
+    thread.join();
+
+  env.close();
+  if (ok)
+    std::cout << "mdbx::env awaitables: passed" << std::endl;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else
+
+int main(int argc, const char *argv[]) {
+  (void)argc;
+  (void)argv;
+  std::cout << "mdbx::env awaitables: skipped, since C++20 coroutines are unavailable" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#endif /* MDBX_HAVE_CXX20_COROUTINES */
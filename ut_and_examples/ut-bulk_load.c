@@ -0,0 +1,448 @@
+/** \copyright SPDX-License-Identifier: Apache-2.0
+ * \file The unit test of the mdbx_table_bulk_load() against a full read-back and mdbx_env_chk().
+ * \details The tables are built with several fill factors, with variable-length keys and some large values,
+ * within a nested transaction and with a small dirty pages limit to force spilling, for a small and for the default
+ * page size. Keys out of order are expected to stop the loading with MDBX_EKEYMISMATCH, and the fallback path
+ * is checked for non-empty and dupsort tables. */
+
+#if (defined(__MINGW__) || defined(__MINGW32__) || defined(__MINGW64__)) && !defined(__USE_MINGW_ANSI_STDIO)
+#define __USE_MINGW_ANSI_STDIO 1
+#endif /* MinGW */
+
+#include "mdbx.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DB_PATHNAME "./ut-bulk_load-db"
+#define NUM_RECORDS 20000u
+#define DUPS_PER_KEY 4u
+#define KEY_MAX 16u
+#define VALUE_MAX (65536u * 2 + 128)
+
+static int failed(const char *what, int rc) {
+  fprintf(stderr, "%s: (%d) %s\n", what, rc, mdbx_strerror(rc));
+  return rc ? rc : MDBX_PROBLEM;
+}
+
+static void put_be32(uint32_t n, unsigned char *buf) {
+  for (int i = 0; i < 4; ++i)
+    buf[i] = (unsigned char)(n >> (24 - i * 8));
+}
+
+/* The keys are big-endian numbers followed by a suffix of variable length, so the lexicographic order matches
+ * the numeric one. For a dupsort table each key has several values, which are ordered the same way, otherwise
+ * some of the values are large enough to be placed on the large/overflow pages. */
+static void make_pair(uint32_t n, bool dupsort, size_t pagesize, unsigned char *kbuf, unsigned char *vbuf,
+                      MDBX_val *key, MDBX_val *value) {
+  const uint32_t k = dupsort ? n / DUPS_PER_KEY : n;
+  put_be32(k, kbuf);
+  key->iov_base = kbuf;
+  key->iov_len = 4 + k % (KEY_MAX - 4);
+  for (size_t i = 4; i < key->iov_len; ++i)
+    kbuf[i] = (unsigned char)(k + i);
+
+  value->iov_base = vbuf;
+  if (dupsort) {
+    put_be32(n, vbuf);
+    value->iov_len = 4 + n % 7;
+    for (size_t i = 4; i < value->iov_len; ++i)
+      vbuf[i] = (unsigned char)(n - i);
+  } else {
+    value->iov_len = (n % 61 == 7) ? pagesize * 2 + n % 100 : n % 50 + 1;
+    for (size_t i = 0; i < value->iov_len; ++i)
+      vbuf[i] = (unsigned char)(n * 31 + i);
+  }
+}
+
+struct source {
+  uint32_t next, end;
+  /* the number to be yielded at `disorder_at` is decremented by `disorder_back` to break the order */
+  uint32_t disorder_at, disorder_back;
+  bool dupsort;
+  size_t pagesize;
+  unsigned char kbuf[KEY_MAX];
+  unsigned char vbuf[VALUE_MAX];
+};
+
+static int source_next(void *context, MDBX_val *key, MDBX_val *value) {
+  struct source *const src = context;
+  if (src->next >= src->end)
+    return MDBX_NOTFOUND;
+  uint32_t n = src->next++;
+  if (n == src->disorder_at)
+    n -= src->disorder_back;
+  make_pair(n, src->dupsort, src->pagesize, src->kbuf, src->vbuf, key, value);
+  return MDBX_SUCCESS;
+}
+
+static struct source src;
+
+static int load(MDBX_txn *txn, MDBX_dbi dbi, uint32_t begin, uint32_t end, unsigned fill_percent, int expected) {
+  src.next = begin;
+  src.end = end;
+  const int rc = mdbx_table_bulk_load(txn, dbi, source_next, &src, fill_percent);
+  if (rc != expected) {
+    fprintf(stderr, "mdbx_table_bulk_load(%u..%u, %u%%) returned %d, expected %d\n", begin, end, fill_percent, rc,
+            expected);
+    return (rc != MDBX_SUCCESS) ? rc : MDBX_PROBLEM;
+  }
+  src.disorder_at = UINT32_MAX;
+  return MDBX_SUCCESS;
+}
+
+/* Reads the whole table by a cursor and compares it with the pairs generated for the given range of numbers. */
+static int verify(MDBX_env *env, const char *table, uint32_t begin, uint32_t end) {
+  static unsigned char kbuf[KEY_MAX], vbuf[VALUE_MAX];
+  MDBX_txn *txn;
+  MDBX_cursor *cursor = NULL;
+  MDBX_dbi dbi;
+  int rc = mdbx_txn_begin(env, NULL, MDBX_TXN_RDONLY, &txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_begin", rc);
+  rc = mdbx_dbi_open(txn, table, MDBX_DB_ACCEDE, &dbi);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_dbi_open", rc);
+    goto bailout;
+  }
+  rc = mdbx_cursor_open(txn, dbi, &cursor);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_cursor_open", rc);
+    goto bailout;
+  }
+  for (uint32_t n = begin; n <= end; ++n) {
+    MDBX_val key, value, expected_key, expected_value;
+    rc = mdbx_cursor_get(cursor, &key, &value, (n == begin) ? MDBX_FIRST : MDBX_NEXT);
+    if (n == end) {
+      if (rc != MDBX_NOTFOUND) {
+        fprintf(stderr, "%s: extra items after #%u\n", table, n);
+        rc = (rc != MDBX_SUCCESS) ? rc : MDBX_PROBLEM;
+        goto bailout;
+      }
+      rc = MDBX_SUCCESS;
+      break;
+    }
+    if (rc != MDBX_SUCCESS) {
+      fprintf(stderr, "%s: item #%u: ", table, n);
+      rc = failed("mdbx_cursor_get", rc);
+      goto bailout;
+    }
+    make_pair(n, src.dupsort, src.pagesize, kbuf, vbuf, &expected_key, &expected_value);
+    if (key.iov_len != expected_key.iov_len || memcmp(key.iov_base, expected_key.iov_base, key.iov_len) != 0 ||
+        value.iov_len != expected_value.iov_len ||
+        memcmp(value.iov_base, expected_value.iov_base, value.iov_len) != 0) {
+      fprintf(stderr, "%s: item #%u mismatch\n", table, n);
+      rc = MDBX_PROBLEM;
+      goto bailout;
+    }
+  }
+
+bailout:
+  if (cursor)
+    mdbx_cursor_close(cursor);
+  mdbx_txn_abort(txn);
+  return rc;
+}
+
+static void chk_issue(MDBX_chk_context_t *ctx, const char *object, uint64_t entry_number, const char *issue,
+                      const char *extra_fmt, va_list extra_args) {
+  (void)ctx;
+  (void)extra_fmt;
+  (void)extra_args;
+  fprintf(stderr, "mdbx_env_chk: %s #%u: %s\n", object, (unsigned)entry_number, issue);
+}
+
+static int check(MDBX_env *env) {
+  MDBX_chk_callbacks_t callbacks;
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.issue = chk_issue;
+  MDBX_chk_context_t ctx;
+  memset(&ctx, 0, sizeof(ctx));
+  const int rc = mdbx_env_chk(env, &callbacks, &ctx, MDBX_CHK_DEFAULTS, MDBX_chk_result, 0);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_env_chk", rc);
+  if (ctx.result.total_problems) {
+    fprintf(stderr, "mdbx_env_chk: %u problem(s)\n", (unsigned)ctx.result.total_problems);
+    return MDBX_PROBLEM;
+  }
+  return MDBX_SUCCESS;
+}
+
+/* Creates the table and loads the given range of numbers, then commits regardless of the expected result,
+ * since neither MDBX_EKEYMISMATCH nor an error of the source makes the transaction unusable. */
+static int create_and_load(MDBX_env *env, const char *table, MDBX_db_flags_t flags, uint32_t begin, uint32_t end,
+                           unsigned fill_percent, int expected) {
+  MDBX_txn *txn;
+  MDBX_dbi dbi;
+  int rc = mdbx_txn_begin(env, NULL, 0, &txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_begin", rc);
+  rc = mdbx_dbi_open(txn, table, MDBX_CREATE | flags, &dbi);
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(txn);
+    return failed("mdbx_dbi_open", rc);
+  }
+  rc = load(txn, dbi, begin, end, fill_percent, expected);
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(txn);
+    return rc;
+  }
+  rc = mdbx_txn_commit(txn);
+  return (rc == MDBX_SUCCESS) ? rc : failed("mdbx_txn_commit", rc);
+}
+
+static int leaf_pages(MDBX_env *env, const char *table, size_t *pages) {
+  MDBX_txn *txn;
+  MDBX_dbi dbi;
+  MDBX_stat stat;
+  int rc = mdbx_txn_begin(env, NULL, MDBX_TXN_RDONLY, &txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_begin", rc);
+  rc = mdbx_dbi_open(txn, table, MDBX_DB_ACCEDE, &dbi);
+  if (rc == MDBX_SUCCESS)
+    rc = mdbx_dbi_stat(txn, dbi, &stat, sizeof(stat));
+  mdbx_txn_abort(txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_dbi_stat", rc);
+  *pages = (size_t)stat.ms_leaf_pages;
+  return MDBX_SUCCESS;
+}
+
+static int test_fill_factors(MDBX_env *env) {
+  static const unsigned fills[] = {0, 50, 77, 100};
+  size_t pages[sizeof(fills) / sizeof(fills[0])];
+  for (size_t i = 0; i < sizeof(fills) / sizeof(fills[0]); ++i) {
+    char table[16];
+    snprintf(table, sizeof(table), "fill-%u", fills[i]);
+    int rc = create_and_load(env, table, MDBX_DB_DEFAULTS, 0, NUM_RECORDS, fills[i], MDBX_SUCCESS);
+    if (rc == MDBX_SUCCESS)
+      rc = verify(env, table, 0, NUM_RECORDS);
+    if (rc == MDBX_SUCCESS)
+      rc = leaf_pages(env, table, &pages[i]);
+    if (rc != MDBX_SUCCESS)
+      return rc;
+  }
+  if (pages[0] != pages[3] || pages[1] <= pages[2] || pages[2] <= pages[3]) {
+    fprintf(stderr, "unexpected number of leaf pages: %zu, %zu, %zu, %zu\n", pages[0], pages[1], pages[2], pages[3]);
+    return MDBX_PROBLEM;
+  }
+  return MDBX_SUCCESS;
+}
+
+static int test_disorder(MDBX_env *env) {
+  /* an earlier key */
+  src.disorder_at = 500;
+  src.disorder_back = 100;
+  int rc = create_and_load(env, "disorder", MDBX_DB_DEFAULTS, 0, 1000, 0, MDBX_EKEYMISMATCH);
+  if (rc == MDBX_SUCCESS)
+    rc = verify(env, "disorder", 0, 500);
+  if (rc != MDBX_SUCCESS)
+    return rc;
+
+  /* the same key twice */
+  src.disorder_at = 700;
+  src.disorder_back = 1;
+  rc = create_and_load(env, "repeat", MDBX_DB_DEFAULTS, 0, 1000, 50, MDBX_EKEYMISMATCH);
+  return (rc == MDBX_SUCCESS) ? verify(env, "repeat", 0, 700) : rc;
+}
+
+static int test_fallback(MDBX_env *env) {
+  int rc = create_and_load(env, "nonempty", MDBX_DB_DEFAULTS, 0, 100, 0, MDBX_SUCCESS);
+  if (rc != MDBX_SUCCESS)
+    return rc;
+
+  MDBX_txn *txn;
+  MDBX_dbi dbi;
+  rc = mdbx_txn_begin(env, NULL, 0, &txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_begin", rc);
+  rc = mdbx_dbi_open(txn, "nonempty", MDBX_DB_ACCEDE, &dbi);
+  if (rc != MDBX_SUCCESS)
+    rc = failed("mdbx_dbi_open", rc);
+  /* after the existing keys */
+  if (rc == MDBX_SUCCESS)
+    rc = load(txn, dbi, 100, 2000, 50, MDBX_SUCCESS);
+  /* from the last existing key, which is overwritten */
+  if (rc == MDBX_SUCCESS)
+    rc = load(txn, dbi, 1999, 3000, 0, MDBX_SUCCESS);
+  /* before the last existing key */
+  if (rc == MDBX_SUCCESS)
+    rc = load(txn, dbi, 10, 20, 0, MDBX_EKEYMISMATCH);
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(txn);
+    return rc;
+  }
+  rc = mdbx_txn_commit(txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_commit", rc);
+  rc = verify(env, "nonempty", 0, 3000);
+  if (rc != MDBX_SUCCESS)
+    return rc;
+
+  src.dupsort = true;
+  rc = create_and_load(env, "dupsort", MDBX_DUPSORT, 0, 4000, 0, MDBX_SUCCESS);
+  if (rc == MDBX_SUCCESS) {
+    /* the same pair twice */
+    src.disorder_at = 4050;
+    src.disorder_back = 1;
+    rc = create_and_load(env, "dupsort", MDBX_DUPSORT, 4000, 4100, 0, MDBX_EKEYMISMATCH);
+  }
+  if (rc == MDBX_SUCCESS)
+    rc = verify(env, "dupsort", 0, 4050);
+  src.dupsort = false;
+  return rc;
+}
+
+static int test_nested(MDBX_env *env) {
+  MDBX_txn *parent, *nested;
+  MDBX_dbi dbi;
+  MDBX_stat stat;
+  int rc = mdbx_txn_begin(env, NULL, 0, &parent);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_begin", rc);
+  rc = mdbx_dbi_open(parent, "nested", MDBX_CREATE, &dbi);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_dbi_open", rc);
+    goto bailout;
+  }
+
+  rc = mdbx_txn_begin(env, parent, 0, &nested);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_txn_begin(nested)", rc);
+    goto bailout;
+  }
+  rc = load(nested, dbi, 0, NUM_RECORDS, 0, MDBX_SUCCESS);
+  mdbx_txn_abort(nested);
+  if (rc != MDBX_SUCCESS)
+    goto bailout;
+  rc = mdbx_dbi_stat(parent, dbi, &stat, sizeof(stat));
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_dbi_stat", rc);
+    goto bailout;
+  }
+  if (stat.ms_entries != 0) {
+    fprintf(stderr, "nested: %u items remain after abort\n", (unsigned)stat.ms_entries);
+    rc = MDBX_PROBLEM;
+    goto bailout;
+  }
+
+  rc = mdbx_txn_begin(env, parent, 0, &nested);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_txn_begin(nested)", rc);
+    goto bailout;
+  }
+  rc = load(nested, dbi, 0, NUM_RECORDS, 77, MDBX_SUCCESS);
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(nested);
+    goto bailout;
+  }
+  rc = mdbx_txn_commit(nested);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_txn_commit(nested)", rc);
+    goto bailout;
+  }
+  rc = mdbx_txn_commit(parent);
+  return (rc == MDBX_SUCCESS) ? verify(env, "nested", 0, NUM_RECORDS) : failed("mdbx_txn_commit", rc);
+
+bailout:
+  mdbx_txn_abort(parent);
+  return rc;
+}
+
+static int test_spill(MDBX_env *env) {
+  MDBX_txn *txn;
+  MDBX_dbi dbi;
+  MDBX_txn_info info;
+  int rc = mdbx_env_set_option(env, MDBX_opt_txn_dp_limit, 128);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_env_set_option(MDBX_opt_txn_dp_limit)", rc);
+  rc = mdbx_txn_begin(env, NULL, 0, &txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_begin", rc);
+  rc = mdbx_dbi_open(txn, "spill", MDBX_CREATE, &dbi);
+  if (rc != MDBX_SUCCESS)
+    rc = failed("mdbx_dbi_open", rc);
+  if (rc == MDBX_SUCCESS)
+    rc = load(txn, dbi, 0, NUM_RECORDS * 2, 0, MDBX_SUCCESS);
+  if (rc == MDBX_SUCCESS) {
+    rc = mdbx_txn_info(txn, &info, false);
+    if (rc != MDBX_SUCCESS)
+      rc = failed("mdbx_txn_info", rc);
+    else if (info.txn_spilled == 0) {
+      fprintf(stderr, "spill: no pages were spilled\n");
+      rc = MDBX_PROBLEM;
+    }
+  }
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(txn);
+    return rc;
+  }
+  rc = mdbx_txn_commit(txn);
+  return (rc == MDBX_SUCCESS) ? verify(env, "spill", 0, NUM_RECORDS * 2) : failed("mdbx_txn_commit", rc);
+}
+
+static int run(intptr_t pagesize) {
+  MDBX_env *env = NULL;
+  int rc = mdbx_env_delete(DB_PATHNAME, MDBX_ENV_JUST_DELETE);
+  if (rc != MDBX_SUCCESS && rc != MDBX_RESULT_TRUE)
+    return failed("mdbx_env_delete", rc);
+  rc = mdbx_env_create(&env);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_env_create", rc);
+  rc = mdbx_env_set_maxdbs(env, 16);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_set_maxdbs", rc);
+    goto bailout;
+  }
+  rc = mdbx_env_set_geometry(env, -1, -1, -1, -1, -1, pagesize);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_set_geometry", rc);
+    goto bailout;
+  }
+  rc = mdbx_env_open(env, DB_PATHNAME, MDBX_NOSUBDIR | MDBX_LIFORECLAIM, 0664);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_open", rc);
+    goto bailout;
+  }
+
+  MDBX_envinfo info;
+  rc = mdbx_env_info_ex(env, NULL, &info, sizeof(info));
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_info_ex", rc);
+    goto bailout;
+  }
+  memset(&src, 0, sizeof(src));
+  src.disorder_at = UINT32_MAX;
+  src.pagesize = info.mi_dxb_pagesize;
+  rc = test_fill_factors(env);
+  if (rc == MDBX_SUCCESS)
+    rc = test_disorder(env);
+  if (rc == MDBX_SUCCESS)
+    rc = test_fallback(env);
+  if (rc == MDBX_SUCCESS)
+    rc = test_nested(env);
+  if (rc == MDBX_SUCCESS)
+    rc = test_spill(env);
+  if (rc == MDBX_SUCCESS)
+    rc = check(env);
+
+bailout:
+  mdbx_env_close(env);
+  return rc;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+
+  int rc = run(mdbx_limits_pgsize_min());
+  if (rc == MDBX_SUCCESS)
+    rc = run(-1);
+  if (rc == MDBX_SUCCESS)
+    printf("mdbx_table_bulk_load: passed\n");
+  return (rc != MDBX_SUCCESS) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
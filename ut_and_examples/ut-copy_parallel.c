@@ -0,0 +1,232 @@
+/** \copyright SPDX-License-Identifier: Apache-2.0
+ * \file The unit test of the compacting copy with the \ref MDBX_CP_PARALLEL against the sequential one.
+ * \details The source consists of the main table and several named tables, including ones with nested dupsort
+ * trees and large/overflow pages. Both copies must be identical, except the database GUID within the meta pages. */
+
+#if (defined(__MINGW__) || defined(__MINGW32__) || defined(__MINGW64__)) && !defined(__USE_MINGW_ANSI_STDIO)
+#define __USE_MINGW_ANSI_STDIO 1
+#endif /* MinGW */
+
+#include "mdbx.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DB_PATHNAME "./ut-copy_parallel-db"
+#define COPY_SEQUENTIAL DB_PATHNAME "-sequential"
+#define COPY_PARALLEL DB_PATHNAME "-parallel"
+#define NUM_RECORDS 20000u
+#define NUM_TABLES 8u
+
+static uint64_t prng_state = 42;
+
+static uint32_t prng(void) {
+  prng_state = prng_state * 6364136223846793005ull + 1442695040888963407ull;
+  return (uint32_t)(prng_state >> 33);
+}
+
+static int failed(const char *what, int rc) {
+  fprintf(stderr, "%s: (%d) %s\n", what, rc, mdbx_strerror(rc));
+  return rc ? rc : MDBX_PROBLEM;
+}
+
+static int fill_table(MDBX_txn *txn, unsigned n) {
+  char name[16];
+  snprintf(name, sizeof(name), "table-%u", n);
+  const MDBX_db_flags_t flags = (n & 1) ? MDBX_DUPSORT | MDBX_CREATE : MDBX_CREATE;
+  MDBX_dbi dbi;
+  int rc = mdbx_dbi_open(txn, n ? name : NULL, n ? flags : 0, &dbi);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_dbi_open", rc);
+
+  static char buf[9999];
+  for (uint32_t i = 0; i < NUM_RECORDS && rc == MDBX_SUCCESS; ++i) {
+    const uint32_t k = prng();
+    size_t len = 4 + prng() % 64;
+    if ((n & 1) == 0 && prng() % 97 == 0)
+      /* a large/overflow value */
+      len = sizeof(buf) - prng() % 4096;
+    for (size_t j = 0; j < len; ++j)
+      buf[j] = (char)(k + j);
+    MDBX_val key = {(void *)&k, sizeof(k)}, data = {buf, len};
+    if (n & 1)
+      /* a few keys with a lot of multi-values for nested trees */
+      key.iov_len = (i % 3) ? sizeof(k) : 1;
+    rc = mdbx_put(txn, dbi, &key, &data, 0);
+    if (rc == MDBX_KEYEXIST)
+      rc = MDBX_SUCCESS;
+  }
+  return (rc == MDBX_SUCCESS) ? rc : failed("mdbx_put", rc);
+}
+
+static int fill(MDBX_env *env) {
+  MDBX_txn *txn;
+  int rc = mdbx_txn_begin(env, NULL, 0, &txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_begin", rc);
+  for (unsigned n = 1; n <= NUM_TABLES && rc == MDBX_SUCCESS; ++n)
+    rc = fill_table(txn, n);
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(txn);
+    return rc;
+  }
+  rc = mdbx_txn_commit(txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_commit", rc);
+
+  /* Delete a part of records to obtain a GC and sparse pages to be compacted. */
+  rc = mdbx_txn_begin(env, NULL, 0, &txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_begin", rc);
+  MDBX_dbi dbi;
+  rc = mdbx_dbi_open(txn, "table-2", 0, &dbi);
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(txn);
+    return failed("mdbx_dbi_open", rc);
+  }
+  MDBX_cursor *cursor;
+  rc = mdbx_cursor_open(txn, dbi, &cursor);
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(txn);
+    return failed("mdbx_cursor_open", rc);
+  }
+  MDBX_val key, data;
+  unsigned i = 0;
+  while ((rc = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT)) == MDBX_SUCCESS)
+    if (++i % 3 == 0 && (rc = mdbx_cursor_del(cursor, 0)) != MDBX_SUCCESS)
+      break;
+  mdbx_cursor_close(cursor);
+  if (rc != MDBX_NOTFOUND) {
+    mdbx_txn_abort(txn);
+    return failed("mdbx_cursor_del", rc);
+  }
+  rc = mdbx_txn_commit(txn);
+  return (rc == MDBX_SUCCESS) ? rc : failed("mdbx_txn_commit", rc);
+}
+
+static int load(const char *pathname, void **content, size_t *length) {
+  FILE *f = fopen(pathname, "rb");
+  if (!f)
+    return failed(pathname, MDBX_ENOFILE);
+  int rc = MDBX_SUCCESS;
+  if (fseek(f, 0, SEEK_END) != 0 || (*length = (size_t)ftell(f)) == 0 || fseek(f, 0, SEEK_SET) != 0)
+    rc = failed(pathname, MDBX_EIO);
+  else if ((*content = malloc(*length)) == NULL)
+    rc = failed("malloc", MDBX_ENOMEM);
+  else if (fread(*content, 1, *length, f) != *length)
+    rc = failed(pathname, MDBX_EIO);
+  fclose(f);
+  return rc;
+}
+
+static int open_copy(const char *pathname, MDBX_env **env, MDBX_envinfo *info, MDBX_stat *stat) {
+  int rc = mdbx_env_create(env);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_env_create", rc);
+  rc = mdbx_env_open(*env, pathname, MDBX_NOSUBDIR | MDBX_RDONLY, 0);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_env_open", rc);
+  memset(info, 0, sizeof(*info));
+  rc = mdbx_env_info_ex(*env, NULL, info, sizeof(*info));
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_env_info_ex", rc);
+  memset(stat, 0, sizeof(*stat));
+  rc = mdbx_env_stat_ex(*env, NULL, stat, sizeof(*stat));
+  return (rc == MDBX_SUCCESS) ? rc : failed("mdbx_env_stat_ex", rc);
+}
+
+/* Each copy gets its own database GUID, so the meta pages are compared by the content they describe,
+ * and the rest of the files must be the same byte-for-byte. */
+static int compare(void) {
+  MDBX_env *env_a = NULL, *env_b = NULL;
+  MDBX_envinfo info_a, info_b;
+  MDBX_stat stat_a, stat_b;
+  int rc = open_copy(COPY_SEQUENTIAL, &env_a, &info_a, &stat_a);
+  if (rc == MDBX_SUCCESS)
+    rc = open_copy(COPY_PARALLEL, &env_b, &info_b, &stat_b);
+  mdbx_env_close(env_a);
+  mdbx_env_close(env_b);
+  if (rc != MDBX_SUCCESS)
+    return rc;
+  if (memcmp(&info_a.mi_geo, &info_b.mi_geo, sizeof(info_a.mi_geo)) != 0 ||
+      info_a.mi_last_pgno != info_b.mi_last_pgno || info_a.mi_recent_txnid != info_b.mi_recent_txnid ||
+      memcmp(&stat_a, &stat_b, sizeof(stat_a)) != 0) {
+    fprintf(stderr, "the parallel copy describes other geometry or tree than the sequential one\n");
+    return MDBX_PROBLEM;
+  }
+
+  void *a = NULL, *b = NULL;
+  size_t a_len = 0, b_len = 0;
+  rc = load(COPY_SEQUENTIAL, &a, &a_len);
+  if (rc == MDBX_SUCCESS)
+    rc = load(COPY_PARALLEL, &b, &b_len);
+  const size_t metas_bytes = stat_a.ms_psize * (size_t)3;
+  if (rc == MDBX_SUCCESS &&
+      (a_len != b_len || a_len < metas_bytes || memcmp((char *)a + metas_bytes, (char *)b + metas_bytes,
+                                                       a_len - metas_bytes) != 0)) {
+    fprintf(stderr, "the parallel copy differs from the sequential one (%zu and %zu bytes)\n", b_len, a_len);
+    rc = MDBX_PROBLEM;
+  }
+  free(a);
+  free(b);
+  return rc;
+}
+
+static int run(intptr_t pagesize) {
+  MDBX_env *env = NULL;
+  static const char *const pathnames[] = {DB_PATHNAME, COPY_SEQUENTIAL, COPY_PARALLEL};
+  for (size_t i = 0; i < sizeof(pathnames) / sizeof(pathnames[0]); ++i) {
+    const int err = mdbx_env_delete(pathnames[i], MDBX_ENV_JUST_DELETE);
+    if (err != MDBX_SUCCESS && err != MDBX_RESULT_TRUE)
+      return failed("mdbx_env_delete", err);
+  }
+  int rc = mdbx_env_create(&env);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_env_create", rc);
+  rc = mdbx_env_set_maxdbs(env, NUM_TABLES + 1);
+  if (rc == MDBX_SUCCESS)
+    rc = mdbx_env_set_geometry(env, -1, -1, 1ul << 30, -1, -1, pagesize);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_set_geometry", rc);
+    goto bailout;
+  }
+  rc = mdbx_env_open(env, DB_PATHNAME, MDBX_NOSUBDIR, 0664);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_open", rc);
+    goto bailout;
+  }
+  rc = fill(env);
+  if (rc != MDBX_SUCCESS)
+    goto bailout;
+
+  rc = mdbx_env_copy(env, COPY_SEQUENTIAL, MDBX_CP_COMPACT);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_copy(MDBX_CP_COMPACT)", rc);
+    goto bailout;
+  }
+  rc = mdbx_env_copy(env, COPY_PARALLEL, MDBX_CP_COMPACT | MDBX_CP_PARALLEL);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_copy(MDBX_CP_COMPACT | MDBX_CP_PARALLEL)", rc);
+    goto bailout;
+  }
+  rc = compare();
+
+bailout:
+  mdbx_env_close(env);
+  return rc;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+
+  int rc = run(mdbx_limits_pgsize_min());
+  if (rc == MDBX_SUCCESS)
+    rc = run(-1);
+  if (rc == MDBX_SUCCESS)
+    printf("mdbx_env_copy(MDBX_CP_PARALLEL): passed\n");
+  return (rc != MDBX_SUCCESS) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
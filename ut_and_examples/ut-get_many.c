@@ -0,0 +1,210 @@
+/** \copyright SPDX-License-Identifier: Apache-2.0
+ * \file The unit test of the mdbx_get_many() against a sequence of mdbx_get() calls.
+ * \details The batches are sorted, reverse-sorted, shuffled and interleaved with absent keys,
+ * both in a read-only and in a write transaction with dirty pages, for a small and for the default page size. */
+
+#if (defined(__MINGW__) || defined(__MINGW32__) || defined(__MINGW64__)) && !defined(__USE_MINGW_ANSI_STDIO)
+#define __USE_MINGW_ANSI_STDIO 1
+#endif /* MinGW */
+
+#include "mdbx.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DB_PATHNAME "./ut-get_many-db"
+#define NUM_RECORDS 50000u
+#define BATCH_SIZE 4096u
+
+static uint64_t prng_state = 42;
+
+static uint32_t prng(void) {
+  prng_state = prng_state * 6364136223846793005ull + 1442695040888963407ull;
+  return (uint32_t)(prng_state >> 33);
+}
+
+static int failed(const char *what, int rc) {
+  fprintf(stderr, "%s: (%d) %s\n", what, rc, mdbx_strerror(rc));
+  return rc ? rc : MDBX_PROBLEM;
+}
+
+/* The keys are big-endian numbers, so the lexicographic order matches the numeric one.
+ * Only even numbers are stored, so the odd ones are absent. */
+static void make_key(uint32_t n, unsigned char buf[8]) {
+  for (int i = 0; i < 8; ++i)
+    buf[i] = (unsigned char)((uint64_t)n >> (56 - i * 8));
+}
+
+static int fill(MDBX_env *env, MDBX_dbi *dbi) {
+  MDBX_txn *txn;
+  int rc = mdbx_txn_begin(env, NULL, 0, &txn);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_txn_begin", rc);
+  rc = mdbx_dbi_open(txn, NULL, 0, dbi);
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(txn);
+    return failed("mdbx_dbi_open", rc);
+  }
+  for (uint32_t i = 0; i < NUM_RECORDS && rc == MDBX_SUCCESS; ++i) {
+    unsigned char kbuf[8];
+    uint32_t vbuf[2] = {i * 2, ~i};
+    make_key(i * 2, kbuf);
+    MDBX_val key = {kbuf, sizeof(kbuf)}, data = {vbuf, sizeof(vbuf)};
+    rc = mdbx_put(txn, *dbi, &key, &data, MDBX_APPEND);
+  }
+  if (rc != MDBX_SUCCESS) {
+    mdbx_txn_abort(txn);
+    return failed("mdbx_put", rc);
+  }
+  rc = mdbx_txn_commit(txn);
+  return (rc == MDBX_SUCCESS) ? rc : failed("mdbx_txn_commit", rc);
+}
+
+enum order { sorted, reversed, shuffled, nearly_sorted };
+
+static int check_batch(MDBX_txn *txn, MDBX_dbi dbi, enum order order, unsigned absent_percent) {
+  static unsigned char kbufs[BATCH_SIZE][8];
+  static MDBX_val keys[BATCH_SIZE], values[BATCH_SIZE];
+  static int statuses[BATCH_SIZE];
+
+  uint32_t base = prng() % (NUM_RECORDS * 2 - BATCH_SIZE * 2);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    uint32_t n = base + (uint32_t)i * 2;
+    if (prng() % 100 < absent_percent)
+      n |= 1;
+    make_key(n, kbufs[i]);
+  }
+  if (order == reversed)
+    for (size_t i = 0; i < BATCH_SIZE / 2; ++i) {
+      unsigned char tmp[8];
+      memcpy(tmp, kbufs[i], 8);
+      memcpy(kbufs[i], kbufs[BATCH_SIZE - 1 - i], 8);
+      memcpy(kbufs[BATCH_SIZE - 1 - i], tmp, 8);
+    }
+  else if (order == shuffled || order == nearly_sorted)
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+      const size_t distance = (order == shuffled) ? BATCH_SIZE - i : 8;
+      const size_t j = i + prng() % (distance < BATCH_SIZE - i ? distance : BATCH_SIZE - i);
+      unsigned char tmp[8];
+      memcpy(tmp, kbufs[i], 8);
+      memcpy(kbufs[i], kbufs[j], 8);
+      memcpy(kbufs[j], tmp, 8);
+    }
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    keys[i].iov_base = kbufs[i];
+    keys[i].iov_len = 8;
+  }
+
+  const int rc = mdbx_get_many(txn, dbi, keys, BATCH_SIZE, values, statuses);
+  if (rc != MDBX_SUCCESS && rc != MDBX_NOTFOUND)
+    return failed("mdbx_get_many", rc);
+
+  bool any_absent = false;
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    MDBX_val key = keys[i], expected;
+    const int err = mdbx_get(txn, dbi, &key, &expected);
+    if (err != statuses[i]) {
+      fprintf(stderr, "order %d, key #%zu: status %d, expected %d\n", order, i, statuses[i], err);
+      return MDBX_PROBLEM;
+    }
+    if (err == MDBX_SUCCESS ? values[i].iov_len != expected.iov_len ||
+                                  memcmp(values[i].iov_base, expected.iov_base, expected.iov_len) != 0
+                            : values[i].iov_base != NULL || values[i].iov_len != 0) {
+      fprintf(stderr, "order %d, key #%zu: value mismatch\n", order, i);
+      return MDBX_PROBLEM;
+    }
+    any_absent |= err == MDBX_NOTFOUND;
+  }
+  if (rc != (any_absent ? MDBX_NOTFOUND : MDBX_SUCCESS)) {
+    fprintf(stderr, "order %d: mdbx_get_many() returned %d\n", order, rc);
+    return MDBX_PROBLEM;
+  }
+  return MDBX_SUCCESS;
+}
+
+static int check_all(MDBX_txn *txn, MDBX_dbi dbi) {
+  static const unsigned absent[] = {0, 10, 50, 100};
+  for (int order = sorted; order <= nearly_sorted; ++order)
+    for (size_t i = 0; i < sizeof(absent) / sizeof(absent[0]); ++i) {
+      const int rc = check_batch(txn, dbi, (enum order)order, absent[i]);
+      if (rc != MDBX_SUCCESS)
+        return rc;
+    }
+  return MDBX_SUCCESS;
+}
+
+static int run(intptr_t pagesize) {
+  MDBX_env *env = NULL;
+  MDBX_txn *txn = NULL;
+  MDBX_dbi dbi;
+  int rc = mdbx_env_delete(DB_PATHNAME, MDBX_ENV_JUST_DELETE);
+  if (rc != MDBX_SUCCESS && rc != MDBX_RESULT_TRUE)
+    return failed("mdbx_env_delete", rc);
+  rc = mdbx_env_create(&env);
+  if (rc != MDBX_SUCCESS)
+    return failed("mdbx_env_create", rc);
+  rc = mdbx_env_set_geometry(env, -1, -1, -1, -1, -1, pagesize);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_set_geometry", rc);
+    goto bailout;
+  }
+  rc = mdbx_env_open(env, DB_PATHNAME, MDBX_NOSUBDIR | MDBX_LIFORECLAIM, 0664);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_env_open", rc);
+    goto bailout;
+  }
+  rc = fill(env, &dbi);
+  if (rc != MDBX_SUCCESS)
+    goto bailout;
+
+  rc = mdbx_txn_begin(env, NULL, MDBX_TXN_RDONLY, &txn);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_txn_begin", rc);
+    goto bailout;
+  }
+  rc = check_all(txn, dbi);
+  mdbx_txn_abort(txn);
+  txn = NULL;
+  if (rc != MDBX_SUCCESS)
+    goto bailout;
+
+  /* Within a write transaction some of the pages are dirty, i.e. the cursor stack refers to shadow copies. */
+  rc = mdbx_txn_begin(env, NULL, 0, &txn);
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_txn_begin", rc);
+    goto bailout;
+  }
+  for (uint32_t i = 0; i < NUM_RECORDS && rc == MDBX_SUCCESS; i += 7) {
+    unsigned char kbuf[8];
+    uint32_t vbuf[3] = {i, i, i};
+    make_key(i * 2 + (i & 1), kbuf);
+    MDBX_val key = {kbuf, sizeof(kbuf)}, data = {vbuf, sizeof(vbuf)};
+    rc = mdbx_put(txn, dbi, &key, &data, 0);
+  }
+  if (rc != MDBX_SUCCESS) {
+    rc = failed("mdbx_put", rc);
+    goto bailout;
+  }
+  rc = check_all(txn, dbi);
+
+bailout:
+  if (txn)
+    mdbx_txn_abort(txn);
+  mdbx_env_close(env);
+  return rc;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+
+  int rc = run(mdbx_limits_pgsize_min());
+  if (rc == MDBX_SUCCESS)
+    rc = run(-1);
+  if (rc == MDBX_SUCCESS)
+    printf("mdbx_get_many: passed\n");
+  return (rc != MDBX_SUCCESS) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
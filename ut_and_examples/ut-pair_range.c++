@@ -0,0 +1,123 @@
+/// \copyright SPDX-License-Identifier: Apache-2.0
+/// \file The unit test of the mdbx::pair_range against a plain cursor walk.
+/// \details The ranges are checked forward and backward, with and without boundaries, for single-value,
+/// multi-value and same-length multi-value maps, within both a read-only and a write transaction.
+/// The boundary keys are destroyed right after a range is created, and some ranges are moved before iteration.
+
+#include <mdbx.h++>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using entries = std::vector<std::pair<std::string, std::string>>;
+
+static std::string make_key(unsigned n) {
+  char buf[16];
+  std::snprintf(buf, sizeof(buf), "key-%05u", n);
+  return buf;
+}
+
+static std::string str(const mdbx::slice &slice) { return std::string(slice.char_ptr(), slice.length()); }
+
+static entries walk(mdbx::cursor cursor, const std::string &from, const std::string &to, bool has_from, bool has_to,
+                    bool backward) {
+  entries result;
+  for (auto it = cursor.to_first(false); it.done; it = cursor.to_next(false)) {
+    const std::string key = str(it.key);
+    if ((!has_from || key >= from) && (!has_to || key < to))
+      result.emplace_back(key, str(it.value));
+  }
+  if (backward)
+    std::reverse(result.begin(), result.end());
+  return result;
+}
+
+static entries collect(mdbx::pair_range &&range) {
+  entries result;
+  for (const auto &pair : range)
+    result.emplace_back(str(pair.key), str(pair.value));
+  return result;
+}
+
+static bool check(mdbx::txn &txn, mdbx::map_handle map, const char *caption) {
+  static const unsigned bounds[][2] = {{0, 0}, {0, 777}, {333, 0}, {333, 777}, {500, 501}, {600, 600}, {1, 999}};
+  for (const auto &b : bounds)
+    for (int backward = 0; backward < 2; ++backward) {
+      const std::string from = make_key(b[0]), to = make_key(b[1]);
+      const bool has_from = b[0] != 0, has_to = b[1] != 0;
+      auto cursor = txn.open_cursor(map);
+      const entries expected = walk(cursor, from, to, has_from, has_to, backward != 0);
+
+      /* the boundaries are passed by temporary strings, which are destroyed before the iteration */
+      auto range = txn.range(map, has_from ? mdbx::slice(std::string(from)) : mdbx::slice::invalid(),
+                             has_to ? mdbx::slice(std::string(to)) : mdbx::slice::invalid(), backward != 0);
+      if (collect(std::move(range)) != expected) {
+        std::cerr << caption << ": txn::range(" << b[0] << ", " << b[1] << ", " << backward << ") mismatch\n";
+        return false;
+      }
+
+      std::string from_buf(from), to_buf(to);
+      mdbx::pair_range moved(cursor.range(has_from ? mdbx::slice(from_buf) : mdbx::slice::invalid(),
+                                          has_to ? mdbx::slice(to_buf) : mdbx::slice::invalid(), backward != 0));
+      from_buf.assign(from_buf.size(), '~');
+      to_buf.assign(to_buf.size(), '~');
+      mdbx::pair_range range2(std::move(moved));
+      if (!moved.empty() || collect(std::move(range2)) != expected) {
+        std::cerr << caption << ": cursor::range(" << b[0] << ", " << b[1] << ", " << backward << ") mismatch\n";
+        return false;
+      }
+    }
+  return true;
+}
+
+int main(int argc, const char *argv[]) {
+  (void)argc;
+  (void)argv;
+
+  const mdbx::path pathname("./ut-pair_range-db");
+  mdbx::env::remove(pathname);
+  auto operate_parameters = mdbx::env::operate_parameters();
+  operate_parameters.max_maps = 3;
+  mdbx::env_managed env(pathname, mdbx::env_managed::create_parameters(), operate_parameters);
+
+  auto txn = env.start_write();
+  const mdbx::map_handle maps[] = {
+      txn.create_map("single", mdbx::key_mode::usual, mdbx::value_mode::single),
+      txn.create_map("multi", mdbx::key_mode::usual, mdbx::value_mode::multi),
+      txn.create_map("samelength", mdbx::key_mode::usual, mdbx::value_mode::multi_samelength)};
+  for (unsigned n = 1; n < 1000; n += (n % 7) ? 1 : 3) {
+    const std::string key = make_key(n);
+    txn.insert(maps[0], mdbx::slice(key), mdbx::slice(std::string(n % 97 + 1, 'a' + n % 26)));
+    for (unsigned i = 0; i < n % 5 + 1; ++i) {
+      txn.upsert(maps[1], mdbx::slice(key), mdbx::slice(std::string(i * 7 + 1, 'A' + (n + i) % 26)));
+      char fixed[24] /* enough for any pair of unsigned numbers, while only 7 chars are used */;
+      std::snprintf(fixed, sizeof(fixed), "%03u-%03u", n % 1000, i);
+      txn.upsert(maps[2], mdbx::slice(key), mdbx::slice(fixed, 7));
+    }
+  }
+  txn.commit();
+
+  bool ok = true;
+  txn = env.start_read();
+  for (const auto map : maps)
+    ok = ok && check(txn, map, "read-only");
+  txn.abort();
+
+  /* within a write transaction some of the pages are dirty */
+  txn = env.start_write();
+  for (unsigned n = 2; n < 1000; n += 11)
+    txn.upsert(maps[0], mdbx::slice(make_key(n)), mdbx::slice("changed"));
+  for (const auto map : maps)
+    ok = ok && check(txn, map, "read-write");
+  txn.abort();
+
+  env.close();
+  if (ok)
+    std::cout << "mdbx::pair_range: passed" << std::endl;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}